@@ -0,0 +1,191 @@
+/*
+This software is available under 2 licenses -- choose whichever you prefer.
+------------------------------------------------------------------------------
+ALTERNATIVE A - MIT License
+Copyright (c) 2023 Local Atticus
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+of the Software, and to permit persons to whom the Software is furnished to do
+so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+------------------------------------------------------------------------------
+ALTERNATIVE B - Public Domain (www.unlicense.org)
+This is free and unencumbered software released into the public domain.
+Anyone is free to copy, modify, publish, use, compile, sell, or distribute this
+software, either in source code form or as a compiled binary, for any purpose,
+commercial or non-commercial, and by any means.
+In jurisdictions that recognize copyright laws, the author or authors of this
+software dedicate any and all copyright interest in the software to the public
+domain. We make this dedication for the benefit of the public at large and to
+the detriment of our heirs and successors. We intend this dedication to be an
+overt act of relinquishment in perpetuity of all present and future rights to
+this software under copyright law.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+// Checks that sema gives every structurally identical type one canonical type, and measures
+// comparing types through them. 5k functions each spell out `int`, `int mut*` and `i32` in
+// their parameters and locals, and take the address of a local, which derives a pointer type.
+//
+// Every platform `int` must share the builtin `int` as its canonical type, every `int mut*`
+// must share one canonical type whether it was written or derived, and taking the address of
+// a local must derive the same pointer type in every function.
+
+#include <assert.h>
+#include <stdio.h>
+
+#define LCA_IMPLEMENTATION
+#include "laye.h"
+
+#include "bench.h"
+
+#define BENCH_FUNCTION_COUNT 5000
+
+static lca_string bench_module_source(void) {
+    lca_string source = lca_string_create(lca_default_allocator);
+
+    for (int64_t i = 0; i < BENCH_FUNCTION_COUNT; i++) {
+        lca_string_append_format(&source, "int function_%lld(int mut* p, i32 a) {\n", (long long)i);
+        lca_string_append_format(&source, "    int mut value = %lld;\n", (long long)i);
+        lca_string_append_format(&source, "    int mut* value_ptr = &value;\n");
+        lca_string_append_format(&source, "    *value_ptr = *p;\n");
+        lca_string_append_format(&source, "    return value;\n}\n\n");
+    }
+
+    return source;
+}
+
+static bool bench_is_int_mut_pointer(laye_context* laye_context, laye_node* node) {
+    return node->kind == LAYE_NODE_TYPE_POINTER &&
+           node->type_container.element_type.is_modifiable &&
+           laye_type_canonicalize(node->type_container.element_type.node) == laye_context->laye_types._int;
+}
+
+static int bench_check_canonical_types(laye_context* laye_context, laye_module* module, double analyse_seconds) {
+    int exit_code = 0;
+
+    lca_da(laye_node*) pointer_types = NULL;
+    laye_node* pointer_canonical_type = NULL;
+    int64_t int_type_count = 0;
+
+    for (int64_t i = 0, count = lca_da_count(module->_all_nodes); i < count; i++) {
+        laye_node* node = module->_all_nodes[i];
+        if (!laye_node_is_type(node) || node->sema_state != LYIR_SEMA_DONE) {
+            continue;
+        }
+
+        if (node->kind == LAYE_NODE_TYPE_INT && node->type_primitive.is_platform_specified && node->type_primitive.is_signed) {
+            int_type_count++;
+            if (node->canonical_type != laye_context->laye_types._int) {
+                fprintf(stderr, "an `int` type does not have the builtin `int` as its canonical type.\n");
+                exit_code = 1;
+            }
+        } else if (bench_is_int_mut_pointer(laye_context, node)) {
+            if (pointer_canonical_type == NULL) {
+                pointer_canonical_type = node->canonical_type;
+            }
+
+            if (node->canonical_type == NULL || node->canonical_type != pointer_canonical_type) {
+                fprintf(stderr, "the `int mut*` types do not share a canonical type.\n");
+                exit_code = 1;
+            }
+
+            lca_da_push(pointer_types, node);
+        }
+    }
+
+    // the address of `value` is the only type derived in each function, and it's the same type every time.
+    if (lca_hashmap_count(module->derived_types) != 1) {
+        fprintf(stderr, "expected 1 derived type, but sema derived %lld.\n", (long long)lca_hashmap_count(module->derived_types));
+        exit_code = 1;
+    }
+
+    int64_t pointer_type_count = lca_da_count(pointer_types);
+    if (pointer_type_count < 2 * BENCH_FUNCTION_COUNT) {
+        fprintf(stderr, "expected at least %d `int mut*` types, but found %lld.\n", 2 * BENCH_FUNCTION_COUNT, (long long)pointer_type_count);
+        exit_code = 1;
+    }
+
+    double compare_start_time = bench_now();
+    int64_t equal_count = 0;
+    for (int64_t i = 0; i < pointer_type_count; i++) {
+        for (int64_t j = 0; j < 100; j++) {
+            laye_type a = LTY(pointer_types[i]);
+            laye_type b = LTY(pointer_types[(i + j + 1) % pointer_type_count]);
+            equal_count += laye_type_equals(a, b, LAYE_MUT_EQUAL);
+        }
+    }
+    double compare_end_time = bench_now();
+
+    if (equal_count != pointer_type_count * 100) {
+        fprintf(stderr, "some `int mut*` types did not compare equal.\n");
+        exit_code = 1;
+    }
+
+    printf("%d functions, %lld `int` types, %lld `int mut*` types:\n", BENCH_FUNCTION_COUNT, (long long)int_type_count, (long long)pointer_type_count);
+    printf("  %-8s %10.3f ms\n", "analyse", analyse_seconds * 1e3);
+    printf("  %-8s %10.3f ms for %lld comparisons\n", "compare", (compare_end_time - compare_start_time) * 1e3, (long long)(pointer_type_count * 100));
+
+    lca_da_free(pointer_types);
+    return exit_code;
+}
+
+int main(void) {
+    lca_temp_allocator_init(lca_default_allocator, 1024 * 1024);
+    lyir_init_targets(lca_default_allocator);
+
+    lca_string_view source_path = LCA_SV_CONSTANT("./out/bench_laye_canonical_types.laye");
+
+    lca_string source = bench_module_source();
+    bool written = bench_write_file(source_path, source);
+    lca_string_destroy(&source);
+
+    if (!written) {
+        fprintf(stderr, "could not write the generated module to ./out.\n");
+        lca_temp_allocator_clear();
+        return 1;
+    }
+
+    lyir_context* lyir_context = lyir_context_create(lca_default_allocator);
+    laye_context* laye_context = laye_context_create(lyir_context);
+
+    lyir_sourceid sourceid = lyir_context_get_or_add_source_from_file(lyir_context, source_path);
+    assert(sourceid >= 0);
+    laye_module* module = laye_parse(laye_context, sourceid);
+    assert(module != NULL);
+
+    double start_time = bench_now();
+    laye_analyse(laye_context);
+    double analyse_time = bench_now();
+
+    int exit_code = 0;
+    if (laye_context->has_reported_errors || lyir_context->has_reported_errors) {
+        fprintf(stderr, "the generated module did not compile.\n");
+        exit_code = 1;
+    } else {
+        exit_code = bench_check_canonical_types(laye_context, module, analyse_time - start_time);
+    }
+
+    laye_context_destroy(laye_context);
+    lyir_context_destroy(lyir_context);
+
+    remove(source_path.data);
+
+    lca_temp_allocator_clear();
+    return exit_code;
+}
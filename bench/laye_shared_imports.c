@@ -0,0 +1,151 @@
+/*
+This software is available under 2 licenses -- choose whichever you prefer.
+------------------------------------------------------------------------------
+ALTERNATIVE A - MIT License
+Copyright (c) 2023 Local Atticus
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+of the Software, and to permit persons to whom the Software is furnished to do
+so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+------------------------------------------------------------------------------
+ALTERNATIVE B - Public Domain (www.unlicense.org)
+This is free and unencumbered software released into the public domain.
+Anyone is free to copy, modify, publish, use, compile, sell, or distribute this
+software, either in source code form or as a compiled binary, for any purpose,
+commercial or non-commercial, and by any means.
+In jurisdictions that recognize copyright laws, the author or authors of this
+software dedicate any and all copyright interest in the software to the public
+domain. We make this dedication for the benefit of the public at large and to
+the detriment of our heirs and successors. We intend this dedication to be an
+overt act of relinquishment in perpetuity of all present and future rights to
+this software under copyright law.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+// Measures what importing one large module from many others costs the Laye front end.
+// A library exports 5k functions, and 200 modules each import it both as a namespace and
+// with a wildcard, then call a single one of its functions. The main module imports all of
+// those modules.
+//
+// Reports the time spent in semantic analysis and how many symbols were created for the
+// import and export tables of every module.
+//
+// The modules are written to ./out first, since imports are found on disk.
+
+#include <assert.h>
+#include <stdio.h>
+
+#define LCA_IMPLEMENTATION
+#include "laye.h"
+
+#include "bench.h"
+
+#define BENCH_EXPORTED_COUNT 5000
+#define BENCH_IMPORTER_COUNT 200
+
+static bool bench_write_modules(void) {
+    bool written = true;
+
+    lca_string source = lca_string_create(lca_default_allocator);
+    for (int64_t i = 0; i < BENCH_EXPORTED_COUNT; i++) {
+        lca_string_append_format(&source, "export int library_%lld() { return %lld; }\n", (long long)i, (long long)i);
+    }
+
+    written = written && bench_write_file(LCA_SV_CONSTANT("./out/bench_laye_shared_imports_library.laye"), source);
+
+    for (int64_t i = 0; i < BENCH_IMPORTER_COUNT; i++) {
+        source.count = 0;
+        lca_string_append_format(&source, "import \"bench_laye_shared_imports_library.laye\" as library;\n");
+        lca_string_append_format(&source, "import * from \"bench_laye_shared_imports_library.laye\";\n\n");
+        lca_string_append_format(&source, "export int importer_%lld() {\n", (long long)i);
+        lca_string_append_format(&source, "    return library::library_%lld() + library_%lld();\n}\n", (long long)i, (long long)i);
+
+        char file_path[128];
+        snprintf(file_path, sizeof file_path, "./out/bench_laye_shared_imports_%lld.laye", (long long)i);
+        written = written && bench_write_file(lca_string_view_from_cstring(file_path), source);
+    }
+
+    source.count = 0;
+    for (int64_t i = 0; i < BENCH_IMPORTER_COUNT; i++) {
+        lca_string_append_format(&source, "import \"bench_laye_shared_imports_%lld.laye\";\n", (long long)i);
+    }
+
+    lca_string_append_format(&source, "\nint main() {\n    return bench_laye_shared_imports_0::importer_0();\n}\n");
+    written = written && bench_write_file(LCA_SV_CONSTANT("./out/bench_laye_shared_imports_main.laye"), source);
+
+    lca_string_destroy(&source);
+    return written;
+}
+
+static void bench_remove_modules(void) {
+    remove("./out/bench_laye_shared_imports_library.laye");
+    remove("./out/bench_laye_shared_imports_main.laye");
+
+    for (int64_t i = 0; i < BENCH_IMPORTER_COUNT; i++) {
+        char file_path[128];
+        snprintf(file_path, sizeof file_path, "./out/bench_laye_shared_imports_%lld.laye", (long long)i);
+        remove(file_path);
+    }
+}
+
+int main(void) {
+    lca_temp_allocator_init(lca_default_allocator, 1024 * 1024);
+    lyir_init_targets(lca_default_allocator);
+
+    if (!bench_write_modules()) {
+        fprintf(stderr, "could not write the generated modules to ./out.\n");
+        bench_remove_modules();
+        lca_temp_allocator_clear();
+        return 1;
+    }
+
+    lyir_context* lyir_context = lyir_context_create(lca_default_allocator);
+    laye_context* laye_context = laye_context_create(lyir_context);
+
+    lyir_sourceid sourceid = lyir_context_get_or_add_source_from_file(lyir_context, LCA_SV_CONSTANT("./out/bench_laye_shared_imports_main.laye"));
+    assert(sourceid >= 0);
+    laye_module* module = laye_parse(laye_context, sourceid);
+    assert(module != NULL);
+
+    double start_time = bench_now();
+    laye_analyse(laye_context);
+    double end_time = bench_now();
+
+    int exit_code = 0;
+    if (laye_context->has_reported_errors) {
+        fprintf(stderr, "the generated modules did not compile.\n");
+        exit_code = 1;
+    } else {
+        int64_t symbol_count = 0;
+        for (int64_t i = 0, count = lca_da_count(laye_context->laye_modules); i < count; i++) {
+            symbol_count += lca_da_count(laye_context->laye_modules[i]->_all_symbols);
+        }
+
+        printf("%d modules importing a library of %d functions:\n", BENCH_IMPORTER_COUNT, BENCH_EXPORTED_COUNT);
+        printf("  %-8s %10.3f ms\n", "analyse", (end_time - start_time) * 1e3);
+        printf("  %-8s %10lld\n", "symbols", (long long)symbol_count);
+    }
+
+    laye_context_destroy(laye_context);
+    lyir_context_destroy(lyir_context);
+
+    bench_remove_modules();
+    lca_temp_allocator_clear();
+    return exit_code;
+}
@@ -0,0 +1,146 @@
+/*
+This software is available under 2 licenses -- choose whichever you prefer.
+------------------------------------------------------------------------------
+ALTERNATIVE A - MIT License
+Copyright (c) 2023 Local Atticus
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+of the Software, and to permit persons to whom the Software is furnished to do
+so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+------------------------------------------------------------------------------
+ALTERNATIVE B - Public Domain (www.unlicense.org)
+This is free and unencumbered software released into the public domain.
+Anyone is free to copy, modify, publish, use, compile, sell, or distribute this
+software, either in source code form or as a compiled binary, for any purpose,
+commercial or non-commercial, and by any means.
+In jurisdictions that recognize copyright laws, the author or authors of this
+software dedicate any and all copyright interest in the software to the public
+domain. We make this dedication for the benefit of the public at large and to
+the detriment of our heirs and successors. We intend this dedication to be an
+overt act of relinquishment in perpetuity of all present and future rights to
+this software under copyright law.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+// Measures how long the Laye front end and IR generator take on struct-heavy code: one
+// struct with 4k fields that has every field written and read back, plus 2k small structs
+// that are each declared as a local and have their last field read.
+
+#include <assert.h>
+#include <stdio.h>
+
+#define LCA_IMPLEMENTATION
+#include "laye.h"
+
+#include "bench.h"
+
+#define BENCH_WIDE_FIELD_COUNT   4000
+#define BENCH_SMALL_STRUCT_COUNT 2000
+#define BENCH_SMALL_FIELD_COUNT  16
+
+static lca_string bench_module_source(void) {
+    lca_string source = lca_string_create(lca_default_allocator);
+
+    lca_string_append_format(&source, "struct wide {\n");
+    for (int64_t i = 0; i < BENCH_WIDE_FIELD_COUNT; i++) {
+        lca_string_append_format(&source, "    mut %s field_%lld;\n", i % 3 == 0 ? "i8" : "int", (long long)i);
+    }
+
+    lca_string_append_format(&source, "}\n\n");
+
+    for (int64_t i = 0; i < BENCH_SMALL_STRUCT_COUNT; i++) {
+        lca_string_append_format(&source, "struct small_%lld {\n", (long long)i);
+        for (int64_t j = 0; j < BENCH_SMALL_FIELD_COUNT; j++) {
+            lca_string_append_format(&source, "    mut int field_%lld;\n", (long long)j);
+        }
+
+        lca_string_append_format(&source, "}\n\n");
+    }
+
+    lca_string_append_format(&source, "int touch_wide() {\n    mut wide w;\n    mut int total = 0;\n");
+    for (int64_t i = 0; i < BENCH_WIDE_FIELD_COUNT; i++) {
+        if (i % 3 == 0) continue;
+        lca_string_append_format(&source, "    w.field_%lld = %lld;\n", (long long)i, (long long)i);
+        lca_string_append_format(&source, "    total = total + w.field_%lld;\n", (long long)i);
+    }
+
+    lca_string_append_format(&source, "    return total;\n}\n\n");
+
+    lca_string_append_format(&source, "int touch_small() {\n    mut int total = 0;\n");
+    for (int64_t i = 0; i < BENCH_SMALL_STRUCT_COUNT; i++) {
+        lca_string_append_format(&source, "    mut small_%lld s%lld;\n", (long long)i, (long long)i);
+        lca_string_append_format(&source, "    total = total + s%lld.field_%lld;\n", (long long)i, (long long)(BENCH_SMALL_FIELD_COUNT - 1));
+    }
+
+    lca_string_append_format(&source, "    return total;\n}\n");
+    return source;
+}
+
+int main(void) {
+    lca_temp_allocator_init(lca_default_allocator, 1024 * 1024);
+    lyir_init_targets(lca_default_allocator);
+
+    lca_string_view source_path = LCA_SV_CONSTANT("./out/bench_laye_struct_members.laye");
+
+    lca_string source = bench_module_source();
+    bool written = bench_write_file(source_path, source);
+    lca_string_destroy(&source);
+
+    if (!written) {
+        fprintf(stderr, "could not write the generated module to ./out.\n");
+        lca_temp_allocator_clear();
+        return 1;
+    }
+
+    lyir_context* lyir_context = lyir_context_create(lca_default_allocator);
+    laye_context* laye_context = laye_context_create(lyir_context);
+
+    double start_time = bench_now();
+
+    lyir_sourceid sourceid = lyir_context_get_or_add_source_from_file(lyir_context, source_path);
+    assert(sourceid >= 0);
+    laye_module* module = laye_parse(laye_context, sourceid);
+    assert(module != NULL);
+
+    double parse_time = bench_now();
+    laye_analyse(laye_context);
+    double analyse_time = bench_now();
+
+    int exit_code = 0;
+    if (laye_context->has_reported_errors || lyir_context->has_reported_errors) {
+        fprintf(stderr, "the generated module did not compile.\n");
+        exit_code = 1;
+    } else {
+        laye_generate_ir(laye_context);
+        double end_time = bench_now();
+
+        printf("%d fields in one struct, %d structs of %d fields:\n", BENCH_WIDE_FIELD_COUNT, BENCH_SMALL_STRUCT_COUNT, BENCH_SMALL_FIELD_COUNT);
+        printf("  %-8s %10.3f ms\n", "parse", (parse_time - start_time) * 1e3);
+        printf("  %-8s %10.3f ms\n", "analyse", (analyse_time - parse_time) * 1e3);
+        printf("  %-8s %10.3f ms\n", "irgen", (end_time - analyse_time) * 1e3);
+    }
+
+    laye_context_destroy(laye_context);
+    lyir_context_destroy(lyir_context);
+
+    remove(source_path.data);
+
+    lca_temp_allocator_clear();
+    return exit_code;
+}
@@ -0,0 +1,174 @@
+/*
+This software is available under 2 licenses -- choose whichever you prefer.
+------------------------------------------------------------------------------
+ALTERNATIVE A - MIT License
+Copyright (c) 2023 Local Atticus
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+of the Software, and to permit persons to whom the Software is furnished to do
+so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+------------------------------------------------------------------------------
+ALTERNATIVE B - Public Domain (www.unlicense.org)
+This is free and unencumbered software released into the public domain.
+Anyone is free to copy, modify, publish, use, compile, sell, or distribute this
+software, either in source code form or as a compiled binary, for any purpose,
+commercial or non-commercial, and by any means.
+In jurisdictions that recognize copyright laws, the author or authors of this
+software dedicate any and all copyright interest in the software to the public
+domain. We make this dedication for the benefit of the public at large and to
+the detriment of our heirs and successors. We intend this dedication to be an
+overt act of relinquishment in perpetuity of all present and future rights to
+this software under copyright law.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+// Compares lookups in an `lca_hashmap` against the linear `lca_da` scans the compiler
+// used before it had one, at 10, 1k and 100k entries, for both pointer and string view keys.
+
+#include <assert.h>
+#include <stdio.h>
+
+#define LCA_IMPLEMENTATION
+#include "lca.h"
+
+#include "bench.h"
+
+typedef struct bench_entry {
+    void* key;
+    lca_string_view name;
+    int64_t value;
+} bench_entry;
+
+// so the optimizer cannot throw the lookups away.
+static volatile int64_t bench_sink;
+
+static int64_t bench_lookup_count(int64_t entry_count, bool linear) {
+    // a linear scan over 100k entries is slow enough that it gets fewer lookups.
+    if (linear && entry_count * 1000000 > 50000000) return 50000000 / entry_count;
+    return 1000000;
+}
+
+static void bench_run(int64_t entry_count, bool string_keys) {
+    lca_da(bench_entry) entries = NULL;
+    char* names = lca_allocate(lca_default_allocator, (size_t)entry_count * 16);
+
+    for (int64_t i = 0; i < entry_count; i++) {
+        int name_length = snprintf(names + i * 16, 16, "name_%lld", (long long)i);
+
+        bench_entry entry = {
+            .key = (void*)(uintptr_t)(0x10000 + i * 16),
+            .name = (lca_string_view){.data = names + i * 16, .count = name_length},
+            .value = i,
+        };
+        lca_da_push(entries, entry);
+    }
+
+    lca_hashmap(void*, int64_t) pointer_map = NULL;
+    lca_hashmap(lca_string_view, int64_t) string_map = NULL;
+    for (int64_t i = 0; i < entry_count; i++) {
+        if (string_keys) {
+            lca_hashmap_set(string_map, entries[i].name, entries[i].value);
+        } else {
+            lca_hashmap_set(pointer_map, entries[i].key, entries[i].value);
+        }
+    }
+
+    assert(lca_hashmap_count(string_keys ? (void*)string_map : (void*)pointer_map) == entry_count);
+
+    // linear scan, the way the lookups were written without a hash table.
+    int64_t linear_lookups = bench_lookup_count(entry_count, true);
+    double start_time = bench_now();
+    for (int64_t n = 0; n < linear_lookups; n++) {
+        int64_t target = (n * 7919) % entry_count;
+        for (int64_t i = 0; i < entry_count; i++) {
+            bool found = string_keys ? lca_string_view_equals(entries[i].name, entries[target].name) : entries[i].key == entries[target].key;
+            if (found) {
+                bench_sink += entries[i].value;
+                break;
+            }
+        }
+    }
+    double linear_ns = (bench_now() - start_time) * 1e9 / (double)linear_lookups;
+
+    int64_t hashed_lookups = bench_lookup_count(entry_count, false);
+    start_time = bench_now();
+    for (int64_t n = 0; n < hashed_lookups; n++) {
+        int64_t target = (n * 7919) % entry_count;
+        if (string_keys) {
+            __typeof__(string_map) entry = lca_hashmap_find(string_map, entries[target].name);
+            assert(entry != NULL && entry->value == target);
+            bench_sink += entry->value;
+        } else {
+            __typeof__(pointer_map) entry = lca_hashmap_find(pointer_map, entries[target].key);
+            assert(entry != NULL && entry->value == target);
+            bench_sink += entry->value;
+        }
+    }
+    double hashed_ns = (bench_now() - start_time) * 1e9 / (double)hashed_lookups;
+
+    printf("%8lld %14.1f %14.1f %10.1fx\n", (long long)entry_count, linear_ns, hashed_ns, linear_ns / hashed_ns);
+
+    // removing every other entry must leave exactly the rest reachable.
+    for (int64_t i = 0; i < entry_count; i += 2) {
+        bool removed = string_keys ? lca_hashmap_remove(string_map, entries[i].name) : lca_hashmap_remove(pointer_map, entries[i].key);
+        assert(removed);
+    }
+
+    int64_t remaining = 0;
+    if (string_keys) {
+        lca_hashmap_for_each(string_map, i) {
+            assert(string_map[i].value % 2 == 1);
+            remaining++;
+        }
+    } else {
+        lca_hashmap_for_each(pointer_map, i) {
+            assert(pointer_map[i].value % 2 == 1);
+            remaining++;
+        }
+    }
+
+    assert(remaining == entry_count / 2);
+    for (int64_t i = 1; i < entry_count; i += 2) {
+        bool found = string_keys ? lca_hashmap_contains(string_map, entries[i].name) : lca_hashmap_contains(pointer_map, entries[i].key);
+        assert(found);
+    }
+
+    lca_hashmap_free(pointer_map);
+    lca_hashmap_free(string_map);
+    lca_deallocate(lca_default_allocator, names);
+    lca_da_free(entries);
+}
+
+int main(int argc, char** argv) {
+    const int64_t entry_counts[] = {10, 1000, 100000};
+
+    for (int mode = 0; mode < 2; mode++) {
+        bool string_keys = mode == 1;
+
+        printf("%s keys:\n", string_keys ? "string view" : "pointer");
+        printf("%8s %14s %14s %11s\n", "entries", "linear (ns)", "hashed (ns)", "speedup");
+        for (size_t i = 0; i < sizeof entry_counts / sizeof *entry_counts; i++) {
+            bench_run(entry_counts[i], string_keys);
+        }
+
+        printf("\n");
+    }
+
+    return 0;
+}
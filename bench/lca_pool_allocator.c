@@ -0,0 +1,241 @@
+/*
+This software is available under 2 licenses -- choose whichever you prefer.
+------------------------------------------------------------------------------
+ALTERNATIVE A - MIT License
+Copyright (c) 2023 Local Atticus
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+of the Software, and to permit persons to whom the Software is furnished to do
+so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+------------------------------------------------------------------------------
+ALTERNATIVE B - Public Domain (www.unlicense.org)
+This is free and unencumbered software released into the public domain.
+Anyone is free to copy, modify, publish, use, compile, sell, or distribute this
+software, either in source code form or as a compiled binary, for any purpose,
+commercial or non-commercial, and by any means.
+In jurisdictions that recognize copyright laws, the author or authors of this
+software dedicate any and all copyright interest in the software to the public
+domain. We make this dedication for the benefit of the public at large and to
+the detriment of our heirs and successors. We intend this dedication to be an
+overt act of relinquishment in perpetuity of all present and future rights to
+this software under copyright law.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+// Compares `lca_pool_allocator` against the calloc based `lca_default_allocator`, first on
+// the allocation pattern of many small, short lived dynamic arrays, then on compiling every
+// Laye test with the compiler, once with each `--allocator`.
+//
+// The compiler is ./out/layec0 unless another one is passed as the first argument. The one the
+// Makefile builds uses AddressSanitizer, which makes every system allocation more expensive;
+// pass a build without it to see what the pool does for a regular build.
+
+#include <assert.h>
+#include <fcntl.h>
+#include <ftw.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#define LCA_IMPLEMENTATION
+#include "lyir.h"
+
+#include "bench.h"
+
+#define BENCH_COMPILE_ROUNDS 3
+
+static double bench_small_arrays(lca_allocator allocator) {
+    const int64_t round_count = 200;
+    const int64_t live_count = 10000;
+
+    void** live = lca_allocate(lca_default_allocator, (size_t)live_count * sizeof *live);
+    uint64_t random_state = 0x9E3779B97F4A7C15;
+
+    double start_time = bench_now();
+
+    for (int64_t round = 0; round < round_count; round++) {
+        for (int64_t i = 0; i < live_count; i++) {
+            random_state = random_state * 6364136223846793005 + 1442695040888963407;
+            // the header and 32 elements of an `lca_da` of pointers or of small structs.
+            size_t size = sizeof(lca_da_header) + 32 * (8 + (size_t)((random_state >> 33) % 3) * 8);
+            live[i] = lca_allocate(allocator, size);
+
+            // some of them grow once, the way operand and user lists do.
+            if ((random_state >> 40) % 4 == 0) {
+                live[i] = lca_reallocate(allocator, live[i], size * 2);
+            }
+        }
+
+        for (int64_t i = 0; i < live_count; i++) {
+            lca_deallocate(allocator, live[i]);
+        }
+    }
+
+    double elapsed = bench_now() - start_time;
+
+    lca_deallocate(lca_default_allocator, live);
+    return elapsed;
+}
+
+#define BENCH_RELEASE_BLOCK_COUNT 48
+#define BENCH_RELEASE_BLOCK_SIZE  48
+
+static void* bench_release_blocks[BENCH_RELEASE_BLOCK_COUNT];
+
+static void* bench_release_thread(void* user_data) {
+    for (int64_t i = 0; i < BENCH_RELEASE_BLOCK_COUNT; i++) {
+        bench_release_blocks[i] = lca_allocate(lca_pool_allocator, BENCH_RELEASE_BLOCK_SIZE);
+    }
+
+    for (int64_t i = 0; i < BENCH_RELEASE_BLOCK_COUNT; i++) {
+        lca_deallocate(lca_pool_allocator, bench_release_blocks[i]);
+    }
+
+    lca_pool_thread_release();
+    return NULL;
+}
+
+// blocks a worker thread freed must be handed out again once it released its caches,
+// rather than staying behind in the caches of a thread which no longer exists.
+static bool bench_check_thread_release(void) {
+    pthread_t thread;
+    if (pthread_create(&thread, NULL, bench_release_thread, NULL) != 0) return false;
+    pthread_join(thread, NULL);
+
+    void* block = lca_allocate(lca_pool_allocator, BENCH_RELEASE_BLOCK_SIZE);
+
+    bool reused = false;
+    for (int64_t i = 0; i < BENCH_RELEASE_BLOCK_COUNT; i++) {
+        if (block == bench_release_blocks[i]) reused = true;
+    }
+
+    lca_deallocate(lca_pool_allocator, block);
+    return reused;
+}
+
+static lca_da(char*) bench_test_files;
+
+static int bench_collect_test_file(const char* file_path, const struct stat* statbuf, int type_flag, struct FTW* ftw) {
+    if (type_flag != FTW_F) return 0;
+
+    lca_string_view path = lca_string_view_from_cstring(file_path);
+    if (!lca_string_view_ends_with_cstring(path, ".laye")) return 0;
+
+    lca_da_push(bench_test_files, lca_string_view_to_cstring(lca_default_allocator, path));
+    return 0;
+}
+
+static bool bench_compile(const char* compiler_path, const char* allocator_name, const char* file_path) {
+    pid_t pid = fork();
+    assert(pid >= 0);
+
+    if (pid == 0) {
+        int null_fd = open("/dev/null", O_WRONLY);
+        dup2(null_fd, STDOUT_FILENO);
+        dup2(null_fd, STDERR_FILENO);
+
+        char* arguments[] = {
+            (char*)compiler_path,
+            "--allocator",
+            (char*)allocator_name,
+            "--nocolor",
+            "-S",
+            "-emit-llvm",
+            "-o",
+            "-",
+            (char*)file_path,
+            NULL,
+        };
+
+        execv(compiler_path, arguments);
+        _exit(127);
+    }
+
+    // some tests are expected to fail to compile, only failing to run the compiler at all matters here.
+    int status = 0;
+    waitpid(pid, &status, 0);
+    return !WIFEXITED(status) || WEXITSTATUS(status) != 127;
+}
+
+static double bench_compile_tests(const char* compiler_path, const char* allocator_name) {
+    double start_time = bench_now();
+
+    for (int round = 0; round < BENCH_COMPILE_ROUNDS; round++) {
+        for (int64_t i = 0, count = lca_da_count(bench_test_files); i < count; i++) {
+            if (!bench_compile(compiler_path, allocator_name, bench_test_files[i])) {
+                return -1;
+            }
+        }
+    }
+
+    return bench_now() - start_time;
+}
+
+int main(int argc, char** argv) {
+    lca_temp_allocator_init(lca_default_allocator, 1024 * 1024);
+
+    // nothing else has used the pool yet, so the main thread's cache for these blocks is empty.
+    if (!bench_check_thread_release()) {
+        fprintf(stderr, "blocks freed on a thread were not returned to the pool by lca_pool_thread_release.\n");
+        lca_temp_allocator_clear();
+        return 1;
+    }
+
+    double system_elapsed = bench_small_arrays(lca_default_allocator);
+    double pool_elapsed = bench_small_arrays(lca_pool_allocator);
+
+    printf("allocating and freeing small dynamic arrays:\n");
+    printf("  %-8s %10.3f ms\n", "system", system_elapsed * 1e3);
+    printf("  %-8s %10.3f ms\n", "pool", pool_elapsed * 1e3);
+    printf("  speedup: %.2fx\n\n", system_elapsed / pool_elapsed);
+
+    const char* compiler_path = argc > 1 ? argv[1] : "./out/layec0";
+    if (access(compiler_path, X_OK) != 0) {
+        fprintf(stderr, "%s does not exist, not compiling the tests.\n", compiler_path);
+        lca_temp_allocator_clear();
+        return 1;
+    }
+
+    nftw("./test/laye", bench_collect_test_file, 16, FTW_PHYS);
+
+    // the first run warms the page cache for the compiler and the tests.
+    bench_compile_tests(compiler_path, "system");
+
+    double system_compile_elapsed = bench_compile_tests(compiler_path, "system");
+    double pool_compile_elapsed = bench_compile_tests(compiler_path, "pool");
+    if (system_compile_elapsed < 0 || pool_compile_elapsed < 0) {
+        fprintf(stderr, "could not run %s.\n", compiler_path);
+        lca_temp_allocator_clear();
+        return 1;
+    }
+
+    printf("compiling %lld Laye tests to LLVM IR %d times with %s:\n", (long long)lca_da_count(bench_test_files), BENCH_COMPILE_ROUNDS, compiler_path);
+    printf("  %-8s %10.3f ms\n", "system", system_compile_elapsed * 1e3);
+    printf("  %-8s %10.3f ms\n", "pool", pool_compile_elapsed * 1e3);
+    printf("  speedup: %.2fx\n", system_compile_elapsed / pool_compile_elapsed);
+
+    for (int64_t i = 0, count = lca_da_count(bench_test_files); i < count; i++) {
+        lca_deallocate(lca_default_allocator, bench_test_files[i]);
+    }
+
+    lca_da_free(bench_test_files);
+    lca_temp_allocator_clear();
+    return 0;
+}
@@ -0,0 +1,204 @@
+/*
+This software is available under 2 licenses -- choose whichever you prefer.
+------------------------------------------------------------------------------
+ALTERNATIVE A - MIT License
+Copyright (c) 2023 Local Atticus
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+of the Software, and to permit persons to whom the Software is furnished to do
+so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+------------------------------------------------------------------------------
+ALTERNATIVE B - Public Domain (www.unlicense.org)
+This is free and unencumbered software released into the public domain.
+Anyone is free to copy, modify, publish, use, compile, sell, or distribute this
+software, either in source code form or as a compiled binary, for any purpose,
+commercial or non-commercial, and by any means.
+In jurisdictions that recognize copyright laws, the author or authors of this
+software dedicate any and all copyright interest in the software to the public
+domain. We make this dedication for the benefit of the public at large and to
+the detriment of our heirs and successors. We intend this dedication to be an
+overt act of relinquishment in perpetuity of all present and future rights to
+this software under copyright law.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+// Compares the string view comparison and search kernels against plain byte-at-a-time loops,
+// at lengths typical of identifiers (4 to 24 bytes) and of file paths (48 to 256 bytes).
+// Each kernel is first checked against the byte loops at every length and match position,
+// so a mismatch fails the benchmark before anything is timed.
+
+#include <assert.h>
+#include <stdio.h>
+
+#define LCA_IMPLEMENTATION
+#include "lca.h"
+
+#include "bench.h"
+
+typedef struct bench_kernels {
+    const char* name;
+    bool (*equals)(const char* a, const char* b, int64_t count);
+    int64_t (*index_of)(const char* data, int64_t count, char c);
+    int64_t (*last_index_of)(const char* data, int64_t count, char c);
+} bench_kernels;
+
+static bool bench_equals_bytes(const char* a, const char* b, int64_t count) {
+    for (int64_t i = 0; i < count; i++) {
+        if (a[i] != b[i]) return false;
+    }
+    return true;
+}
+
+static int64_t bench_index_of_bytes(const char* data, int64_t count, char c) {
+    for (int64_t i = 0; i < count; i++) {
+        if (data[i] == c) return i;
+    }
+    return -1;
+}
+
+static int64_t bench_last_index_of_bytes(const char* data, int64_t count, char c) {
+    for (int64_t i = count - 1; i >= 0; i--) {
+        if (data[i] == c) return i;
+    }
+    return -1;
+}
+
+static int64_t bench_index_of_swar(const char* data, int64_t count, char c) {
+    return lca_index_of_swar(data, 0, count, c);
+}
+
+#define BENCH_MAX_LENGTH 320
+
+static bool bench_check_kernels(bench_kernels kernels) {
+    // heap allocations sized exactly, so reading past the end shows up under the sanitizers.
+    for (int64_t count = 0; count <= BENCH_MAX_LENGTH; count++) {
+        char* a = malloc((size_t)count + 1);
+        char* b = malloc((size_t)count + 1);
+        for (int64_t i = 0; i < count; i++) {
+            a[i] = b[i] = (char)('a' + i % 26);
+        }
+
+        if (!kernels.equals(a, b, count)) return false;
+        for (int64_t i = 0; i < count; i++) {
+            b[i] = '#';
+            if (kernels.equals(a, b, count)) return false;
+            b[i] = a[i];
+        }
+
+        if (kernels.index_of(a, count, '/') != -1 || kernels.last_index_of(a, count, '/') != -1) return false;
+        for (int64_t i = 0; i < count; i++) {
+            a[i] = '/';
+            if (kernels.index_of(a, count, '/') != bench_index_of_bytes(a, count, '/')) return false;
+            if (kernels.last_index_of(a, count, '/') != bench_last_index_of_bytes(a, count, '/')) return false;
+            // a second match on either side must not change the answer from the other end.
+            if (i + 1 < count) {
+                a[count - 1] = '/';
+                if (kernels.index_of(a, count, '/') != i) return false;
+                a[count - 1] = (char)('a' + (count - 1) % 26);
+            }
+
+            if (i > 0) {
+                a[0] = '/';
+                if (kernels.last_index_of(a, count, '/') != i) return false;
+                a[0] = 'a';
+            }
+
+            a[i] = (char)('a' + i % 26);
+        }
+
+        free(a);
+        free(b);
+    }
+
+    return true;
+}
+
+static volatile int64_t bench_sink;
+
+static double bench_time_kernels(bench_kernels kernels, int64_t count, int64_t iterations) {
+    char a[BENCH_MAX_LENGTH];
+    char b[BENCH_MAX_LENGTH];
+    for (int64_t i = 0; i < count; i++) {
+        a[i] = b[i] = (char)('a' + i % 26);
+    }
+
+    // paths are searched for their last separator, so put one near the front.
+    if (count > 1) a[1] = '/';
+    if (count > 1) b[1] = '/';
+
+    const char* volatile a_ref = a;
+    const char* volatile b_ref = b;
+
+    int64_t result = 0;
+    double start_time = bench_now();
+    for (int64_t i = 0; i < iterations; i++) {
+        result += kernels.equals(a_ref, b_ref, count);
+        result += kernels.index_of(a_ref, count, '.');
+        result += kernels.last_index_of(a_ref, count, '/');
+    }
+
+    double elapsed = bench_now() - start_time;
+    bench_sink = result;
+    return elapsed * 1e9 / (double)iterations;
+}
+
+int main(int argc, char** argv) {
+    bench_kernels all_kernels[5] = {0};
+    int64_t kernel_count = 0;
+
+    all_kernels[kernel_count++] = (bench_kernels){"bytes", bench_equals_bytes, bench_index_of_bytes, bench_last_index_of_bytes};
+    all_kernels[kernel_count++] = (bench_kernels){"swar", lca_memory_equals_swar, bench_index_of_swar, lca_last_index_of_swar};
+#if defined(LCA_HAS_SSE2)
+    all_kernels[kernel_count++] = (bench_kernels){"sse2", lca_memory_equals_sse2, lca_index_of_sse2, lca_last_index_of_sse2};
+#endif
+#if defined(LCA_HAS_AVX2)
+    if (lca_simd_level_get() == LCA_SIMD_AVX2) {
+        all_kernels[kernel_count++] = (bench_kernels){"avx2", lca_memory_equals_avx2, lca_index_of_avx2, lca_last_index_of_avx2};
+    }
+#endif
+    // what the lca string view functions actually call, after picking a kernel by length and CPU.
+    all_kernels[kernel_count++] = (bench_kernels){"dispatched", lca_memory_equals, lca_memory_index_of, lca_memory_last_index_of};
+
+    for (int64_t i = 0; i < kernel_count; i++) {
+        if (!bench_check_kernels(all_kernels[i])) {
+            fprintf(stderr, "the %s kernels disagree with the byte loops.\n", all_kernels[i].name);
+            return 1;
+        }
+    }
+
+    const int64_t lengths[] = {4, 8, 12, 16, 24, 48, 96, 160, 256};
+    const int64_t iterations = 2000000;
+
+    printf("ns per equals + index_of + last_index_of, by length:\n");
+    printf("%8s", "length");
+    for (int64_t i = 0; i < kernel_count; i++) {
+        printf(" %10s", all_kernels[i].name);
+    }
+    printf("\n");
+
+    for (int64_t l = 0; l < (int64_t)(sizeof lengths / sizeof *lengths); l++) {
+        printf("%8lld", (long long)lengths[l]);
+        for (int64_t i = 0; i < kernel_count; i++) {
+            printf(" %10.2f", bench_time_kernels(all_kernels[i], lengths[l], iterations));
+        }
+        printf("\n");
+    }
+
+    return 0;
+}
@@ -0,0 +1,147 @@
+/*
+This software is available under 2 licenses -- choose whichever you prefer.
+------------------------------------------------------------------------------
+ALTERNATIVE A - MIT License
+Copyright (c) 2023 Local Atticus
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+of the Software, and to permit persons to whom the Software is furnished to do
+so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+------------------------------------------------------------------------------
+ALTERNATIVE B - Public Domain (www.unlicense.org)
+This is free and unencumbered software released into the public domain.
+Anyone is free to copy, modify, publish, use, compile, sell, or distribute this
+software, either in source code form or as a compiled binary, for any purpose,
+commercial or non-commercial, and by any means.
+In jurisdictions that recognize copyright laws, the author or authors of this
+software dedicate any and all copyright interest in the software to the public
+domain. We make this dedication for the benefit of the public at large and to
+the detriment of our heirs and successors. We intend this dedication to be an
+overt act of relinquishment in perpetuity of all present and future rights to
+this software under copyright law.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+// Measures how long it takes to build (and then number) straight-line LYIR functions
+// of increasing size, both by appending and by always inserting at the front of the block.
+// Construction should be linear in the number of instructions either way, so the time
+// spent per instruction must stay roughly flat as the function grows.
+
+#include <assert.h>
+#include <stdio.h>
+
+#define LCA_IMPLEMENTATION
+#include "lyir.h"
+
+#include "bench.h"
+
+static double bench_build_function(int64_t instruction_count, bool insert_at_front) {
+    lyir_context* context = lyir_context_create(lca_default_allocator);
+    assert(context != NULL);
+
+    lyir_module* module = lyir_module_create(context, LCA_SV_CONSTANT("bench"));
+    assert(module != NULL);
+
+    lyir_type* i64_type = lyir_int_type(context, 64);
+    lyir_type* function_type = lyir_function_type(context, i64_type, NULL, LYIR_CCC, false);
+    lyir_value* function = lyir_module_create_function(module, (lyir_location){0}, LCA_SV_CONSTANT("bench"), function_type, NULL, LYIR_LINK_EXPORTED);
+    lyir_value* entry_block = lyir_value_function_block_append(function, LCA_SV_CONSTANT("entry"));
+
+    lyir_builder* builder = lyir_builder_create(context);
+    lyir_builder_position_at_end(builder, entry_block);
+
+    lyir_value* one = lyir_int_constant_create(context, (lyir_location){0}, i64_type, 1);
+
+    double start_time = bench_now();
+
+    if (insert_at_front) {
+        lyir_value* first = lyir_build_return(builder, (lyir_location){0}, one);
+        for (int64_t i = 0; i < instruction_count - 1; i++) {
+            lyir_builder_position_before(builder, first);
+            first = lyir_build_add(builder, (lyir_location){0}, one, one);
+        }
+
+        // walk the block by index, the way the backends do.
+        for (int64_t i = 0; i < instruction_count; i++) {
+            lyir_value* instruction = lyir_value_block_instruction_get_at_index(entry_block, i);
+            assert(instruction != NULL);
+        }
+
+        // requesting an index is what forces the instructions to be numbered.
+        int64_t first_index = lyir_value_index_get(first);
+        assert(first_index == 0);
+    } else {
+        lyir_value* accumulator = one;
+        for (int64_t i = 0; i < instruction_count - 1; i++) {
+            accumulator = lyir_build_add(builder, (lyir_location){0}, accumulator, one);
+        }
+
+        lyir_build_return(builder, (lyir_location){0}, accumulator);
+
+        // requesting an index is what forces the instructions to be numbered.
+        int64_t last_index = lyir_value_index_get(accumulator);
+        assert(last_index == instruction_count - 2);
+    }
+
+    assert(lyir_value_block_instruction_count_get(entry_block) == instruction_count);
+
+    double elapsed = bench_now() - start_time;
+
+    lyir_builder_destroy(builder);
+    lyir_module_destroy(module);
+    lyir_context_destroy(context);
+
+    return elapsed;
+}
+
+int main(int argc, char** argv) {
+    lca_temp_allocator_init(lca_default_allocator, 1024 * 1024);
+    lyir_init_targets(lca_default_allocator);
+
+    const int64_t instruction_counts[] = {1000, 10000, 25000, 50000, 100000};
+    const int64_t instruction_counts_count = (int64_t)(sizeof instruction_counts / sizeof *instruction_counts);
+
+    int exit_code = 0;
+
+    for (int mode = 0; mode < 2; mode++) {
+        bool insert_at_front = mode == 1;
+        double ns_per_instruction[sizeof instruction_counts / sizeof *instruction_counts] = {0};
+
+        printf("%s\n", insert_at_front ? "inserting at the front of the block:" : "appending to the block:");
+        printf("%12s %14s %18s\n", "instructions", "total (ms)", "per instr. (ns)");
+        for (int64_t i = 0; i < instruction_counts_count; i++) {
+            double elapsed = bench_build_function(instruction_counts[i], insert_at_front);
+            ns_per_instruction[i] = elapsed * 1e9 / (double)instruction_counts[i];
+            printf("%12lld %14.3f %18.1f\n", (long long)instruction_counts[i], elapsed * 1e3, ns_per_instruction[i]);
+        }
+
+        // the smallest size is mostly noise, so compare the largest against the 10k run.
+        // quadratic construction shows up as a 10x growth here, linear construction stays well under 4x.
+        double growth = ns_per_instruction[instruction_counts_count - 1] / ns_per_instruction[1];
+        printf("per-instruction growth from 10k to 100k instructions: %.2fx\n\n", growth);
+
+        if (growth > 4.0) {
+            fprintf(stderr, "IR construction does not scale linearly with function size.\n");
+            exit_code = 1;
+        }
+    }
+
+    lca_temp_allocator_clear();
+    return exit_code;
+}
@@ -0,0 +1,119 @@
+/*
+This software is available under 2 licenses -- choose whichever you prefer.
+------------------------------------------------------------------------------
+ALTERNATIVE A - MIT License
+Copyright (c) 2023 Local Atticus
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+of the Software, and to permit persons to whom the Software is furnished to do
+so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+------------------------------------------------------------------------------
+ALTERNATIVE B - Public Domain (www.unlicense.org)
+This is free and unencumbered software released into the public domain.
+Anyone is free to copy, modify, publish, use, compile, sell, or distribute this
+software, either in source code form or as a compiled binary, for any purpose,
+commercial or non-commercial, and by any means.
+In jurisdictions that recognize copyright laws, the author or authors of this
+software dedicate any and all copyright interest in the software to the public
+domain. We make this dedication for the benefit of the public at large and to
+the detriment of our heirs and successors. We intend this dedication to be an
+overt act of relinquishment in perpetuity of all present and future rights to
+this software under copyright law.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+// Checks that integer and float constants are uniqued per context, and measures creating
+// 1M constants drawn from 1k distinct values, the way irgen asks for the same few
+// constants over and over.
+//
+// Equal constants must be the same pointer, while constants differing in type, value or
+// float bit pattern (0.0 and -0.0) must not be.
+
+#include <assert.h>
+#include <stdio.h>
+
+#define LCA_IMPLEMENTATION
+#include "lyir.h"
+
+#include "bench.h"
+
+#define BENCH_CONSTANT_COUNT  1000000
+#define BENCH_DISTINCT_VALUES 1000
+
+static bool bench_check(bool condition, const char* message) {
+    if (!condition) {
+        fprintf(stderr, "%s\n", message);
+    }
+
+    return condition;
+}
+
+static bool bench_check_uniquing(lyir_context* context) {
+    lyir_type* i32_type = lyir_int_type(context, 32);
+    lyir_type* i64_type = lyir_int_type(context, 64);
+    lyir_type* f64_type = lyir_float_type(context, 64);
+
+    lyir_value* one = lyir_int_constant_create(context, (lyir_location){0}, i64_type, 1);
+    lyir_value* half = lyir_float_constant_create(context, (lyir_location){0}, f64_type, 0.5);
+    lyir_value* zero = lyir_float_constant_create(context, (lyir_location){0}, f64_type, 0.0);
+
+    bool ok = true;
+    ok &= bench_check(one == lyir_int_constant_create(context, (lyir_location){0}, i64_type, 1), "two equal integer constants are different values.");
+    ok &= bench_check(one != lyir_int_constant_create(context, (lyir_location){0}, i32_type, 1), "integer constants of different types are the same value.");
+    ok &= bench_check(one != lyir_int_constant_create(context, (lyir_location){0}, i64_type, 2), "different integer constants are the same value.");
+    ok &= bench_check(half == lyir_float_constant_create(context, (lyir_location){0}, f64_type, 0.5), "two equal float constants are different values.");
+    ok &= bench_check(zero != lyir_float_constant_create(context, (lyir_location){0}, f64_type, -0.0), "0.0 and -0.0 are the same value.");
+    return ok;
+}
+
+int main(void) {
+    lca_temp_allocator_init(lca_default_allocator, 1024 * 1024);
+    lyir_init_targets(lca_default_allocator);
+
+    lyir_context* context = lyir_context_create(lca_default_allocator);
+    assert(context != NULL);
+
+    int exit_code = bench_check_uniquing(context) ? 0 : 1;
+
+    lyir_type* i64_type = lyir_int_type(context, 64);
+    lyir_value* first_values[BENCH_DISTINCT_VALUES] = {0};
+
+    double start_time = bench_now();
+    for (int64_t i = 0; i < BENCH_CONSTANT_COUNT; i++) {
+        int64_t value = 1000 + i % BENCH_DISTINCT_VALUES;
+        lyir_value* constant = lyir_int_constant_create(context, (lyir_location){0}, i64_type, value);
+        if (i < BENCH_DISTINCT_VALUES) {
+            first_values[i] = constant;
+        } else if (constant != first_values[i % BENCH_DISTINCT_VALUES]) {
+            fprintf(stderr, "the constant %lld was created more than once.\n", (long long)value);
+            exit_code = 1;
+            break;
+        }
+    }
+    double elapsed = bench_now() - start_time;
+
+    printf("%d constants of %d distinct values:\n", BENCH_CONSTANT_COUNT, BENCH_DISTINCT_VALUES);
+    printf("  %-8s %10.3f ms\n", "create", elapsed * 1e3);
+    printf("  %-8s %10.1f ns per constant\n", "", elapsed * 1e9 / BENCH_CONSTANT_COUNT);
+
+    lyir_context_destroy(context);
+
+    lca_temp_allocator_clear();
+    return exit_code;
+}
@@ -0,0 +1,187 @@
+/*
+This software is available under 2 licenses -- choose whichever you prefer.
+------------------------------------------------------------------------------
+ALTERNATIVE A - MIT License
+Copyright (c) 2023 Local Atticus
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+of the Software, and to permit persons to whom the Software is furnished to do
+so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+------------------------------------------------------------------------------
+ALTERNATIVE B - Public Domain (www.unlicense.org)
+This is free and unencumbered software released into the public domain.
+Anyone is free to copy, modify, publish, use, compile, sell, or distribute this
+software, either in source code form or as a compiled binary, for any purpose,
+commercial or non-commercial, and by any means.
+In jurisdictions that recognize copyright laws, the author or authors of this
+software dedicate any and all copyright interest in the software to the public
+domain. We make this dedication for the benefit of the public at large and to
+the detriment of our heirs and successors. We intend this dedication to be an
+overt act of relinquishment in perpetuity of all present and future rights to
+this software under copyright law.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+// Measures how fast LLVM IR text is emitted for a large module, and compares writing
+// a typical instruction line through `lca_string_append_format` against writing it
+// with the direct `lca_string_append_*` functions the emitters use.
+
+#include <assert.h>
+#include <stdio.h>
+
+#define LCA_IMPLEMENTATION
+#include "lyir.h"
+
+#include "bench.h"
+
+static void bench_build_function(lyir_context* context, lyir_module* module, lyir_builder* builder, int64_t function_index, int64_t statement_count) {
+    lyir_type* i64_type = lyir_int_type(context, 64);
+    lyir_type* function_type = lyir_function_type(context, i64_type, NULL, LYIR_CCC, false);
+
+    lca_string_view name = lca_string_as_view(lca_string_format("bench_function_%lld", (long long)function_index));
+    lyir_value* function = lyir_module_create_function(module, (lyir_location){0}, name, function_type, NULL, LYIR_LINK_EXPORTED);
+
+    lyir_value* entry_block = lyir_value_function_block_append(function, LCA_SV_CONSTANT("entry"));
+    lyir_value* pass_block = lyir_value_function_block_append(function, LCA_SV_EMPTY);
+    lyir_value* fail_block = lyir_value_function_block_append(function, LCA_SV_EMPTY);
+
+    lyir_value* one = lyir_int_constant_create(context, (lyir_location){0}, i64_type, 1);
+    lyir_value* big = lyir_int_constant_create(context, (lyir_location){0}, i64_type, 1234567890123);
+
+    lyir_builder_position_at_end(builder, entry_block);
+    lyir_value* local = lyir_build_alloca(builder, (lyir_location){0}, i64_type, 1);
+    lyir_build_store(builder, (lyir_location){0}, local, one);
+
+    lyir_value* accumulator = lyir_build_load(builder, (lyir_location){0}, local, i64_type);
+    for (int64_t i = 0; i < statement_count; i++) {
+        accumulator = lyir_build_add(builder, (lyir_location){0}, accumulator, one);
+        accumulator = lyir_build_mul(builder, (lyir_location){0}, accumulator, big);
+        lyir_build_store(builder, (lyir_location){0}, local, accumulator);
+        accumulator = lyir_build_load(builder, (lyir_location){0}, local, i64_type);
+    }
+
+    lyir_value* condition = lyir_build_icmp_slt(builder, (lyir_location){0}, accumulator, big);
+    lyir_build_branch_conditional(builder, (lyir_location){0}, condition, pass_block, fail_block);
+
+    lyir_builder_position_at_end(builder, pass_block);
+    lyir_build_return(builder, (lyir_location){0}, accumulator);
+
+    lyir_builder_position_at_end(builder, fail_block);
+    lyir_build_return(builder, (lyir_location){0}, one);
+}
+
+static void bench_emit_module(void) {
+    const int64_t function_count = 200;
+    const int64_t statement_count = 250;
+    const int iterations = 10;
+
+    lyir_context* context = lyir_context_create(lca_default_allocator);
+    assert(context != NULL);
+
+    lyir_module* module = lyir_module_create(context, LCA_SV_CONSTANT("bench"));
+    assert(module != NULL);
+
+    lyir_builder* builder = lyir_builder_create(context);
+    for (int64_t i = 0; i < function_count; i++) {
+        bench_build_function(context, module, builder, i, statement_count);
+    }
+
+    int64_t instruction_count = function_count * (statement_count * 4 + 7);
+
+    // the first run numbers the instructions, which isn't what's being measured.
+    lca_string warmup = lyir_codegen_llvm(module);
+    int64_t output_size = warmup.count;
+    lca_string_destroy(&warmup);
+
+    double start_time = bench_now();
+    for (int i = 0; i < iterations; i++) {
+        lca_string output = lyir_codegen_llvm(module);
+        assert(output.count == output_size);
+        lca_string_destroy(&output);
+    }
+    double elapsed = (bench_now() - start_time) / iterations;
+
+    printf("LLVM emission, %lld functions, %lld instructions, %.2f MiB of text:\n", (long long)function_count, (long long)instruction_count, (double)output_size / (1024.0 * 1024.0));
+    printf("  %.3f ms per module, %.1f ns per instruction, %.1f MiB/s\n\n", elapsed * 1e3, elapsed * 1e9 / (double)instruction_count, (double)output_size / (1024.0 * 1024.0) / elapsed);
+
+    lyir_builder_destroy(builder);
+    lyir_module_destroy(module);
+    lyir_context_destroy(context);
+}
+
+static double bench_write_lines(int64_t line_count, bool use_format) {
+    lca_string output = lca_string_create(lca_default_allocator);
+    lca_string_view name = LCA_SV_CONSTANT("accumulator");
+
+    double start_time = bench_now();
+
+    // an instruction line the way the LLVM emitter writes it, piece by piece.
+    for (int64_t i = 0; i < line_count; i++) {
+        if (use_format) {
+            lca_string_append_format(&output, "  ");
+            lca_string_append_format(&output, "%%%lld", (long long)(i + 1));
+            lca_string_append_format(&output, " = ");
+            lca_string_append_format(&output, "add ");
+            lca_string_append_format(&output, "i%d", 64);
+            lca_string_append_format(&output, " ");
+            lca_string_append_format(&output, "%%%.*s", LCA_STR_EXPAND(name));
+            lca_string_append_format(&output, ", ");
+            lca_string_append_format(&output, "%lld", (long long)i * 7919);
+            lca_string_append_format(&output, "\n");
+        } else {
+            lca_string_append_cstring(&output, "  ");
+            lca_string_append_char(&output, '%');
+            lca_string_append_int(&output, i + 1);
+            lca_string_append_cstring(&output, " = ");
+            lca_string_append_cstring(&output, "add ");
+            lca_string_append_char(&output, 'i');
+            lca_string_append_int(&output, 64);
+            lca_string_append_char(&output, ' ');
+            lca_string_append_char(&output, '%');
+            lca_string_append_view(&output, name);
+            lca_string_append_cstring(&output, ", ");
+            lca_string_append_int(&output, i * 7919);
+            lca_string_append_char(&output, '\n');
+        }
+    }
+
+    double elapsed = bench_now() - start_time;
+
+    lca_string_destroy(&output);
+    return elapsed;
+}
+
+int main(int argc, char** argv) {
+    lca_temp_allocator_init(lca_default_allocator, 1024 * 1024);
+    lyir_init_targets(lca_default_allocator);
+
+    bench_emit_module();
+
+    const int64_t line_count = 1000000;
+    double format_elapsed = bench_write_lines(line_count, true);
+    double direct_elapsed = bench_write_lines(line_count, false);
+
+    printf("writing %lld instruction lines:\n", (long long)line_count);
+    printf("  %-28s %10.3f ms\n", "lca_string_append_format", format_elapsed * 1e3);
+    printf("  %-28s %10.3f ms\n", "lca_string_append_*", direct_elapsed * 1e3);
+    printf("  speedup: %.2fx\n", format_elapsed / direct_elapsed);
+
+    lca_temp_allocator_clear();
+    return 0;
+}
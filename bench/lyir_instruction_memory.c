@@ -0,0 +1,178 @@
+/*
+This software is available under 2 licenses -- choose whichever you prefer.
+------------------------------------------------------------------------------
+ALTERNATIVE A - MIT License
+Copyright (c) 2023 Local Atticus
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+of the Software, and to permit persons to whom the Software is furnished to do
+so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+------------------------------------------------------------------------------
+ALTERNATIVE B - Public Domain (www.unlicense.org)
+This is free and unencumbered software released into the public domain.
+Anyone is free to copy, modify, publish, use, compile, sell, or distribute this
+software, either in source code form or as a compiled binary, for any purpose,
+commercial or non-commercial, and by any means.
+In jurisdictions that recognize copyright laws, the author or authors of this
+software dedicate any and all copyright interest in the software to the public
+domain. We make this dedication for the benefit of the public at large and to
+the detriment of our heirs and successors. We intend this dedication to be an
+overt act of relinquishment in perpetuity of all present and future rights to
+this software under copyright law.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+// Reports how much heap memory building LYIR costs per instruction, using a mix of the
+// instructions which carry operand lists: calls with zero to three arguments, builtins and phis.
+// Every allocation made while building goes through a counting allocator, so the figure includes
+// the module's arena blocks as well as any operand lists which spilled out of their instruction.
+// The allocation count also includes the argument arrays handed to `lyir_build_call`, which the
+// call frees again once it has copied them.
+
+#include <assert.h>
+#include <stdio.h>
+
+#define LCA_IMPLEMENTATION
+#include "lyir.h"
+
+#include "bench.h"
+
+typedef struct bench_allocation_header {
+    int64_t size;
+    int64_t padding;
+} bench_allocation_header;
+
+static int64_t bench_live_bytes = 0;
+static int64_t bench_allocation_count = 0;
+
+static void* bench_counting_allocator_function(void* user_data, size_t count, void* ptr) {
+    bench_allocation_header* header = ptr == NULL ? NULL : ((bench_allocation_header*)ptr) - 1;
+    if (header != NULL) bench_live_bytes -= header->size;
+
+    if (count == 0) {
+        free(header);
+        return NULL;
+    }
+
+    if (header == NULL) {
+        header = calloc(1, sizeof *header + count);
+        bench_allocation_count++;
+    } else {
+        header = realloc(header, sizeof *header + count);
+    }
+
+    assert(header != NULL);
+    header->size = (int64_t)count;
+    bench_live_bytes += header->size;
+    return header + 1;
+}
+
+static void bench_build_operand_heavy_function(lyir_context* context, lyir_module* module, int64_t iteration_count, int64_t* instruction_count) {
+    lyir_type* i64_type = lyir_int_type(context, 64);
+    lyir_type* callee_type = lyir_function_type(context, i64_type, NULL, LYIR_CCC, true);
+    lyir_value* callee = lyir_module_create_function(module, (lyir_location){0}, LCA_SV_CONSTANT("callee"), callee_type, NULL, LYIR_LINK_IMPORTED);
+
+    lyir_type* function_type = lyir_function_type(context, i64_type, NULL, LYIR_CCC, false);
+    lyir_value* function = lyir_module_create_function(module, (lyir_location){0}, LCA_SV_CONSTANT("bench"), function_type, NULL, LYIR_LINK_EXPORTED);
+
+    lyir_builder* builder = lyir_builder_create(context);
+    lyir_value* block = lyir_value_function_block_append(function, LCA_SV_CONSTANT("entry"));
+    lyir_builder_position_at_end(builder, block);
+
+    lyir_value* zero = lyir_int_constant_create(context, (lyir_location){0}, i64_type, 0);
+    lyir_value* eight = lyir_int_constant_create(context, (lyir_location){0}, i64_type, 8);
+    lyir_value* accumulator = zero;
+
+    for (int64_t i = 0; i < iteration_count; i++) {
+        for (int64_t argument_count = 0; argument_count <= 3; argument_count++) {
+            lca_da(lyir_value*) arguments = NULL;
+            for (int64_t j = 0; j < argument_count; j++) {
+                lca_da_push(arguments, accumulator);
+            }
+
+            accumulator = lyir_build_call(builder, (lyir_location){0}, callee, callee_type, arguments, LCA_SV_EMPTY);
+        }
+
+        lyir_value* address = lyir_build_alloca(builder, (lyir_location){0}, i64_type, 1);
+        lyir_build_builtin_memset(builder, (lyir_location){0}, address, zero, eight);
+
+        lyir_value* next_block = lyir_value_function_block_append(function, LCA_SV_EMPTY);
+        lyir_build_branch(builder, (lyir_location){0}, next_block);
+
+        lyir_builder_position_at_end(builder, next_block);
+        lyir_value* phi = lyir_build_phi(builder, (lyir_location){0}, i64_type);
+        lyir_value_phi_incoming_value_add(phi, accumulator, block);
+        lyir_value_phi_incoming_value_add(phi, zero, block);
+
+        accumulator = phi;
+        block = next_block;
+    }
+
+    lyir_build_return(builder, (lyir_location){0}, accumulator);
+    lyir_builder_destroy(builder);
+
+    *instruction_count = 0;
+    for (int64_t i = 0, count = lyir_value_function_block_count_get(function); i < count; i++) {
+        *instruction_count += lyir_value_block_instruction_count_get(lyir_value_function_block_get_at_index(function, i));
+    }
+}
+
+int main(int argc, char** argv) {
+    lca_default_allocator = (lca_allocator){
+        .allocator_function = bench_counting_allocator_function,
+    };
+
+    lca_temp_allocator_init(lca_default_allocator, 1024 * 1024);
+    lyir_init_targets(lca_default_allocator);
+
+    lyir_context* context = lyir_context_create(lca_default_allocator);
+    assert(context != NULL);
+
+    // warm the context up first, so its one-off allocations aren't charged to the instructions.
+    lyir_module* warmup_module = lyir_module_create(context, LCA_SV_CONSTANT("warmup"));
+    int64_t warmup_instruction_count = 0;
+    bench_build_operand_heavy_function(context, warmup_module, 16, &warmup_instruction_count);
+    lyir_module_destroy(warmup_module);
+
+    const int64_t iteration_count = 50000;
+
+    int64_t live_bytes_before = bench_live_bytes;
+    int64_t allocation_count_before = bench_allocation_count;
+    double start_time = bench_now();
+
+    lyir_module* module = lyir_module_create(context, LCA_SV_CONSTANT("bench"));
+    int64_t instruction_count = 0;
+    bench_build_operand_heavy_function(context, module, iteration_count, &instruction_count);
+
+    double elapsed = bench_now() - start_time;
+    int64_t live_bytes = bench_live_bytes - live_bytes_before;
+    int64_t allocation_count = bench_allocation_count - allocation_count_before;
+
+    printf("instructions:                %lld\n", (long long)instruction_count);
+    printf("live heap bytes:             %lld\n", (long long)live_bytes);
+    printf("heap bytes per instruction:  %.1f\n", (double)live_bytes / (double)instruction_count);
+    printf("allocations per instruction: %.2f\n", (double)allocation_count / (double)instruction_count);
+    printf("build time:                  %.3f ms\n", elapsed * 1e3);
+
+    lyir_module_destroy(module);
+    lyir_context_destroy(context);
+
+    lca_temp_allocator_clear();
+    return 0;
+}
@@ -0,0 +1,126 @@
+/*
+This software is available under 2 licenses -- choose whichever you prefer.
+------------------------------------------------------------------------------
+ALTERNATIVE A - MIT License
+Copyright (c) 2023 Local Atticus
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+of the Software, and to permit persons to whom the Software is furnished to do
+so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+------------------------------------------------------------------------------
+ALTERNATIVE B - Public Domain (www.unlicense.org)
+This is free and unencumbered software released into the public domain.
+Anyone is free to copy, modify, publish, use, compile, sell, or distribute this
+software, either in source code form or as a compiled binary, for any purpose,
+commercial or non-commercial, and by any means.
+In jurisdictions that recognize copyright laws, the author or authors of this
+software dedicate any and all copyright interest in the software to the public
+domain. We make this dedication for the benefit of the public at large and to
+the detriment of our heirs and successors. We intend this dedication to be an
+overt act of relinquishment in perpetuity of all present and future rights to
+this software under copyright law.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+// Resolves locations spread across a generated 5 MB source file to lines and columns,
+// comparing the context's line index against scanning the text from the start of the
+// file for every location, which is how locations used to be resolved.
+
+#include <assert.h>
+#include <stdio.h>
+
+#define LCA_IMPLEMENTATION
+#include "lyir.h"
+
+#include "bench.h"
+
+// the previous implementation of `lyir_context_get_location_info`, kept for comparison.
+static void bench_scan_location(lca_string text, int64_t offset, int64_t* out_line, int64_t* out_column) {
+    int64_t last_line_start_offset = 0;
+    int64_t line_number = 1;
+
+    char lastc = 0;
+    for (int64_t i = 0; i <= offset; i++) {
+        if (lastc == '\n') {
+            last_line_start_offset = i;
+            line_number++;
+        }
+
+        lastc = text.data[i];
+    }
+
+    *out_line = line_number;
+    *out_column = 1 + (offset - last_line_start_offset);
+}
+
+int main(int argc, char** argv) {
+    lca_temp_allocator_init(lca_default_allocator, 1024 * 1024);
+    lyir_init_targets(lca_default_allocator);
+
+    lyir_context* context = lyir_context_create(lca_default_allocator);
+    assert(context != NULL);
+
+    // lines of varying length, so columns are not all the same.
+    lca_string text = lca_string_create(lca_default_allocator);
+    for (int64_t line = 0; text.count < 5 * 1024 * 1024; line++) {
+        lca_string_append_format(&text, "    int value_%lld = %lld;%*s\n", (long long)line, (long long)line * 7, (int)(line % 40), "");
+    }
+
+    int64_t text_count = text.count;
+    lyir_sourceid sourceid = lyir_context_get_or_add_source_from_string(context, lca_string_view_to_string(lca_default_allocator, LCA_SV_CONSTANT("bench.laye")), text);
+    lca_string source_text = lyir_context_get_source(context, sourceid).text;
+
+    // the first lookup builds the line index.
+    double start_time = bench_now();
+    int64_t line = 0, column = 0;
+    bool found = lyir_context_get_location_info(context, (lyir_location){.sourceid = sourceid, .offset = text_count - 1, .length = 1}, NULL, &line, &column);
+    assert(found);
+    double build_elapsed = bench_now() - start_time;
+
+    const int64_t indexed_location_count = 1000000;
+    start_time = bench_now();
+    for (int64_t i = 0; i < indexed_location_count; i++) {
+        lyir_location location = {.sourceid = sourceid, .offset = (i * 104729) % text_count, .length = 1};
+        found = lyir_context_get_location_info(context, location, NULL, &line, &column);
+        assert(found);
+    }
+    double indexed_elapsed = bench_now() - start_time;
+
+    // scanning is slow enough that it gets far fewer locations, which also double as a correctness check.
+    const int64_t scanned_location_count = 200;
+    start_time = bench_now();
+    for (int64_t i = 0; i < scanned_location_count; i++) {
+        int64_t offset = (i * 104729) % text_count;
+        bench_scan_location(source_text, offset, &line, &column);
+
+        int64_t indexed_line = 0, indexed_column = 0;
+        lyir_context_get_location_info(context, (lyir_location){.sourceid = sourceid, .offset = offset, .length = 1}, NULL, &indexed_line, &indexed_column);
+        assert(line == indexed_line && column == indexed_column);
+    }
+    double scan_elapsed = bench_now() - start_time;
+
+    printf("resolving locations in a %.1f MB source:\n", (double)text_count / (1024.0 * 1024.0));
+    printf("%-26s %12.3f ms\n", "building the line index:", build_elapsed * 1e3);
+    printf("%-26s %12.3f us/location\n", "scanning from the start:", scan_elapsed * 1e6 / (double)scanned_location_count);
+    printf("%-26s %12.3f us/location\n", "line index lookup:", indexed_elapsed * 1e6 / (double)indexed_location_count);
+
+    lyir_context_destroy(context);
+    lca_temp_allocator_clear();
+    return 0;
+}
@@ -0,0 +1,209 @@
+/*
+This software is available under 2 licenses -- choose whichever you prefer.
+------------------------------------------------------------------------------
+ALTERNATIVE A - MIT License
+Copyright (c) 2023 Local Atticus
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+of the Software, and to permit persons to whom the Software is furnished to do
+so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+------------------------------------------------------------------------------
+ALTERNATIVE B - Public Domain (www.unlicense.org)
+This is free and unencumbered software released into the public domain.
+Anyone is free to copy, modify, publish, use, compile, sell, or distribute this
+software, either in source code form or as a compiled binary, for any purpose,
+commercial or non-commercial, and by any means.
+In jurisdictions that recognize copyright laws, the author or authors of this
+software dedicate any and all copyright interest in the software to the public
+domain. We make this dedication for the benefit of the public at large and to
+the detriment of our heirs and successors. We intend this dedication to be an
+overt act of relinquishment in perpetuity of all present and future rights to
+this software under copyright law.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+// Loads a corpus of Laye modules and C headers by reading every file into an allocated buffer,
+// by mapping every file, and as LYIR sources through the context, which maps them when it can.
+// Each mode runs in its own process so that their resident set sizes can be compared.
+// Every byte of every source is visited after loading it, the way a lexer would.
+//
+// Mapped sources are clean file pages shared with the page cache, so they show up in RssFile
+// rather than RssAnon; only RssAnon is memory the compiler really owns.
+
+#include <assert.h>
+#include <ftw.h>
+#include <stdio.h>
+#include <sys/resource.h>
+
+#define LCA_IMPLEMENTATION
+#include "lyir.h"
+
+#include "bench.h"
+
+// the corpus is capped so the benchmark takes about the same time on every machine.
+#define BENCH_CORPUS_MAX_BYTES (64 * 1024 * 1024)
+
+static lca_da(char*) bench_corpus_files;
+static int64_t bench_corpus_bytes;
+
+static int bench_collect_file(const char* file_path, const struct stat* statbuf, int type_flag, struct FTW* ftw) {
+    if (type_flag != FTW_F || statbuf->st_size == 0) return 0;
+    if (bench_corpus_bytes >= BENCH_CORPUS_MAX_BYTES) return 1;
+
+    lca_string_view path = lca_string_view_from_cstring(file_path);
+    if (!lca_string_view_ends_with_cstring(path, ".laye") && !lca_string_view_ends_with_cstring(path, ".h")) return 0;
+
+    lca_da_push(bench_corpus_files, lca_string_view_to_cstring(lca_default_allocator, path));
+    bench_corpus_bytes += (int64_t)statbuf->st_size;
+    return 0;
+}
+
+typedef enum bench_load_mode {
+    BENCH_LOAD_READ,
+    BENCH_LOAD_MAP,
+    BENCH_LOAD_CONTEXT,
+} bench_load_mode;
+
+// reads a "<Field>: <n> kB" line from /proc/self/status, in MB.
+static double bench_proc_status_mb(const char* field) {
+    FILE* stream = fopen("/proc/self/status", "r");
+    if (stream == NULL) return 0;
+
+    char line[256];
+    size_t field_length = strlen(field);
+    double result = 0;
+
+    while (fgets(line, sizeof line, stream) != NULL) {
+        if (0 == strncmp(line, field, field_length) && line[field_length] == ':') {
+            result = (double)strtoll(line + field_length + 1, NULL, 10) / 1024.0;
+            break;
+        }
+    }
+
+    fclose(stream);
+    return result;
+}
+
+static void bench_load_corpus(bench_load_mode mode) {
+    struct rusage usage_before;
+    getrusage(RUSAGE_SELF, &usage_before);
+
+    lyir_context* context = lyir_context_create(lca_default_allocator);
+    assert(context != NULL);
+
+    lca_da(lca_string) read_texts = NULL;
+    lca_da(lca_string_view) mapped_texts = NULL;
+    int64_t checksum = 0;
+
+    double start_time = bench_now();
+    for (int64_t i = 0, count = lca_da_count(bench_corpus_files); i < count; i++) {
+        lca_string_view text = {0};
+        if (mode == BENCH_LOAD_CONTEXT) {
+            lyir_sourceid sourceid = lyir_context_get_or_add_source_from_file(context, lca_string_view_from_cstring(bench_corpus_files[i]));
+            assert(sourceid >= 0);
+            text = lca_string_as_view(lyir_context_get_source(context, sourceid).text);
+        } else if (mode == BENCH_LOAD_MAP && lca_file_map(bench_corpus_files[i], &text)) {
+            lca_da_push(mapped_texts, text);
+        } else {
+            lca_string read_text = lca_file_read(lca_default_allocator, bench_corpus_files[i]);
+            lca_da_push(read_texts, read_text);
+            text = lca_string_as_view(read_text);
+        }
+
+        // includes the NUL terminator, which the lexers rely on.
+        for (int64_t j = 0; j <= text.count; j++) {
+            checksum += text.data[j];
+        }
+    }
+    double elapsed = bench_now() - start_time;
+
+    int64_t mapped_count = lca_da_count(mapped_texts);
+    for (int64_t i = 0, count = lca_da_count(context->sources); i < count; i++) {
+        if (context->sources[i].is_text_mapped) mapped_count++;
+    }
+
+    struct rusage usage_after;
+    getrusage(RUSAGE_SELF, &usage_after);
+
+    const char* mode_names[] = {"lca_file_read:", "lca_file_map:", "lyir context:"};
+    printf(
+        "%-15s %8.1f ms %8.1f MB %8.1f MB %8.1f MB %7lld   %lld\n",
+        mode_names[mode],
+        elapsed * 1e3,
+        (double)(usage_after.ru_maxrss - usage_before.ru_maxrss) / 1024.0,
+        bench_proc_status_mb("RssAnon"),
+        bench_proc_status_mb("RssFile"),
+        (long long)mapped_count,
+        (long long)checksum
+    );
+
+    for (int64_t i = 0, count = lca_da_count(read_texts); i < count; i++) {
+        lca_string_destroy(&read_texts[i]);
+    }
+
+    for (int64_t i = 0, count = lca_da_count(mapped_texts); i < count; i++) {
+        lca_file_unmap(mapped_texts[i]);
+    }
+
+    lca_da_free(read_texts);
+    lca_da_free(mapped_texts);
+    lyir_context_destroy(context);
+}
+
+int main(int argc, char** argv) {
+    lca_temp_allocator_init(lca_default_allocator, 1024 * 1024);
+    lyir_init_targets(lca_default_allocator);
+
+    const char* corpus_directories[] = {"lib/laye", "/usr/include"};
+    for (size_t i = 0; i < sizeof corpus_directories / sizeof *corpus_directories; i++) {
+        if (lca_file_exists(corpus_directories[i])) {
+            nftw(corpus_directories[i], bench_collect_file, 16, FTW_PHYS);
+        }
+    }
+
+    printf("loading %lld files, %.1f MB:\n", (long long)lca_da_count(bench_corpus_files), (double)bench_corpus_bytes / (1024.0 * 1024.0));
+    printf("%-15s %11s %11s %11s %11s %7s   %s\n", "", "load", "peak RSS +", "RssAnon", "RssFile", "mapped", "checksum");
+    fflush(stdout);
+
+    for (int mode = BENCH_LOAD_READ; mode <= BENCH_LOAD_CONTEXT; mode++) {
+        pid_t pid = fork();
+        assert(pid >= 0);
+
+        if (pid == 0) {
+            bench_load_corpus((bench_load_mode)mode);
+            fflush(stdout);
+            _exit(0);
+        }
+
+        int status = 0;
+        waitpid(pid, &status, 0);
+        if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+            fprintf(stderr, "benchmark process failed.\n");
+            return 1;
+        }
+    }
+
+    for (int64_t i = 0, count = lca_da_count(bench_corpus_files); i < count; i++) {
+        lca_deallocate(lca_default_allocator, bench_corpus_files[i]);
+    }
+
+    lca_da_free(bench_corpus_files);
+    lca_temp_allocator_clear();
+    return 0;
+}
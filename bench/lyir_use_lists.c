@@ -0,0 +1,179 @@
+/*
+This software is available under 2 licenses -- choose whichever you prefer.
+------------------------------------------------------------------------------
+ALTERNATIVE A - MIT License
+Copyright (c) 2023 Local Atticus
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+of the Software, and to permit persons to whom the Software is furnished to do
+so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+------------------------------------------------------------------------------
+ALTERNATIVE B - Public Domain (www.unlicense.org)
+This is free and unencumbered software released into the public domain.
+Anyone is free to copy, modify, publish, use, compile, sell, or distribute this
+software, either in source code form or as a compiled binary, for any purpose,
+commercial or non-commercial, and by any means.
+In jurisdictions that recognize copyright laws, the author or authors of this
+software dedicate any and all copyright interest in the software to the public
+domain. We make this dedication for the benefit of the public at large and to
+the detriment of our heirs and successors. We intend this dedication to be an
+overt act of relinquishment in perpetuity of all present and future rights to
+this software under copyright law.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+// Measures rewriting uses and moving instructions in a built LYIR function, and checks the
+// results while doing so: one value with many uses is replaced everywhere, then a long run of
+// instructions is spliced into another block and back again. Both operations relink intrusive
+// lists, so the use counts and the instruction order are verified after every step.
+
+#include <assert.h>
+#include <stdio.h>
+
+#define LCA_IMPLEMENTATION
+#include "lyir.h"
+
+#include "bench.h"
+
+#define BENCH_USE_COUNT 100000
+
+static bool bench_check(bool condition, const char* message) {
+    if (!condition) fprintf(stderr, "%s\n", message);
+    return condition;
+}
+
+// checks that walking `block` from the front visits exactly `expected`, in order, and that
+// indices and the instruction count agree with that walk.
+static bool bench_block_matches(lyir_value* block, lyir_value** expected, int64_t expected_count) {
+    if (lyir_value_block_instruction_count_get(block) != expected_count) return false;
+
+    lyir_value* instruction = lyir_value_block_first_instruction_get(block);
+    lyir_value* previous = NULL;
+    for (int64_t i = 0; i < expected_count; i++) {
+        if (instruction != expected[i]) return false;
+        if (lyir_value_instruction_prev_get(instruction) != previous) return false;
+        if (lyir_value_block_instruction_get_at_index(block, i) != instruction) return false;
+        previous = instruction;
+        instruction = lyir_value_instruction_next_get(instruction);
+    }
+
+    return instruction == NULL && lyir_value_block_last_instruction_get(block) == previous;
+}
+
+int main(void) {
+    lca_temp_allocator_init(lca_default_allocator, 1024 * 1024);
+    lyir_init_targets(lca_default_allocator);
+
+    lyir_context* context = lyir_context_create(lca_default_allocator);
+    lyir_module* module = lyir_module_create(context, LCA_SV_CONSTANT("bench"));
+
+    lyir_type* i64_type = lyir_int_type(context, 64);
+    lyir_type* function_type = lyir_function_type(context, i64_type, NULL, LYIR_CCC, false);
+    lyir_value* function = lyir_module_create_function(module, (lyir_location){0}, LCA_SV_CONSTANT("bench"), function_type, NULL, LYIR_LINK_EXPORTED);
+    lyir_value* entry_block = lyir_value_function_block_append(function, LCA_SV_CONSTANT("entry"));
+    lyir_value* exit_block = lyir_value_function_block_append(function, LCA_SV_CONSTANT("exit"));
+
+    lyir_builder* builder = lyir_builder_create(context);
+    lyir_value* one = lyir_int_constant_create(context, (lyir_location){0}, i64_type, 1);
+
+    // entry: old, new, then BENCH_USE_COUNT adds which each use `old` once, then a branch.
+    lca_da(lyir_value*) entry_order = NULL;
+    lyir_builder_position_at_end(builder, entry_block);
+    lyir_value* old_value = lyir_build_add(builder, (lyir_location){0}, one, one);
+    lyir_value* new_value = lyir_build_add(builder, (lyir_location){0}, one, one);
+    lca_da_push(entry_order, old_value);
+    lca_da_push(entry_order, new_value);
+    for (int64_t i = 0; i < BENCH_USE_COUNT; i++) {
+        lca_da_push(entry_order, lyir_build_add(builder, (lyir_location){0}, old_value, one));
+    }
+
+    lyir_value* branch = lyir_build_branch(builder, (lyir_location){0}, exit_block);
+    lca_da_push(entry_order, branch);
+
+    lyir_builder_position_at_end(builder, exit_block);
+    lyir_value* exit_return = lyir_build_return(builder, (lyir_location){0}, new_value);
+
+    bool ok = true;
+    ok = ok && bench_check(lyir_value_user_count_get(old_value) == BENCH_USE_COUNT, "the built function does not have the expected uses.");
+    ok = ok && bench_check(lyir_value_user_count_get(new_value) == 1, "the built function does not have the expected uses.");
+
+    double rauw_start = bench_now();
+    lyir_value_replace_all_uses_with(old_value, new_value);
+    double rauw_time = bench_now() - rauw_start;
+
+    ok = ok && bench_check(lyir_value_user_count_get(old_value) == 0, "replace-all-uses left uses on the replaced value.");
+    ok = ok && bench_check(lyir_value_user_count_get(new_value) == BENCH_USE_COUNT + 1, "replace-all-uses did not move every use to the replacement.");
+    for (lyir_use* use = lyir_value_first_use_get(new_value); ok && use != NULL; use = lyir_use_next_get(use)) {
+        ok = bench_check(lyir_use_value_get(use) == new_value, "a moved use does not refer to the replacement.");
+    }
+
+    // move every add into the exit block, in front of its return.
+    lyir_value* first_moved = entry_order[2];
+    lyir_value* last_moved = entry_order[1 + BENCH_USE_COUNT];
+
+    double splice_start = bench_now();
+    lyir_value_block_splice(exit_block, exit_return, first_moved, last_moved);
+    double splice_time = bench_now() - splice_start;
+
+    lyir_value* entry_after_splice[] = {old_value, new_value, branch};
+    ok = ok && bench_check(bench_block_matches(entry_block, entry_after_splice, 3), "splicing out of a block left it in the wrong order.");
+
+    lca_da(lyir_value*) exit_order = NULL;
+    for (int64_t i = 0; i < BENCH_USE_COUNT; i++) {
+        lca_da_push(exit_order, entry_order[2 + i]);
+    }
+
+    lca_da_push(exit_order, exit_return);
+    ok = ok && bench_check(bench_block_matches(exit_block, exit_order, BENCH_USE_COUNT + 1), "splicing into a block left it in the wrong order.");
+    // values are numbered across the whole function, and the moved adds now follow old and new.
+    ok = ok && bench_check(lyir_value_index_get(exit_order[BENCH_USE_COUNT - 1]) == BENCH_USE_COUNT + 1, "instructions were not renumbered after a splice.");
+
+    // rotate within the block: the last add moves to the front.
+    lyir_value_block_splice(exit_block, exit_order[0], last_moved, last_moved);
+    for (int64_t i = BENCH_USE_COUNT - 1; i > 0; i--) {
+        exit_order[i] = exit_order[i - 1];
+    }
+
+    exit_order[0] = last_moved;
+    ok = ok && bench_check(bench_block_matches(exit_block, exit_order, BENCH_USE_COUNT + 1), "splicing within a block left it in the wrong order.");
+    ok = ok && bench_check(lyir_value_index_get(last_moved) == 2 && lyir_value_index_get(exit_order[1]) == 3, "instructions were not renumbered after a splice.");
+
+    // and move everything but the return back where it came from.
+    lyir_value_block_splice(entry_block, branch, exit_order[0], exit_order[BENCH_USE_COUNT - 1]);
+    lyir_value* exit_after_splice[] = {exit_return};
+    ok = ok && bench_check(bench_block_matches(exit_block, exit_after_splice, 1), "splicing a block empty left it in the wrong state.");
+    ok = ok && bench_check(lyir_value_block_instruction_count_get(entry_block) == BENCH_USE_COUNT + 3, "splicing back did not restore the instruction count.");
+    ok = ok && bench_check(lyir_value_user_count_get(new_value) == BENCH_USE_COUNT + 1, "splicing changed the uses of a value.");
+
+    if (ok) {
+        printf("%d uses of one value, %d instructions moved between blocks:\n", BENCH_USE_COUNT, BENCH_USE_COUNT);
+        printf("  %-24s %10.3f ms\n", "replace all uses", rauw_time * 1e3);
+        printf("  %-24s %10.3f ms\n", "splice between blocks", splice_time * 1e3);
+    }
+
+    lca_da_free(exit_order);
+    lca_da_free(entry_order);
+
+    lyir_builder_destroy(builder);
+    lyir_module_destroy(module);
+    lyir_context_destroy(context);
+
+    lca_temp_allocator_clear();
+    return ok ? 0 : 1;
+}
@@ -184,6 +184,8 @@ typedef struct c_translation_unit {
     lca_arena* arena;
 
     lca_da(c_macro_def*) macro_defs;
+    // the macro definition visible for each name, pointing into `macro_defs`.
+    lca_hashmap(lca_string_view, c_macro_def*) macro_defs_by_name;
 
     //lca_da(c_token) _all_tokens;
     c_token_buffer token_buffer;
@@ -77,6 +77,7 @@ void c_translation_unit_destroy(c_translation_unit* tu) {
 
     lca_arena_destroy(tu->arena);
     lca_da_free(tu->token_buffer.semantic_tokens);
+    lca_hashmap_free(tu->macro_defs_by_name);
 
     *tu = (c_translation_unit){0};
     lca_deallocate(allocator, tu);
@@ -546,13 +546,8 @@ finish_token:;
 }
 
 static c_macro_def* c_lexer_lookup_macro_def(c_lexer* lexer, lca_string_view macro_name) {
-    for (long long i = 0; i < lca_da_count(lexer->tu->macro_defs); i++) {
-        c_macro_def* def = lexer->tu->macro_defs[i];
-        if (lca_string_view_equals(macro_name, def->name))
-            return def;
-    }
-
-    return NULL;
+    __typeof__(lexer->tu->macro_defs_by_name) entry = lca_hashmap_find(lexer->tu->macro_defs_by_name, macro_name);
+    return entry == NULL ? NULL : entry->value;
 }
 
 static void c_lexer_handle_preprocessor_directive(c_lexer* lexer);
@@ -809,6 +804,10 @@ store_macro_in_translation_unit:;
 
     lca_da_push(lexer->tu->macro_defs, def);
 
+    // lookups have always found the first definition of a name, redefining it does not replace that (yet).
+    __typeof__(lexer->tu->macro_defs_by_name) entry = lca_hashmap_insert(lexer->tu->macro_defs_by_name, macro_name);
+    if (entry->value == NULL) entry->value = def;
+
     lexer->is_in_preprocessor = false;
     lexer->is_in_include = false;
 }
@@ -71,6 +71,7 @@ c_translation_unit* ccly_parse(c_context* context, lyir_sourceid sourceid) {
     tu->context = context;
     tu->sourceid = sourceid;
     tu->arena = lca_arena_create(context->allocator, 1024 * 1024);
+    lca_hashmap_init(tu->macro_defs_by_name, context->allocator, 64);
 
     tu->token_buffer = c_get_tokens(context, tu, sourceid);
 
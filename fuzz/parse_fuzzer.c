@@ -49,7 +49,8 @@ int LLVMFuzzerTestOneInput(const uint8_t* Data, size_t Size) {
 
 end_fuzz:;
     lyir_context_destroy(context);
-    lca_temp_allocator_clear();
+    // keep the temp arena's blocks around for the next input.
+    lca_temp_allocator_reset();
 
     return exit_code;
 }
@@ -110,11 +110,28 @@ typedef struct laye_aliased_node {
     laye_node* node;
 } laye_aliased_node;
 
+// most scopes only declare a handful of names, so the first few are stored inline in the scope.
+typedef lca_small_da(laye_aliased_node, 2) laye_aliased_node_list;
+
+// scopes and namespaces with more names than this also index them by name,
+// smaller ones are faster to search linearly.
+#define LAYE_NAME_INDEX_THRESHOLD 8
+
+// maps a name to the first declaration of that name in a scope.
+typedef lca_hashmap(lca_string_view, laye_node*) laye_declaration_index;
+
 typedef enum laye_symbol_kind {
     LAYE_SYMBOL_ENTITY,
     LAYE_SYMBOL_NAMESPACE,
 } laye_symbol_kind;
 
+typedef struct laye_symbol_include {
+    struct laye_symbol* symbol_namespace;
+    // how many symbols the including namespace held when this one was included,
+    // so walking every symbol can visit them in the order they were added.
+    int64_t position;
+} laye_symbol_include;
+
 typedef struct laye_symbol {
     laye_symbol_kind kind;
     lca_string_view name;
@@ -124,10 +141,40 @@ typedef struct laye_symbol {
         // if LAYE_SYMBOL_NAMESPACE, the symbols in this namespace
         lca_da(struct laye_symbol*) symbols;
     };
+    // if LAYE_SYMBOL_NAMESPACE and it holds more than LAYE_NAME_INDEX_THRESHOLD symbols,
+    // maps each name to the first symbol with that name.
+    // add symbols to a namespace with `laye_symbol_namespace_add` to keep this up to date.
+    lca_hashmap(lca_string_view, struct laye_symbol*) symbol_index;
+    // if LAYE_SYMBOL_NAMESPACE, other namespaces whose symbols are visible through this one without
+    // being copied into it, like the exports of a module which is imported. they are shared by every
+    // namespace which includes them, so they are never modified through this one.
+    // the symbols above shadow the included ones, which are searched in the order they were included.
+    lca_da(laye_symbol_include) included_namespaces;
 } laye_symbol;
 
 typedef struct laye_context laye_context;
 
+// identifies a pointer, buffer or reference type which sema derives from an element type.
+// the element is its canonical type when it has one, so `int` written in two places derives one type.
+// keys are compared by their bytes, so this is made of pointer-sized fields only and has no padding.
+typedef struct laye_derived_type_key {
+    int64_t kind;
+    laye_node* element_node;
+    int64_t is_element_modifiable;
+} laye_derived_type_key;
+
+// identifies a canonical type, shared by every structurally identical type node.
+// keys are compared by their bytes, so this is made of pointer-sized fields only and has no padding.
+typedef struct laye_canonical_type_key {
+    int64_t kind;
+    int64_t bit_width;
+    int64_t is_signed;
+    int64_t is_platform_specified;
+    // for pointer, buffer and reference types, the canonical type of the element.
+    laye_node* element_node;
+    int64_t is_element_modifiable;
+} laye_canonical_type_key;
+
 typedef struct laye_module {
     laye_context* context;
     lyir_sourceid sourceid;
@@ -149,6 +196,10 @@ typedef struct laye_module {
     laye_symbol* exports;
     laye_symbol* imports;
 
+    // the types sema has derived from other types for nodes in this module, like the pointer
+    // type of `&x`. each distinct derived type is created once and shared by every node using it.
+    lca_hashmap(laye_derived_type_key, laye_node*) derived_types;
+
     lca_da(laye_token) _all_tokens;
     lca_da(laye_node*) _all_nodes;
     lca_da(laye_scope*) _all_scopes;
@@ -167,9 +218,13 @@ struct laye_scope {
     bool is_function_scope;
     // "value"s declared in this scope.
     // here, "value" refers to non-type declarations like variables or functions.
-    lca_da(laye_aliased_node) value_declarations;
+    laye_aliased_node_list value_declarations;
     // types declared in this scope.
-    lca_da(laye_aliased_node) type_declarations;
+    laye_aliased_node_list type_declarations;
+    // once the scope declares more than LAYE_NAME_INDEX_THRESHOLD values or types,
+    // the declarations above are also indexed by name.
+    laye_declaration_index value_index;
+    laye_declaration_index type_index;
 };
 
 typedef struct laye_context {
@@ -210,7 +265,9 @@ typedef struct laye_context {
 
     lyir_dependency_graph* laye_dependencies;
 
-    lca_da(struct cached_struct_type { laye_node* node; lyir_type* type; }) _all_struct_types;
+    // the canonical type node of each distinct interned type, across all modules.
+    // see `laye_type_canonicalize`.
+    lca_hashmap(laye_canonical_type_key, laye_node*) canonical_types;
 } laye_context;
 
 typedef enum laye_mut_compare {
@@ -219,6 +276,19 @@ typedef enum laye_mut_compare {
     LAYE_MUT_CONVERTIBLE,
 } laye_mut_compare;
 
+typedef enum laye_eval_status {
+    // the expression was evaluated at compile time.
+    LAYE_EVAL_OK,
+    // the expression is not a compile-time constant.
+    LAYE_EVAL_NOT_CONSTANT,
+    // the expression is constant, but its value does not fit in its type.
+    LAYE_EVAL_OVERFLOW,
+    // the expression is constant, but divides by zero.
+    LAYE_EVAL_DIVIDE_BY_ZERO,
+    // the expression is constant, but shifts by a negative amount or by at least the width of its type.
+    LAYE_EVAL_SHIFT_OUT_OF_RANGE,
+} laye_eval_status;
+
 #define LAYE_TRIVIA_KINDS(X) \
     X(HASH_COMMENT)          \
     X(LINE_COMMENT)          \
@@ -665,6 +735,9 @@ struct laye_node {
     // the type of this expression.
     // will be void if this expression has no type.
     laye_type type;
+    // for type nodes, the node shared by every type structurally identical to this one, if it is interned.
+    // this node itself is left as written so diagnostics can still point at it.
+    laye_node* canonical_type;
 
     // the declared name of this declaration.
     // not all declarations have names, but enough of them do that this
@@ -1305,6 +1378,12 @@ struct laye_node {
 
             int cached_size;
             int cached_align;
+            // filled in by sema once the field list (including padding) is final,
+            // so member access never has to re-walk the preceding fields.
+            lca_da(int) cached_field_offsets;
+            lca_hashmap(lca_string_view, int64_t) cached_field_indices;
+            // the LYIR type generated for this struct, if irgen has seen it yet.
+            lyir_type* cached_lyir_type;
         } type_struct;
 
         struct {
@@ -1438,6 +1517,10 @@ void laye_module_destroy(laye_module* module);
 laye_symbol* laye_symbol_create(laye_module* module, laye_symbol_kind kind, lca_string_view name);
 void laye_symbol_destroy(laye_symbol* symbol);
 laye_symbol* laye_symbol_lookup(laye_symbol* symbol_namespace, lca_string_view name);
+// like `laye_symbol_lookup`, but ignores the namespaces included in this one.
+laye_symbol* laye_symbol_lookup_declared(laye_symbol* symbol_namespace, lca_string_view name);
+void laye_symbol_namespace_add(laye_symbol* symbol_namespace, laye_symbol* symbol);
+void laye_symbol_namespace_include(laye_symbol* symbol_namespace, laye_symbol* included_namespace);
 
 //
 
@@ -1485,6 +1568,7 @@ bool laye_decl_is_template(laye_node* decl);
 
 laye_type laye_expr_type(laye_node* expr);
 bool laye_expr_evaluate(laye_node* expr, lyir_evaluated_constant* out_constant, bool is_required);
+laye_eval_status laye_expr_evaluate_with_status(laye_node* expr, lyir_evaluated_constant* out_constant);
 bool laye_expr_is_lvalue(laye_node* expr);
 bool laye_expr_is_modifiable_lvalue(laye_node* expr);
 void laye_expr_set_lvalue(laye_node* expr, bool is_lvalue);
@@ -1523,6 +1607,7 @@ laye_type laye_type_qualify(laye_node* type_node, bool is_modifiable);
 laye_type laye_type_add_qualifiers(laye_type type, bool is_modifiable);
 laye_type laye_type_with_source(laye_node* type_node, laye_node* source_node, bool is_modifiable);
 
+void laye_type_struct_cache_layout(laye_type struct_type);
 int laye_type_struct_field_offset_bits(laye_type struct_type, int64_t field_index);
 int laye_type_struct_field_offset_bytes(laye_type struct_type, int64_t field_index);
 int64_t laye_type_struct_field_index_by_name(laye_type struct_type, lca_string_view field_name);
@@ -1531,6 +1616,7 @@ int64_t laye_type_struct_variant_index_by_name(laye_type struct_type, lca_string
 laye_type laye_type_strip_pointers_and_references(laye_type type);
 laye_type laye_type_strip_references(laye_type type);
 
+laye_node* laye_type_canonicalize(laye_node* type);
 bool laye_type_equals(laye_type a, laye_type b, laye_mut_compare mut_compare);
 
 void laye_type_print_to_string(laye_type type, lca_string* s, bool use_color);
@@ -119,6 +119,16 @@ laye_context* laye_context_create(lyir_context* lyir_context) {
     context->laye_types.i8_buffer->type_container.element_type = LTY(context->laye_types.i8);
     context->laye_types.i8_buffer->sema_state = LYIR_SEMA_DONE;
 
+    // the builtin types are the canonical types for anything written the same way in source.
+    laye_type_canonicalize(context->laye_types._void);
+    laye_type_canonicalize(context->laye_types.noreturn);
+    laye_type_canonicalize(context->laye_types._bool);
+    laye_type_canonicalize(context->laye_types.i8);
+    laye_type_canonicalize(context->laye_types._int);
+    laye_type_canonicalize(context->laye_types._uint);
+    laye_type_canonicalize(context->laye_types._float);
+    laye_type_canonicalize(context->laye_types.i8_buffer);
+
     context->laye_dependencies = lyir_dependency_graph_create_in_context(lyir_context);
     assert(context->laye_dependencies != NULL);
 
@@ -140,7 +150,7 @@ void laye_context_destroy(laye_context* context) {
     }
 
     lca_da_free(context->laye_modules);
-    lca_da_free(context->_all_struct_types);
+    lca_hashmap_free(context->canonical_types);
 
     lca_deallocate(allocator, context->laye_types.poison);
     lca_deallocate(allocator, context->laye_types.unknown);
@@ -56,9 +56,30 @@ laye_symbol* laye_symbol_create(laye_module* module, laye_symbol_kind kind, lca_
 }
 
 laye_symbol* laye_symbol_lookup(laye_symbol* symbol_namespace, lca_string_view name) {
+    laye_symbol* lookup = laye_symbol_lookup_declared(symbol_namespace, name);
+    if (lookup != NULL) {
+        return lookup;
+    }
+
+    for (int64_t i = 0, count = lca_da_count(symbol_namespace->included_namespaces); i < count; i++) {
+        lookup = laye_symbol_lookup(symbol_namespace->included_namespaces[i].symbol_namespace, name);
+        if (lookup != NULL) {
+            return lookup;
+        }
+    }
+
+    return NULL;
+}
+
+laye_symbol* laye_symbol_lookup_declared(laye_symbol* symbol_namespace, lca_string_view name) {
     assert(symbol_namespace != NULL);
     assert(symbol_namespace->kind == LAYE_SYMBOL_NAMESPACE);
 
+    if (symbol_namespace->symbol_index != NULL) {
+        __typeof__(symbol_namespace->symbol_index) entry = lca_hashmap_find(symbol_namespace->symbol_index, name);
+        return entry == NULL ? NULL : entry->value;
+    }
+
     for (int64_t i = 0, count = lca_da_count(symbol_namespace->symbols); i < count; i++) {
         laye_symbol* lookup = symbol_namespace->symbols[i];
         if (lca_string_view_equals(name, lookup->name)) {
@@ -69,6 +90,51 @@ laye_symbol* laye_symbol_lookup(laye_symbol* symbol_namespace, lca_string_view n
     return NULL;
 }
 
+void laye_symbol_namespace_add(laye_symbol* symbol_namespace, laye_symbol* symbol) {
+    assert(symbol_namespace != NULL);
+    assert(symbol_namespace->kind == LAYE_SYMBOL_NAMESPACE);
+    assert(symbol != NULL);
+
+    lca_da_push(symbol_namespace->symbols, symbol);
+
+    int64_t count = lca_da_count(symbol_namespace->symbols);
+    if (count <= LAYE_NAME_INDEX_THRESHOLD) {
+        return;
+    }
+
+    if (symbol_namespace->symbol_index == NULL) {
+        lca_hashmap_reserve(symbol_namespace->symbol_index, count);
+        for (int64_t i = 0; i < count; i++) {
+            laye_symbol* indexed_symbol = symbol_namespace->symbols[i];
+            // lookups find the first symbol with a name, so later ones never replace it.
+            if (!lca_hashmap_contains(symbol_namespace->symbol_index, indexed_symbol->name)) {
+                lca_hashmap_set(symbol_namespace->symbol_index, indexed_symbol->name, indexed_symbol);
+            }
+        }
+    } else if (!lca_hashmap_contains(symbol_namespace->symbol_index, symbol->name)) {
+        lca_hashmap_set(symbol_namespace->symbol_index, symbol->name, symbol);
+    }
+}
+
+void laye_symbol_namespace_include(laye_symbol* symbol_namespace, laye_symbol* included_namespace) {
+    assert(symbol_namespace != NULL);
+    assert(symbol_namespace->kind == LAYE_SYMBOL_NAMESPACE);
+    assert(included_namespace != NULL);
+    assert(included_namespace->kind == LAYE_SYMBOL_NAMESPACE);
+    assert(symbol_namespace != included_namespace);
+
+    for (int64_t i = 0, count = lca_da_count(symbol_namespace->included_namespaces); i < count; i++) {
+        if (symbol_namespace->included_namespaces[i].symbol_namespace == included_namespace) {
+            return;
+        }
+    }
+
+    lca_da_push(symbol_namespace->included_namespaces, ((laye_symbol_include){
+                                                           .symbol_namespace = included_namespace,
+                                                           .position = lca_da_count(symbol_namespace->symbols),
+                                                       }));
+}
+
 void laye_symbol_destroy(laye_symbol* symbol) {
     if (symbol == NULL) return;
 
@@ -76,6 +142,8 @@ void laye_symbol_destroy(laye_symbol* symbol) {
         lca_da_free(symbol->nodes);
     } else {
         lca_da_free(symbol->symbols);
+        lca_hashmap_free(symbol->symbol_index);
+        lca_da_free(symbol->included_namespaces);
     }
 }
 
@@ -116,6 +184,7 @@ void laye_module_destroy(laye_module* module) {
 
     lca_da_free(module->top_level_nodes);
     // lca_da_free(module->imports);
+    lca_hashmap_free(module->derived_types);
 
     lca_arena_destroy(module->arena);
 
@@ -143,8 +212,10 @@ laye_scope* laye_scope_create(laye_module* module, laye_scope* parent) {
 
 void laye_scope_destroy(laye_scope* scope) {
     if (scope == NULL) return;
-    lca_da_free(scope->type_declarations);
-    lca_da_free(scope->value_declarations);
+    lca_small_da_free(scope->type_declarations);
+    lca_small_da_free(scope->value_declarations);
+    lca_hashmap_free(scope->type_index);
+    lca_hashmap_free(scope->value_index);
     *scope = (laye_scope){0};
 }
 
@@ -152,6 +223,26 @@ void laye_scope_declare(laye_scope* scope, laye_node* declaration) {
     laye_scope_declare_aliased(scope, declaration, declaration->declared_name);
 }
 
+static laye_node* laye_scope_lookup_from(laye_aliased_node_list* declarations, laye_declaration_index index, lca_string_view name) {
+    assert(declarations != NULL);
+
+    if (index != NULL) {
+        __typeof__(index) entry = lca_hashmap_find(index, name);
+        return entry == NULL ? NULL : entry->value;
+    }
+
+    laye_aliased_node* entries = lca_small_da_data(*declarations);
+    for (int64_t i = 0, count = lca_small_da_count(*declarations); i < count; i++) {
+        laye_aliased_node entry = entries[i];
+        assert(entry.node != NULL);
+
+        if (lca_string_view_equals(entry.name, name))
+            return entry.node;
+    }
+
+    return NULL;
+}
+
 void laye_scope_declare_aliased(laye_scope* scope, laye_node* declaration, lca_string_view alias) {
     assert(scope != NULL);
     assert(declaration != NULL);
@@ -163,57 +254,55 @@ void laye_scope_declare_aliased(laye_scope* scope, laye_node* declaration, lca_s
     assert(module != NULL);
 
     bool is_type_declaration = declaration->kind == LAYE_NODE_DECL_STRUCT || declaration->kind == LAYE_NODE_DECL_ENUM || declaration->kind == LAYE_NODE_DECL_ALIAS || declaration->kind == LAYE_NODE_DECL_TEMPLATE_TYPE;
-    lca_da(laye_aliased_node)* entity_namespace = is_type_declaration ? &scope->type_declarations : &scope->value_declarations;
+    laye_aliased_node_list* entity_namespace = is_type_declaration ? &scope->type_declarations : &scope->value_declarations;
     assert(entity_namespace != NULL);
+    laye_declaration_index* entity_index = is_type_declaration ? &scope->type_index : &scope->value_index;
+    assert(entity_index != NULL);
 
-    if (!is_type_declaration) {
-        for (int64_t i = 0, count = lca_da_count(*entity_namespace); i < count; i++) {
-            laye_aliased_node entry = (*entity_namespace)[i];
-
-            lca_string_view existing_name = entry.name;
-            laye_node* existing_declaration = entry.node;
-            assert(existing_declaration != NULL);
-
-            if (
-                lca_string_view_equals(existing_name, alias) &&
-                (declaration->kind != LAYE_NODE_DECL_FUNCTION || existing_declaration->kind != LAYE_NODE_DECL_FUNCTION)
-            ) {
-                assert(module->context != NULL);
-                lyir_write_error(module->context->lyir_context, declaration->location, "redeclaration of '%.*s' in this scope.", LCA_STR_EXPAND(alias));
-                return;
-            }
-        }
-    }
-
-    lca_da_push(*entity_namespace, ((laye_aliased_node){
-                                       .name = alias,
-                                       .node = declaration,
-                                   }));
-}
+    laye_node* existing_declaration = laye_scope_lookup_from(entity_namespace, *entity_index, alias);
 
-static laye_node* laye_scope_lookup_from(laye_scope* scope, lca_da(laye_aliased_node) declarations, lca_string_view name) {
-    assert(scope != NULL);
-    assert(scope->module != NULL);
+    // only functions can share a name, so if the first declaration with this name is a function then all of them are.
+    if (
+        !is_type_declaration && existing_declaration != NULL &&
+        (declaration->kind != LAYE_NODE_DECL_FUNCTION || existing_declaration->kind != LAYE_NODE_DECL_FUNCTION)
+    ) {
+        assert(module->context != NULL);
+        lyir_write_error(module->context->lyir_context, declaration->location, "redeclaration of '%.*s' in this scope.", LCA_STR_EXPAND(alias));
+        return;
+    }
 
-    for (int64_t i = 0, count = lca_da_count(declarations); i < count; i++) {
-        laye_aliased_node entry = declarations[i];
-        assert(entry.node != NULL);
+    lca_small_da_push(*entity_namespace, ((laye_aliased_node){
+                                             .name = alias,
+                                             .node = declaration,
+                                         }));
 
-        if (lca_string_view_equals(entry.name, name))
-            return entry.node;
+    int64_t count = lca_small_da_count(*entity_namespace);
+    if (count <= LAYE_NAME_INDEX_THRESHOLD) {
+        return;
     }
 
-    return NULL;
+    if (*entity_index == NULL) {
+        lca_hashmap_reserve(*entity_index, count);
+        laye_aliased_node* entries = lca_small_da_data(*entity_namespace);
+        for (int64_t i = 0; i < count; i++) {
+            // lookups find the first declaration of a name, so later ones never replace it.
+            if (!lca_hashmap_contains(*entity_index, entries[i].name)) {
+                lca_hashmap_set(*entity_index, entries[i].name, entries[i].node);
+            }
+        }
+    } else if (existing_declaration == NULL) {
+        lca_hashmap_set(*entity_index, alias, declaration);
+    }
 }
 
 laye_node* laye_scope_lookup_value(laye_scope* scope, lca_string_view value_name) {
     assert(scope != NULL);
-    return laye_scope_lookup_from(scope, scope->value_declarations, value_name);
+    return laye_scope_lookup_from(&scope->value_declarations, scope->value_index, value_name);
 }
 
 laye_node* laye_scope_lookup_type(laye_scope* scope, lca_string_view type_name) {
     assert(scope != NULL);
-    return laye_scope_lookup_from(scope, scope->type_declarations, type_name);
+    return laye_scope_lookup_from(&scope->type_declarations, scope->type_index, type_name);
 }
 
 laye_node* laye_node_create(laye_module* module, laye_node_kind kind, lyir_location location, laye_type type) {
@@ -336,6 +425,8 @@ void laye_node_destroy(laye_node* node) {
         case LAYE_NODE_TYPE_STRUCT: {
             lca_da_free(node->type_struct.fields);
             lca_da_free(node->type_struct.variants);
+            lca_da_free(node->type_struct.cached_field_offsets);
+            lca_hashmap_free(node->type_struct.cached_field_indices);
         } break;
 
         case LAYE_NODE_TYPE_ENUM: {
@@ -396,8 +487,421 @@ bool laye_expr_evaluate(laye_node* expr, lyir_evaluated_constant* out_constant,
     assert(out_constant != NULL);
     assert(!is_required || laye_node_is_sema_ok(expr) && "cannot evaluate ill-formed or unchecked expression");
 
+    return laye_expr_evaluate_with_status(expr, out_constant) == LAYE_EVAL_OK;
+}
+
+// integer constants are stored as their mathematical value, sign extended to 64 bits.
+// unsigned 64-bit values above INT64_MAX keep their two's complement bit pattern instead.
+static bool laye_eval_int_fits(laye_type type, int64_t value) {
+    int bit_width = type.node->type_primitive.bit_width;
+    if (bit_width >= 64) {
+        return true;
+    }
+
+    if (type.node->type_primitive.is_signed) {
+        int64_t min_value = -((int64_t)1 << (bit_width - 1));
+        int64_t max_value = ((int64_t)1 << (bit_width - 1)) - 1;
+        return value >= min_value && value <= max_value;
+    }
+
+    return value >= 0 && value <= (int64_t)(((uint64_t)1 << bit_width) - 1);
+}
+
+// truncates `value` to the width of `type`, then sign or zero extends it back to 64 bits,
+// which is what a runtime truncate/extend pair would produce.
+static int64_t laye_eval_int_wrap(laye_type type, int64_t value) {
+    int bit_width = type.node->type_primitive.bit_width;
+    if (bit_width >= 64) {
+        return value;
+    }
+
+    uint64_t mask = ((uint64_t)1 << bit_width) - 1;
+    uint64_t bits = (uint64_t)value & mask;
+    if (type.node->type_primitive.is_signed && (bits >> (bit_width - 1)) != 0) {
+        bits |= ~mask;
+    }
+
+    return (int64_t)bits;
+}
+
+static bool laye_eval_int_is_wide_unsigned(laye_type type) {
+    return !type.node->type_primitive.is_signed && type.node->type_primitive.bit_width >= 64;
+}
+
+// integer constants are evaluated in 64 bits, so anything wider is left to the generated code.
+static bool laye_eval_int_is_too_wide(laye_type type) {
+    return laye_type_is_int(type) && type.node->type_primitive.bit_width > 64;
+}
+
+// kept free of <math.h>, since nothing else in the compiler links against the math library.
+static bool laye_eval_float_is_finite(double value) {
+    return value == value && value - value == 0;
+}
+
+static laye_eval_status laye_eval_float_result(laye_type type, double operand_magnitude, double value, lyir_evaluated_constant* out_constant) {
+    if (type.node->type_primitive.bit_width <= 32) {
+        value = (double)(float)value;
+    }
+
+    if (!laye_eval_float_is_finite(value) && laye_eval_float_is_finite(operand_magnitude)) {
+        return LAYE_EVAL_OVERFLOW;
+    }
+
+    out_constant->kind = LYIR_EVAL_FLOAT;
+    out_constant->float_value = value;
+    return LAYE_EVAL_OK;
+}
+
+// sema folds constant unary, binary and explicit cast expressions as soon as they are analysed,
+// so one that is still there afterwards is known not to be constant and its operands need no visit.
+static laye_eval_status laye_eval_operand(laye_node* operand, lyir_evaluated_constant* out_constant) {
+    bool is_folded_kind =
+        operand->kind == LAYE_NODE_UNARY ||
+        operand->kind == LAYE_NODE_BINARY ||
+        (operand->kind == LAYE_NODE_CAST && (operand->cast.kind == LAYE_CAST_SOFT || operand->cast.kind == LAYE_CAST_HARD));
+    if (is_folded_kind && operand->sema_state == LYIR_SEMA_DONE) {
+        return LAYE_EVAL_NOT_CONSTANT;
+    }
+
+    return laye_expr_evaluate_with_status(operand, out_constant);
+}
+
+static laye_eval_status laye_eval_unary(laye_node* expr, lyir_evaluated_constant* out_constant) {
+    if (expr->unary.operator.kind == '&' || expr->unary.operator.kind == '*' || laye_eval_int_is_too_wide(expr->type)) {
+        return LAYE_EVAL_NOT_CONSTANT;
+    }
+
+    lyir_evaluated_constant operand = {0};
+    laye_eval_status status = laye_eval_operand(expr->unary.operand, &operand);
+    if (status != LAYE_EVAL_OK) {
+        return status;
+    }
+
+    laye_type type = expr->type;
+    switch (expr->unary.operator.kind) {
+        default: return LAYE_EVAL_NOT_CONSTANT;
+
+        case '+': {
+            if (operand.kind != LYIR_EVAL_INT && operand.kind != LYIR_EVAL_FLOAT) {
+                return LAYE_EVAL_NOT_CONSTANT;
+            }
+
+            *out_constant = operand;
+            return LAYE_EVAL_OK;
+        }
+
+        case '-': {
+            if (operand.kind == LYIR_EVAL_FLOAT && laye_type_is_float(type)) {
+                return laye_eval_float_result(type, operand.float_value, -operand.float_value, out_constant);
+            }
+
+            if (operand.kind != LYIR_EVAL_INT || !laye_type_is_int(type)) {
+                return LAYE_EVAL_NOT_CONSTANT;
+            }
+
+            // unsigned negation wraps, like the emitted `sub 0, x` does.
+            int64_t result = 0;
+            if (!type.node->type_primitive.is_signed) {
+                result = laye_eval_int_wrap(type, (int64_t)(0 - (uint64_t)operand.int_value));
+            } else if (__builtin_sub_overflow((int64_t)0, operand.int_value, &result) || !laye_eval_int_fits(type, result)) {
+                return LAYE_EVAL_OVERFLOW;
+            }
+
+            out_constant->kind = LYIR_EVAL_INT;
+            out_constant->int_value = result;
+            return LAYE_EVAL_OK;
+        }
+
+        case '~': {
+            if (operand.kind != LYIR_EVAL_INT || !laye_type_is_int(type)) {
+                return LAYE_EVAL_NOT_CONSTANT;
+            }
+
+            out_constant->kind = LYIR_EVAL_INT;
+            out_constant->int_value = laye_eval_int_wrap(type, ~operand.int_value);
+            return LAYE_EVAL_OK;
+        }
+
+        case LAYE_TOKEN_NOT: {
+            if (operand.kind != LYIR_EVAL_BOOL) {
+                return LAYE_EVAL_NOT_CONSTANT;
+            }
+
+            out_constant->kind = LYIR_EVAL_BOOL;
+            out_constant->bool_value = !operand.bool_value;
+            return LAYE_EVAL_OK;
+        }
+    }
+}
+
+static laye_eval_status laye_eval_binary_int(laye_token_kind operator_kind, laye_type type, int64_t lhs, int64_t rhs, lyir_evaluated_constant* out_constant) {
+    bool is_signed = type.node->type_primitive.is_signed;
+    bool is_wide_unsigned = laye_eval_int_is_wide_unsigned(type);
+    int bit_width = type.node->type_primitive.bit_width;
+
+    uint64_t ulhs = (uint64_t)lhs;
+    uint64_t urhs = (uint64_t)rhs;
+
+    int64_t result = 0;
+    bool overflowed = false;
+
+    switch (operator_kind) {
+        default: return LAYE_EVAL_NOT_CONSTANT;
+
+        case LAYE_TOKEN_PLUS:
+        case LAYE_TOKEN_MINUS:
+        case LAYE_TOKEN_STAR: {
+            // unsigned arithmetic wraps at the width of the type; only signed overflow is an error.
+            if (!is_signed) {
+                uint64_t uresult = 0;
+                if (operator_kind == LAYE_TOKEN_PLUS) uresult = ulhs + urhs;
+                else if (operator_kind == LAYE_TOKEN_MINUS) uresult = ulhs - urhs;
+                else uresult = ulhs * urhs;
+                result = laye_eval_int_wrap(type, (int64_t)uresult);
+            } else {
+                if (operator_kind == LAYE_TOKEN_PLUS) overflowed = __builtin_add_overflow(lhs, rhs, &result);
+                else if (operator_kind == LAYE_TOKEN_MINUS) overflowed = __builtin_sub_overflow(lhs, rhs, &result);
+                else overflowed = __builtin_mul_overflow(lhs, rhs, &result);
+                overflowed = overflowed || !laye_eval_int_fits(type, result);
+            }
+        } break;
+
+        case LAYE_TOKEN_SLASH:
+        case LAYE_TOKEN_PERCENT: {
+            if (rhs == 0) {
+                return LAYE_EVAL_DIVIDE_BY_ZERO;
+            }
+
+            bool is_divide = operator_kind == LAYE_TOKEN_SLASH;
+            if (is_wide_unsigned) {
+                result = (int64_t)(is_divide ? ulhs / urhs : ulhs % urhs);
+            } else if (lhs == INT64_MIN && rhs == -1) {
+                overflowed = is_divide;
+                result = 0;
+            } else {
+                result = is_divide ? lhs / rhs : lhs % rhs;
+                overflowed = !laye_eval_int_fits(type, result);
+            }
+        } break;
+
+        case LAYE_TOKEN_AMPERSAND: result = laye_eval_int_wrap(type, lhs & rhs); break;
+        case LAYE_TOKEN_PIPE: result = laye_eval_int_wrap(type, lhs | rhs); break;
+        case LAYE_TOKEN_TILDE: result = laye_eval_int_wrap(type, lhs ^ rhs); break;
+
+        case LAYE_TOKEN_LESSLESS:
+        case LAYE_TOKEN_GREATERGREATER: {
+            if ((is_signed && rhs < 0) || urhs >= (uint64_t)bit_width) {
+                return LAYE_EVAL_SHIFT_OUT_OF_RANGE;
+            }
+
+            // bits shifted out of a left shift are dropped, signed or not, as they are at runtime.
+            if (operator_kind == LAYE_TOKEN_GREATERGREATER) {
+                result = is_signed ? lhs >> rhs : (int64_t)(ulhs >> rhs);
+            } else {
+                result = laye_eval_int_wrap(type, (int64_t)(ulhs << rhs));
+            }
+        } break;
+
+        case LAYE_TOKEN_EQUALEQUAL:
+        case LAYE_TOKEN_BANGEQUAL:
+        case LAYE_TOKEN_LESS:
+        case LAYE_TOKEN_LESSEQUAL:
+        case LAYE_TOKEN_GREATER:
+        case LAYE_TOKEN_GREATEREQUAL: {
+            int compare = 0;
+            if (is_signed) compare = lhs < rhs ? -1 : (lhs > rhs ? 1 : 0);
+            else compare = ulhs < urhs ? -1 : (ulhs > urhs ? 1 : 0);
+
+            out_constant->kind = LYIR_EVAL_BOOL;
+            switch (operator_kind) {
+                default: assert(false && "unreachable"); break;
+                case LAYE_TOKEN_EQUALEQUAL: out_constant->bool_value = compare == 0; break;
+                case LAYE_TOKEN_BANGEQUAL: out_constant->bool_value = compare != 0; break;
+                case LAYE_TOKEN_LESS: out_constant->bool_value = compare < 0; break;
+                case LAYE_TOKEN_LESSEQUAL: out_constant->bool_value = compare <= 0; break;
+                case LAYE_TOKEN_GREATER: out_constant->bool_value = compare > 0; break;
+                case LAYE_TOKEN_GREATEREQUAL: out_constant->bool_value = compare >= 0; break;
+            }
+
+            return LAYE_EVAL_OK;
+        }
+    }
+
+    if (overflowed) {
+        return LAYE_EVAL_OVERFLOW;
+    }
+
+    out_constant->kind = LYIR_EVAL_INT;
+    out_constant->int_value = result;
+    return LAYE_EVAL_OK;
+}
+
+static laye_eval_status laye_eval_binary_float(laye_token_kind operator_kind, laye_type type, double lhs, double rhs, lyir_evaluated_constant* out_constant) {
+    double operand_magnitude = (lhs < 0 ? -lhs : lhs) + (rhs < 0 ? -rhs : rhs);
+
+    switch (operator_kind) {
+        default: return LAYE_EVAL_NOT_CONSTANT;
+
+        case LAYE_TOKEN_PLUS: return laye_eval_float_result(type, operand_magnitude, lhs + rhs, out_constant);
+        case LAYE_TOKEN_MINUS: return laye_eval_float_result(type, operand_magnitude, lhs - rhs, out_constant);
+        case LAYE_TOKEN_STAR: return laye_eval_float_result(type, operand_magnitude, lhs * rhs, out_constant);
+
+        case LAYE_TOKEN_SLASH: {
+            if (rhs == 0) {
+                return LAYE_EVAL_DIVIDE_BY_ZERO;
+            }
+
+            return laye_eval_float_result(type, operand_magnitude, lhs / rhs, out_constant);
+        }
+
+        case LAYE_TOKEN_EQUALEQUAL: out_constant->bool_value = lhs == rhs; break;
+        case LAYE_TOKEN_BANGEQUAL: out_constant->bool_value = lhs != rhs; break;
+        case LAYE_TOKEN_LESS: out_constant->bool_value = lhs < rhs; break;
+        case LAYE_TOKEN_LESSEQUAL: out_constant->bool_value = lhs <= rhs; break;
+        case LAYE_TOKEN_GREATER: out_constant->bool_value = lhs > rhs; break;
+        case LAYE_TOKEN_GREATEREQUAL: out_constant->bool_value = lhs >= rhs; break;
+    }
+
+    out_constant->kind = LYIR_EVAL_BOOL;
+    return LAYE_EVAL_OK;
+}
+
+static laye_eval_status laye_eval_binary(laye_node* expr, lyir_evaluated_constant* out_constant) {
+    lyir_evaluated_constant lhs = {0};
+    laye_eval_status status = laye_eval_operand(expr->binary.lhs, &lhs);
+    if (status != LAYE_EVAL_OK) {
+        return status;
+    }
+
+    lyir_evaluated_constant rhs = {0};
+    status = laye_eval_operand(expr->binary.rhs, &rhs);
+    if (status != LAYE_EVAL_OK) {
+        return status;
+    }
+
+    if (lhs.kind != rhs.kind) {
+        return LAYE_EVAL_NOT_CONSTANT;
+    }
+
+    laye_token_kind operator_kind = expr->binary.operator.kind;
+    // comparisons produce a bool, so the operand type decides how the operation is performed.
+    laye_type operand_type = expr->binary.lhs->type;
+    if (laye_eval_int_is_too_wide(operand_type) || laye_eval_int_is_too_wide(expr->type)) {
+        return LAYE_EVAL_NOT_CONSTANT;
+    }
+
+    if (lhs.kind == LYIR_EVAL_INT && laye_type_is_int(operand_type)) {
+        return laye_eval_binary_int(operator_kind, operand_type, lhs.int_value, rhs.int_value, out_constant);
+    }
+
+    if (lhs.kind == LYIR_EVAL_FLOAT && laye_type_is_float(operand_type)) {
+        return laye_eval_binary_float(operator_kind, operand_type, lhs.float_value, rhs.float_value, out_constant);
+    }
+
+    if (lhs.kind == LYIR_EVAL_BOOL) {
+        out_constant->kind = LYIR_EVAL_BOOL;
+        switch (operator_kind) {
+            default: return LAYE_EVAL_NOT_CONSTANT;
+            case LAYE_TOKEN_AND: out_constant->bool_value = lhs.bool_value && rhs.bool_value; break;
+            case LAYE_TOKEN_OR: out_constant->bool_value = lhs.bool_value || rhs.bool_value; break;
+            case LAYE_TOKEN_XOR: out_constant->bool_value = lhs.bool_value != rhs.bool_value; break;
+            case LAYE_TOKEN_EQUALEQUAL: out_constant->bool_value = lhs.bool_value == rhs.bool_value; break;
+            case LAYE_TOKEN_BANGEQUAL: out_constant->bool_value = lhs.bool_value != rhs.bool_value; break;
+        }
+
+        return LAYE_EVAL_OK;
+    }
+
+    if (lhs.kind == LYIR_EVAL_NULL && (operator_kind == LAYE_TOKEN_EQUALEQUAL || operator_kind == LAYE_TOKEN_BANGEQUAL)) {
+        out_constant->kind = LYIR_EVAL_BOOL;
+        out_constant->bool_value = operator_kind == LAYE_TOKEN_EQUALEQUAL;
+        return LAYE_EVAL_OK;
+    }
+
+    return LAYE_EVAL_NOT_CONSTANT;
+}
+
+static laye_eval_status laye_eval_cast(laye_node* expr, lyir_evaluated_constant* out_constant) {
+    if (expr->cast.kind != LAYE_CAST_IMPLICIT && expr->cast.kind != LAYE_CAST_SOFT && expr->cast.kind != LAYE_CAST_HARD) {
+        return LAYE_EVAL_NOT_CONSTANT;
+    }
+
+    lyir_evaluated_constant operand = {0};
+    laye_eval_status status = laye_eval_operand(expr->cast.operand, &operand);
+    if (status != LAYE_EVAL_OK) {
+        return status;
+    }
+
+    laye_type from = expr->cast.operand->type;
+    laye_type to = expr->type;
+    if (laye_eval_int_is_too_wide(from) || laye_eval_int_is_too_wide(to)) {
+        return LAYE_EVAL_NOT_CONSTANT;
+    }
+
+    if (laye_type_is_int(to)) {
+        int64_t value = 0;
+        if (operand.kind == LYIR_EVAL_INT) {
+            value = operand.int_value;
+        } else if (operand.kind == LYIR_EVAL_BOOL) {
+            value = operand.bool_value ? 1 : 0;
+        } else if (operand.kind == LYIR_EVAL_FLOAT) {
+            // a float that does not survive the trip to the target type has no defined value.
+            double float_value = operand.float_value;
+            if (!(float_value > -0x1p63 - 1 && float_value < 0x1p63) || !laye_eval_int_fits(to, (int64_t)float_value)) {
+                return LAYE_EVAL_OVERFLOW;
+            }
+
+            value = (int64_t)float_value;
+        } else {
+            return LAYE_EVAL_NOT_CONSTANT;
+        }
+
+        out_constant->kind = LYIR_EVAL_INT;
+        out_constant->int_value = laye_eval_int_wrap(to, value);
+        return LAYE_EVAL_OK;
+    }
+
+    if (laye_type_is_float(to)) {
+        double value = 0;
+        if (operand.kind == LYIR_EVAL_FLOAT) {
+            value = operand.float_value;
+        } else if (operand.kind == LYIR_EVAL_INT && laye_type_is_int(from)) {
+            value = laye_eval_int_is_wide_unsigned(from) ? (double)(uint64_t)operand.int_value : (double)operand.int_value;
+        } else {
+            return LAYE_EVAL_NOT_CONSTANT;
+        }
+
+        return laye_eval_float_result(to, value, value, out_constant);
+    }
+
+    if (laye_type_is_bool(to) && operand.kind == LYIR_EVAL_BOOL) {
+        *out_constant = operand;
+        return LAYE_EVAL_OK;
+    }
+
+    if ((laye_type_is_pointer(to) || laye_type_is_buffer(to)) && operand.kind == LYIR_EVAL_NULL) {
+        *out_constant = operand;
+        return LAYE_EVAL_OK;
+    }
+
+    return LAYE_EVAL_NOT_CONSTANT;
+}
+
+laye_eval_status laye_expr_evaluate_with_status(laye_node* expr, lyir_evaluated_constant* out_constant) {
+    assert(expr != NULL);
+    assert(out_constant != NULL);
+
+    if (laye_node_is_type(expr) || expr->type.node == NULL || laye_node_is_dependent(expr)) {
+        return LAYE_EVAL_NOT_CONSTANT;
+    }
+
     switch (expr->kind) {
-        default: return false;
+        default: return LAYE_EVAL_NOT_CONSTANT;
+
+        case LAYE_NODE_EVALUATED_CONSTANT: {
+            *out_constant = expr->evaluated_constant.result;
+            return LAYE_EVAL_OK;
+        }
 
         case LAYE_NODE_SIZEOF: {
             int size_in_bytes = 0;
@@ -412,33 +916,64 @@ bool laye_expr_evaluate(laye_node* expr, lyir_evaluated_constant* out_constant,
 
             out_constant->kind = LYIR_EVAL_INT;
             out_constant->int_value = (int64_t)size_in_bytes;
-            return true;
+            return LAYE_EVAL_OK;
+        }
+
+        case LAYE_NODE_ALIGNOF: {
+            int align_in_bytes = 0;
+
+            laye_node* query = expr->_alignof_.query;
+            if (laye_node_is_type(query)) {
+                align_in_bytes = laye_type_align_in_bytes(LTY(query));
+            } else {
+                assert(query->type.node != NULL);
+                align_in_bytes = laye_type_align_in_bytes(query->type);
+            }
+
+            out_constant->kind = LYIR_EVAL_INT;
+            out_constant->int_value = (int64_t)align_in_bytes;
+            return LAYE_EVAL_OK;
+        }
+
+        case LAYE_NODE_LITNIL: {
+            out_constant->kind = LYIR_EVAL_NULL;
+            return LAYE_EVAL_OK;
         }
 
         case LAYE_NODE_LITBOOL: {
             out_constant->kind = LYIR_EVAL_BOOL;
             out_constant->bool_value = expr->litbool.value;
-            return true;
+            return LAYE_EVAL_OK;
         }
 
         case LAYE_NODE_LITINT: {
             out_constant->kind = LYIR_EVAL_INT;
             out_constant->int_value = expr->litint.value;
-            return true;
+            return LAYE_EVAL_OK;
+        }
+
+        case LAYE_NODE_LITRUNE: {
+            out_constant->kind = LYIR_EVAL_INT;
+            out_constant->int_value = expr->litrune.value;
+            return LAYE_EVAL_OK;
         }
 
         case LAYE_NODE_LITFLOAT: {
             out_constant->kind = LYIR_EVAL_FLOAT;
             out_constant->float_value = expr->litfloat.value;
-            return true;
+            return LAYE_EVAL_OK;
         }
 
         case LAYE_NODE_LITSTRING: {
             out_constant->kind = LYIR_EVAL_STRING;
             out_constant->string_value = expr->litstring.value;
-            return true;
+            return LAYE_EVAL_OK;
         }
 
+        case LAYE_NODE_UNARY: return laye_eval_unary(expr, out_constant);
+        case LAYE_NODE_BINARY: return laye_eval_binary(expr, out_constant);
+        case LAYE_NODE_CAST: return laye_eval_cast(expr, out_constant);
+
 #if false
         case LAYE_NODE_COMPOUND: {
             if (lca_da_count(expr->compound.children) == 1 && expr->compound.children[0]->kind == LAYE_NODE_YIELD) {
@@ -829,11 +1364,41 @@ bool laye_type_is_modifiable(laye_type type) {
     return type.is_modifiable;
 }
 
+void laye_type_struct_cache_layout(laye_type struct_type) {
+    assert(struct_type.node != NULL);
+    assert(struct_type.node->kind == LAYE_NODE_TYPE_STRUCT);
+
+    laye_node* node = struct_type.node;
+    int64_t field_count = lca_da_count(node->type_struct.fields);
+
+    lca_da_count_set(node->type_struct.cached_field_offsets, 0);
+    lca_da_reserve_exact(node->type_struct.cached_field_offsets, field_count);
+    lca_hashmap_free(node->type_struct.cached_field_indices);
+    lca_hashmap_reserve(node->type_struct.cached_field_indices, field_count);
+
+    int64_t member_offset = 0;
+    for (int64_t i = 0; i < field_count; i++) {
+        laye_struct_type_field f = node->type_struct.fields[i];
+        member_offset = align_to(member_offset, 8 * laye_type_align_in_bytes(f.type));
+        lca_da_push(node->type_struct.cached_field_offsets, (int)member_offset);
+        member_offset += laye_type_size_in_bits(f.type);
+
+        // first field with a given name wins, matching the linear lookup
+        if (!lca_hashmap_contains(node->type_struct.cached_field_indices, f.name)) {
+            lca_hashmap_set(node->type_struct.cached_field_indices, f.name, i);
+        }
+    }
+}
+
 int laye_type_struct_field_offset_bits(laye_type struct_type, int64_t field_index) {
     assert(struct_type.node != NULL);
     assert(struct_type.node->kind == LAYE_NODE_TYPE_STRUCT);
     assert(field_index < lca_da_count(struct_type.node->type_struct.fields));
 
+    if (lca_da_count(struct_type.node->type_struct.cached_field_offsets) == lca_da_count(struct_type.node->type_struct.fields)) {
+        return struct_type.node->type_struct.cached_field_offsets[field_index];
+    }
+
     int64_t member_offset = 0;
     laye_type member_type = {0};
 
@@ -856,6 +1421,11 @@ int64_t laye_type_struct_field_index_by_name(laye_type struct_type, lca_string_v
     assert(struct_type.node != NULL);
     assert(struct_type.node->kind == LAYE_NODE_TYPE_STRUCT);
 
+    if (struct_type.node->type_struct.cached_field_indices != NULL) {
+        __typeof__(struct_type.node->type_struct.cached_field_indices) entry = lca_hashmap_find(struct_type.node->type_struct.cached_field_indices, field_name);
+        return entry == NULL ? -1 : entry->value;
+    }
+
     for (int64_t i = 0, count = lca_da_count(struct_type.node->type_struct.fields); i < count; i++) {
         laye_struct_type_field f = struct_type.node->type_struct.fields[i];
         if (lca_string_view_equals(field_name, f.name)) {
@@ -900,6 +1470,70 @@ laye_type laye_type_strip_references(laye_type type) {
     return type;
 }
 
+// interns `type` and returns its canonical type node, which is `type` itself the first time
+// its structure is seen. primitive types are interned by their kind, width and signedness,
+// pointer, buffer and reference types by the canonical type of their element.
+// declared types are their own canonical type. anything else isn't interned and returns NULL.
+laye_node* laye_type_canonicalize(laye_node* type) {
+    assert(type != NULL);
+    assert(laye_node_is_type(type));
+
+    if (type->canonical_type != NULL) {
+        return type->canonical_type;
+    }
+
+    laye_canonical_type_key key = {
+        .kind = type->kind,
+    };
+
+    switch (type->kind) {
+        default: return NULL;
+
+        case LAYE_NODE_TYPE_STRUCT:
+        case LAYE_NODE_TYPE_VARIANT:
+        case LAYE_NODE_TYPE_ENUM:
+        case LAYE_NODE_TYPE_STRICT_ALIAS: {
+            type->canonical_type = type;
+            return type;
+        }
+
+        case LAYE_NODE_TYPE_VOID:
+        case LAYE_NODE_TYPE_NORETURN:
+        case LAYE_NODE_TYPE_BOOL:
+        case LAYE_NODE_TYPE_INT:
+        case LAYE_NODE_TYPE_FLOAT: {
+            key.bit_width = type->type_primitive.bit_width;
+            key.is_signed = type->type_primitive.is_signed;
+            key.is_platform_specified = type->type_primitive.is_platform_specified;
+        } break;
+
+        case LAYE_NODE_TYPE_REFERENCE:
+        case LAYE_NODE_TYPE_POINTER:
+        case LAYE_NODE_TYPE_BUFFER: {
+            assert(type->type_container.element_type.node != NULL);
+            key.element_node = laye_type_canonicalize(type->type_container.element_type.node);
+            if (key.element_node == NULL) {
+                return NULL;
+            }
+
+            key.is_element_modifiable = type->type_container.element_type.is_modifiable;
+        } break;
+    }
+
+    laye_context* context = type->context;
+    assert(context != NULL);
+
+    __typeof__(context->canonical_types) entry = lca_hashmap_find(context->canonical_types, key);
+    if (entry != NULL) {
+        type->canonical_type = entry->value;
+    } else {
+        lca_hashmap_set(context->canonical_types, key, type);
+        type->canonical_type = type;
+    }
+
+    return type->canonical_type;
+}
+
 bool laye_type_equals(laye_type a_type, laye_type b_type, laye_mut_compare mut_compare) {
     laye_node* a = a_type.node;
     laye_node* b = b_type.node;
@@ -926,6 +1560,10 @@ bool laye_type_equals(laye_type a_type, laye_type b_type, laye_mut_compare mut_c
         } break;
     }
 
+    // types sharing a canonical type are identical. different canonical types can still compare equal
+    // below, where platform integer types are matched by their own rules.
+    if (a->canonical_type != NULL && a->canonical_type == b->canonical_type) return true;
+
     if (laye_type_is_nameref(a_type)) {
         assert(a->nameref.referenced_type != NULL);
         return laye_type_equals(laye_type_qualify(a->nameref.referenced_type, a_type.is_modifiable), b_type, mut_compare);
@@ -65,35 +65,43 @@ static void laye_node_debug_print(laye_print_context* print_context, laye_node*
 void laye_symbol_print_to_string(laye_symbol* symbol, lca_string* s, int level) {
     assert(symbol != NULL);
 
-    lca_string_append_format(s, "; ");
+    lca_string_append_cstring(s, "; ");
     for (int i = 0; i < level; i++) {
-        lca_string_append_format(s, "  ");
+        lca_string_append_cstring(s, "  ");
     }
 
-    lca_string_append_format(s, "SYM ");
+    lca_string_append_cstring(s, "SYM ");
     if (symbol->name.count > 0) {
-        lca_string_append_format(s, "'%.*s' ", LCA_STR_EXPAND(symbol->name));
+        lca_string_append_char(s, '\'');
+        lca_string_append_view(s, symbol->name);
+        lca_string_append_cstring(s, "' ");
     }
 
     switch (symbol->kind) {
         default:
         case LAYE_SYMBOL_ENTITY: {
-            lca_string_append_format(s, "ENTITY\n");
+            lca_string_append_cstring(s, "ENTITY\n");
             for (int64_t i = 0, count = lca_da_count(symbol->nodes); i < count; i++) {
-                lca_string_append_format(s, "; ");
+                lca_string_append_cstring(s, "; ");
                 for (int i = 0; i < level + 1; i++) {
-                    lca_string_append_format(s, "  ");
+                    lca_string_append_cstring(s, "  ");
                 }
 
-                lca_string_append_format(s, "NODE %016llX\n", (size_t)(symbol->nodes[i]));
+                lca_string_append_cstring(s, "NODE ");
+                lca_string_append_hex(s, (size_t)(symbol->nodes[i]), 16);
+                lca_string_append_char(s, '\n');
             }
         } break;
 
         case LAYE_SYMBOL_NAMESPACE: {
-            lca_string_append_format(s, "NAMESPACE\n");
+            lca_string_append_cstring(s, "NAMESPACE\n");
             for (int64_t i = 0, count = lca_da_count(symbol->symbols); i < count; i++) {
                 laye_symbol_print_to_string(symbol->symbols[i], s, level + 1);
             }
+
+            for (int64_t i = 0, count = lca_da_count(symbol->included_namespaces); i < count; i++) {
+                laye_symbol_print_to_string(symbol->included_namespaces[i].symbol_namespace, s, level + 1);
+            }
         } break;
     }
 }
@@ -118,8 +126,16 @@ lca_string laye_module_debug_print(laye_module* module) {
     };
 
     bool use_color = print_context.use_color;
-    lca_string_append_format(print_context.output, "%s; %.*s%s\n", COL(COL_COMMENT), LCA_STR_EXPAND(lyir_context_get_source(module->context->lyir_context, module->sourceid).name), COL(RESET));
-    lca_string_append_format(print_context.output, "%s; %016llX%s\n", COL(COL_COMMENT), (size_t)module, COL(RESET));
+    lca_string_append_cstring(print_context.output, COL(COL_COMMENT));
+    lca_string_append_cstring(print_context.output, "; ");
+    lca_string_append_view(print_context.output, lca_string_as_view(lyir_context_get_source(module->context->lyir_context, module->sourceid).name));
+    lca_string_append_cstring(print_context.output, COL(RESET));
+    lca_string_append_char(print_context.output, '\n');
+    lca_string_append_cstring(print_context.output, COL(COL_COMMENT));
+    lca_string_append_cstring(print_context.output, "; ");
+    lca_string_append_hex(print_context.output, (size_t)module, 16);
+    lca_string_append_cstring(print_context.output, COL(RESET));
+    lca_string_append_char(print_context.output, '\n');
     if (module->imports != NULL) {
         //string_append_format(print_context.output, "%s; Imports:\n", COL(COL_COMMENT));
         //laye_symbol_print_to_string(module->imports, print_context.output, 1);
@@ -128,7 +144,7 @@ lca_string laye_module_debug_print(laye_module* module) {
         //lca_string_append_format(print_context.output, "%s; Exports:\n", COL(COL_COMMENT));
         //laye_symbol_print_to_string(module->exports, print_context.output, 1);
     }
-    lca_string_append_format(print_context.output, "%s", COL(RESET));
+    lca_string_append_cstring(print_context.output, COL(RESET));
 
     for (int64_t i = 0, count = lca_da_count(module->top_level_nodes); i < count; i++) {
         laye_node* top_level_node = module->top_level_nodes[i];
@@ -151,10 +167,12 @@ static void laye_node_debug_print_children(laye_print_context* print_context, lc
         lca_string indents = *print_context->indents;
 
         const char* next_leader = is_last ? "└─" : "├─";
-        lca_string_append_format(print_context->output, "%s%.*s%s", COL(COL_TREE), LCA_STR_EXPAND(indents), next_leader);
+        lca_string_append_cstring(print_context->output, COL(COL_TREE));
+        lca_string_append_view(print_context->output, lca_string_as_view(indents));
+        lca_string_append_cstring(print_context->output, next_leader);
 
         int64_t old_indents_count = print_context->indents->count;
-        lca_string_append_format(print_context->indents, "%s", is_last ? "  " : "│ ");
+        lca_string_append_cstring(print_context->indents, is_last ? "  " : "│ ");
 
         laye_node_debug_print(print_context, child);
 
@@ -176,63 +194,65 @@ static void laye_node_debug_print(laye_print_context* print_context, laye_node*
 
     bool use_color = print_context->use_color;
 
-    lca_string_append_format(
-        print_context->output,
-        "%s%s%s%s %s%016llX %s<%lld>",
-        COL(COL_NODE),
-        laye_node_kind_to_cstring(node->kind),
-        (node->compiler_generated ? "*" : ""),
-        (laye_expr_is_lvalue(node) ? "&" : ""),
-        COL(COL_ADDR),
-        (size_t)node,
-        COL(COL_OFFS),
-        node->location.offset
-    );
+    lca_string_append_cstring(print_context->output, COL(COL_NODE));
+    lca_string_append_cstring(print_context->output, laye_node_kind_to_cstring(node->kind));
+    if (node->compiler_generated) lca_string_append_char(print_context->output, '*');
+    if (laye_expr_is_lvalue(node)) lca_string_append_char(print_context->output, '&');
+    lca_string_append_char(print_context->output, ' ');
+    lca_string_append_cstring(print_context->output, COL(COL_ADDR));
+    lca_string_append_hex(print_context->output, (size_t)node, 16);
+    lca_string_append_char(print_context->output, ' ');
+    lca_string_append_cstring(print_context->output, COL(COL_OFFS));
+    lca_string_append_char(print_context->output, '<');
+    lca_string_append_int(print_context->output, node->location.offset);
+    lca_string_append_char(print_context->output, '>');
 
     if (laye_node_is_decl(node)) {
-        lca_string_append_format(print_context->output, "%s", COL(COL_NODE));
+        lca_string_append_cstring(print_context->output, COL(COL_NODE));
         switch (node->attributes.linkage) {
-            case LYIR_LINK_LOCAL: lca_string_append_format(print_context->output, " LOCAL"); break;
-            case LYIR_LINK_INTERNAL: lca_string_append_format(print_context->output, " INTERNAL"); break;
-            case LYIR_LINK_IMPORTED: lca_string_append_format(print_context->output, " IMPORTED"); break;
-            case LYIR_LINK_EXPORTED: lca_string_append_format(print_context->output, " EXPORTED"); break;
-            case LYIR_LINK_REEXPORTED: lca_string_append_format(print_context->output, " REEXPORTED"); break;
+            case LYIR_LINK_LOCAL: lca_string_append_cstring(print_context->output, " LOCAL"); break;
+            case LYIR_LINK_INTERNAL: lca_string_append_cstring(print_context->output, " INTERNAL"); break;
+            case LYIR_LINK_IMPORTED: lca_string_append_cstring(print_context->output, " IMPORTED"); break;
+            case LYIR_LINK_EXPORTED: lca_string_append_cstring(print_context->output, " EXPORTED"); break;
+            case LYIR_LINK_REEXPORTED: lca_string_append_cstring(print_context->output, " REEXPORTED"); break;
         }
 
         switch (node->attributes.calling_convention) {
             case LYIR_DEFAULTCC: break;
-            case LYIR_CCC: lca_string_append_format(print_context->output, " CCC"); break;
-            case LYIR_LAYECC: lca_string_append_format(print_context->output, " LAYECC"); break;
+            case LYIR_CCC: lca_string_append_cstring(print_context->output, " CCC"); break;
+            case LYIR_LAYECC: lca_string_append_cstring(print_context->output, " LAYECC"); break;
         }
 
         switch (node->attributes.mangling) {
             case LYIR_MANGLE_DEFAULT: break;
-            case LYIR_MANGLE_NONE: lca_string_append_format(print_context->output, " NO_MANGLE"); break;
-            case LYIR_MANGLE_LAYE: lca_string_append_format(print_context->output, " LAYE_MANGLE"); break;
+            case LYIR_MANGLE_NONE: lca_string_append_cstring(print_context->output, " NO_MANGLE"); break;
+            case LYIR_MANGLE_LAYE: lca_string_append_cstring(print_context->output, " LAYE_MANGLE"); break;
         }
 
         if (node->attributes.is_discardable) {
-            lca_string_append_format(print_context->output, " DISCARDABLE");
+            lca_string_append_cstring(print_context->output, " DISCARDABLE");
         }
 
         if (node->attributes.is_inline) {
-            lca_string_append_format(print_context->output, " INLINE");
+            lca_string_append_cstring(print_context->output, " INLINE");
         }
 
         if (node->attributes.foreign_name.count != 0) {
-            lca_string_append_format(print_context->output, " FOREIGN \"%.*s\"", LCA_STR_EXPAND(node->attributes.foreign_name));
+            lca_string_append_cstring(print_context->output, " FOREIGN \"");
+            lca_string_append_view(print_context->output, node->attributes.foreign_name);
+            lca_string_append_char(print_context->output, '"');
         }
     }
 
     if (laye_node_is_dependent(node)) {
-        lca_string_append_format(print_context->output, " DEPENDENT");
+        lca_string_append_cstring(print_context->output, " DEPENDENT");
     }
 
     if (node->declared_type.node != NULL) {
-        lca_string_append_format(print_context->output, " ");
+        lca_string_append_char(print_context->output, ' ');
         laye_type_print_to_string(node->declared_type, print_context->output, use_color);
     } else if (node->type.node != NULL) {
-        lca_string_append_format(print_context->output, " ");
+        lca_string_append_char(print_context->output, ' ');
         laye_type_print_to_string(node->type, print_context->output, use_color);
     }
 
@@ -243,20 +263,22 @@ static void laye_node_debug_print(laye_print_context* print_context, laye_node*
 
         case LAYE_NODE_DECL_IMPORT: {
             lyir_source source = lyir_context_get_source(print_context->context->lyir_context, node->location.sourceid);
-            lca_string_append_format(
-                print_context->output,
-                " %s%.*s",
-                COL(COL_NAME),
-                (int)node->decl_import.module_name.location.length,
-                source.text.data + node->decl_import.module_name.location.offset
-            );
+            lca_string_append_char(print_context->output, ' ');
+            lca_string_append_cstring(print_context->output, COL(COL_NAME));
+            lca_string_append_view(print_context->output, lca_string_slice(source.text, node->decl_import.module_name.location.offset, node->decl_import.module_name.location.length));
 
             if (node->decl_import.import_alias.kind != 0) {
-                lca_string_append_format(print_context->output, " %sas %s%.*s", COL(COL_TREE), COL(COL_NAME), LCA_STR_EXPAND(node->decl_import.import_alias.string_value));
+                lca_string_append_char(print_context->output, ' ');
+                lca_string_append_cstring(print_context->output, COL(COL_TREE));
+                lca_string_append_cstring(print_context->output, "as ");
+                lca_string_append_cstring(print_context->output, COL(COL_NAME));
+                lca_string_append_view(print_context->output, node->decl_import.import_alias.string_value);
             }
 
             if (node->decl_import.referenced_module != NULL) {
-                lca_string_append_format(print_context->output, " %s%016llX", COL(COL_ADDR), (size_t)node->decl_import.referenced_module);
+                lca_string_append_char(print_context->output, ' ');
+                lca_string_append_cstring(print_context->output, COL(COL_ADDR));
+                lca_string_append_hex(print_context->output, (size_t)node->decl_import.referenced_module, 16);
             }
 
             for (int64_t i = 0, count = lca_da_count(node->decl_import.import_queries); i < count; i++) {
@@ -265,28 +287,37 @@ static void laye_node_debug_print(laye_print_context* print_context, laye_node*
         } break;
 
         case LAYE_NODE_IMPORT_QUERY: {
-            lca_string_append_format(print_context->output, " ");
+            lca_string_append_char(print_context->output, ' ');
 
             if (node->import_query.is_wildcard) {
-                lca_string_append_format(print_context->output, "%s*", COL(COL_NAME));
+                lca_string_append_cstring(print_context->output, COL(COL_NAME));
+                lca_string_append_char(print_context->output, '*');
             } else {
                 for (int64_t i = 0, count = lca_da_count(node->import_query.pieces); i < count; i++) {
                     laye_token piece = node->import_query.pieces[i];
                     if (i > 0) {
-                        lca_string_append_format(print_context->output, "%s::", COL(RESET));
+                        lca_string_append_cstring(print_context->output, COL(RESET));
+                        lca_string_append_cstring(print_context->output, "::");
                     }
 
-                    lca_string_append_format(print_context->output, "%s%.*s", COL(COL_NAME), LCA_STR_EXPAND(piece.string_value));
+                    lca_string_append_cstring(print_context->output, COL(COL_NAME));
+                    lca_string_append_view(print_context->output, piece.string_value);
                 }
 
                 if (node->import_query.alias.kind != 0) {
-                    lca_string_append_format(print_context->output, " %sas %s%.*s", COL(COL_TREE), COL(COL_NAME), LCA_STR_EXPAND(node->import_query.alias.string_value));
+                    lca_string_append_char(print_context->output, ' ');
+                    lca_string_append_cstring(print_context->output, COL(COL_TREE));
+                    lca_string_append_cstring(print_context->output, "as ");
+                    lca_string_append_cstring(print_context->output, COL(COL_NAME));
+                    lca_string_append_view(print_context->output, node->import_query.alias.string_value);
                 }
             }
         } break;
 
         case LAYE_NODE_DECL_FUNCTION: {
-            lca_string_append_format(print_context->output, " %s%.*s", COL(COL_NAME), LCA_STR_EXPAND(node->declared_name));
+            lca_string_append_char(print_context->output, ' ');
+            lca_string_append_cstring(print_context->output, COL(COL_NAME));
+            lca_string_append_view(print_context->output, node->declared_name);
             laye_template_parameters_print_to_string(node->template_parameters, print_context->output, use_color);
 
             if (node->decl_function.body != NULL)
@@ -294,7 +325,9 @@ static void laye_node_debug_print(laye_print_context* print_context, laye_node*
         } break;
 
         case LAYE_NODE_DECL_BINDING: {
-            lca_string_append_format(print_context->output, " %s%.*s", COL(COL_NAME), LCA_STR_EXPAND(node->declared_name));
+            lca_string_append_char(print_context->output, ' ');
+            lca_string_append_cstring(print_context->output, COL(COL_NAME));
+            lca_string_append_view(print_context->output, node->declared_name);
             laye_template_parameters_print_to_string(node->template_parameters, print_context->output, use_color);
 
             if (node->decl_binding.initializer != NULL)
@@ -302,7 +335,9 @@ static void laye_node_debug_print(laye_print_context* print_context, laye_node*
         } break;
 
         case LAYE_NODE_DECL_STRUCT: {
-            lca_string_append_format(print_context->output, " %s%.*s", COL(COL_NAME), LCA_STR_EXPAND(node->declared_name));
+            lca_string_append_char(print_context->output, ' ');
+            lca_string_append_cstring(print_context->output, COL(COL_NAME));
+            lca_string_append_view(print_context->output, node->declared_name);
             laye_template_parameters_print_to_string(node->template_parameters, print_context->output, use_color);
 
             for (int64_t i = 0, count = lca_da_count(node->decl_struct.field_declarations); i < count; i++)
@@ -313,7 +348,9 @@ static void laye_node_debug_print(laye_print_context* print_context, laye_node*
         } break;
 
         case LAYE_NODE_DECL_STRUCT_FIELD: {
-            lca_string_append_format(print_context->output, " %s%.*s", COL(COL_NAME), LCA_STR_EXPAND(node->declared_name));
+            lca_string_append_char(print_context->output, ' ');
+            lca_string_append_cstring(print_context->output, COL(COL_NAME));
+            lca_string_append_view(print_context->output, node->declared_name);
             laye_template_parameters_print_to_string(node->template_parameters, print_context->output, use_color);
 
             if (node->decl_binding.initializer != NULL)
@@ -323,10 +360,12 @@ static void laye_node_debug_print(laye_print_context* print_context, laye_node*
         case LAYE_NODE_DECL_TEST: {
             lyir_source source = lyir_context_get_source(print_context->context->lyir_context, node->decl_test.description.location.sourceid);
             if (node->decl_test.is_named) {
-                lca_string_append_format(print_context->output, " ");
+                lca_string_append_char(print_context->output, ' ');
                 laye_nameref_print_to_string(node->decl_test.nameref, print_context->output, use_color);
             } else if (node->decl_test.description.kind != LAYE_TOKEN_INVALID) {
-                lca_string_append_format(print_context->output, " %s%.*s", COL(COL_CONST), (int)node->decl_test.description.location.length, source.text.data + node->decl_test.description.location.offset);
+                lca_string_append_char(print_context->output, ' ');
+                lca_string_append_cstring(print_context->output, COL(COL_CONST));
+                lca_string_append_view(print_context->output, lca_string_slice(source.text, node->decl_test.description.location.offset, node->decl_test.description.location.length));
             }
 
             assert(node->decl_test.body != NULL);
@@ -347,11 +386,15 @@ static void laye_node_debug_print(laye_print_context* print_context, laye_node*
 
         case LAYE_NODE_FOR: {
             if (node->_for.has_breaks) {
-                lca_string_append_format(print_context->output, " %sHAS_BREAKS", COL(COL_TREE));
+                lca_string_append_char(print_context->output, ' ');
+                lca_string_append_cstring(print_context->output, COL(COL_TREE));
+                lca_string_append_cstring(print_context->output, "HAS_BREAKS");
             }
 
             if (node->_for.has_continues) {
-                lca_string_append_format(print_context->output, " %sHAS_CONTINUES", COL(COL_TREE));
+                lca_string_append_char(print_context->output, ' ');
+                lca_string_append_cstring(print_context->output, COL(COL_TREE));
+                lca_string_append_cstring(print_context->output, "HAS_CONTINUES");
             }
 
             if (node->_for.initializer != NULL) {
@@ -377,11 +420,15 @@ static void laye_node_debug_print(laye_print_context* print_context, laye_node*
 
         case LAYE_NODE_FOREACH: {
             if (node->foreach.has_breaks) {
-                lca_string_append_format(print_context->output, " %sHAS_BREAKS", COL(COL_TREE));
+                lca_string_append_char(print_context->output, ' ');
+                lca_string_append_cstring(print_context->output, COL(COL_TREE));
+                lca_string_append_cstring(print_context->output, "HAS_BREAKS");
             }
 
             if (node->foreach.has_continues) {
-                lca_string_append_format(print_context->output, " %sHAS_CONTINUES", COL(COL_TREE));
+                lca_string_append_char(print_context->output, ' ');
+                lca_string_append_cstring(print_context->output, COL(COL_TREE));
+                lca_string_append_cstring(print_context->output, "HAS_CONTINUES");
             }
 
             if (node->foreach.index_binding != NULL) {
@@ -401,11 +448,15 @@ static void laye_node_debug_print(laye_print_context* print_context, laye_node*
 
         case LAYE_NODE_WHILE: {
             if (node->_while.has_breaks) {
-                lca_string_append_format(print_context->output, " %sHAS_BREAKS", COL(COL_TREE));
+                lca_string_append_char(print_context->output, ' ');
+                lca_string_append_cstring(print_context->output, COL(COL_TREE));
+                lca_string_append_cstring(print_context->output, "HAS_BREAKS");
             }
 
             if (node->_while.has_continues) {
-                lca_string_append_format(print_context->output, " %sHAS_CONTINUES", COL(COL_TREE));
+                lca_string_append_char(print_context->output, ' ');
+                lca_string_append_cstring(print_context->output, COL(COL_TREE));
+                lca_string_append_cstring(print_context->output, "HAS_CONTINUES");
             }
 
             if (node->_while.condition != NULL) {
@@ -423,11 +474,15 @@ static void laye_node_debug_print(laye_print_context* print_context, laye_node*
 
         case LAYE_NODE_DOWHILE: {
             if (node->dowhile.has_breaks) {
-                lca_string_append_format(print_context->output, " %sHAS_BREAKS", COL(COL_TREE));
+                lca_string_append_char(print_context->output, ' ');
+                lca_string_append_cstring(print_context->output, COL(COL_TREE));
+                lca_string_append_cstring(print_context->output, "HAS_BREAKS");
             }
 
             if (node->dowhile.has_continues) {
-                lca_string_append_format(print_context->output, " %sHAS_CONTINUES", COL(COL_TREE));
+                lca_string_append_char(print_context->output, ' ');
+                lca_string_append_cstring(print_context->output, COL(COL_TREE));
+                lca_string_append_cstring(print_context->output, "HAS_CONTINUES");
             }
 
             assert(node->dowhile.condition != NULL);
@@ -439,7 +494,9 @@ static void laye_node_debug_print(laye_print_context* print_context, laye_node*
         } break;
 
         case LAYE_NODE_LABEL: {
-            lca_string_append_format(print_context->output, " %s%.*s", COL(COL_NAME), LCA_STR_EXPAND(node->declared_name));
+            lca_string_append_char(print_context->output, ' ');
+            lca_string_append_cstring(print_context->output, COL(COL_NAME));
+            lca_string_append_view(print_context->output, node->declared_name);
         } break;
 
         case LAYE_NODE_DEFER: {
@@ -454,40 +511,42 @@ static void laye_node_debug_print(laye_print_context* print_context, laye_node*
 
         case LAYE_NODE_BREAK: {
             if (node->_break.target.count != 0) {
-                lca_string_append_format(print_context->output, " %s%.*s", COL(COL_NAME), LCA_STR_EXPAND(node->_break.target));
+                lca_string_append_char(print_context->output, ' ');
+                lca_string_append_cstring(print_context->output, COL(COL_NAME));
+                lca_string_append_view(print_context->output, node->_break.target);
             }
 
             if (node->_break.target_node != NULL) {
-                lca_string_append_format(
-                    print_context->output,
-                    " %s%s %s%016llX",
-                    COL(COL_NODE),
-                    laye_node_kind_to_cstring(node->_break.target_node->kind),
-                    COL(COL_ADDR),
-                    (size_t)node->_break.target_node
-                );
+                lca_string_append_char(print_context->output, ' ');
+                lca_string_append_cstring(print_context->output, COL(COL_NODE));
+                lca_string_append_cstring(print_context->output, laye_node_kind_to_cstring(node->_break.target_node->kind));
+                lca_string_append_char(print_context->output, ' ');
+                lca_string_append_cstring(print_context->output, COL(COL_ADDR));
+                lca_string_append_hex(print_context->output, (size_t)node->_break.target_node, 16);
             }
         } break;
 
         case LAYE_NODE_CONTINUE: {
             if (node->_continue.target.count != 0) {
-                lca_string_append_format(print_context->output, " %s%.*s", COL(COL_NAME), LCA_STR_EXPAND(node->_continue.target));
+                lca_string_append_char(print_context->output, ' ');
+                lca_string_append_cstring(print_context->output, COL(COL_NAME));
+                lca_string_append_view(print_context->output, node->_continue.target);
             }
 
             if (node->_break.target_node != NULL) {
-                lca_string_append_format(
-                    print_context->output,
-                    " %s%s %s%016llX",
-                    COL(COL_NODE),
-                    laye_node_kind_to_cstring(node->_continue.target_node->kind),
-                    COL(COL_ADDR),
-                    (size_t)node->_continue.target_node
-                );
+                lca_string_append_char(print_context->output, ' ');
+                lca_string_append_cstring(print_context->output, COL(COL_NODE));
+                lca_string_append_cstring(print_context->output, laye_node_kind_to_cstring(node->_continue.target_node->kind));
+                lca_string_append_char(print_context->output, ' ');
+                lca_string_append_cstring(print_context->output, COL(COL_ADDR));
+                lca_string_append_hex(print_context->output, (size_t)node->_continue.target_node, 16);
             }
         } break;
 
         case LAYE_NODE_GOTO: {
-            lca_string_append_format(print_context->output, " %s%.*s", COL(COL_NAME), LCA_STR_EXPAND(node->_goto.label));
+            lca_string_append_char(print_context->output, ' ');
+            lca_string_append_cstring(print_context->output, COL(COL_NAME));
+            lca_string_append_view(print_context->output, node->_goto.label);
         } break;
 
         case LAYE_NODE_YIELD: {
@@ -498,7 +557,9 @@ static void laye_node_debug_print(laye_print_context* print_context, laye_node*
         case LAYE_NODE_ASSERT: {
             if (node->_assert.message.kind != LAYE_TOKEN_INVALID) {
                 lyir_source source = lyir_context_get_source(print_context->context->lyir_context, node->_assert.message.location.sourceid);
-                lca_string_append_format(print_context->output, " %s%.*s", COL(COL_CONST), (int)node->_assert.message.location.length, source.text.data + node->_assert.message.location.offset);
+                lca_string_append_char(print_context->output, ' ');
+                lca_string_append_cstring(print_context->output, COL(COL_CONST));
+                lca_string_append_view(print_context->output, lca_string_slice(source.text, node->_assert.message.location.offset, node->_assert.message.location.length));
             }
 
             assert(node->_assert.condition != NULL);
@@ -515,8 +576,10 @@ static void laye_node_debug_print(laye_print_context* print_context, laye_node*
             assert(node->evaluated_constant.expr != NULL);
             lca_da_push(children, node->evaluated_constant.expr);
 
-            if (node->evaluated_constant.result.kind == LYIR_EVAL_INT) {
-                lca_string_append_format(print_context->output, " %s%lld", COL(COL_CONST), node->evaluated_constant.result.int_value);
+            lyir_evaluated_constant_kind result_kind = node->evaluated_constant.result.kind;
+            if (result_kind == LYIR_EVAL_BOOL || result_kind == LYIR_EVAL_INT || result_kind == LYIR_EVAL_FLOAT) {
+                lca_string_append_char(print_context->output, ' ');
+                laye_constant_print_to_string(node->evaluated_constant.result, print_context->output, use_color);
             }
         } break;
 
@@ -524,15 +587,16 @@ static void laye_node_debug_print(laye_print_context* print_context, laye_node*
             assert(node->cast.operand != NULL);
             lca_da_push(children, node->cast.operand);
 
-            lca_string_append_format(print_context->output, " %s", COL(COL_NODE));
+            lca_string_append_char(print_context->output, ' ');
+            lca_string_append_cstring(print_context->output, COL(COL_NODE));
             switch (node->cast.kind) {
-                case LAYE_CAST_SOFT: lca_string_append_format(print_context->output, "SOFT"); break;
-                case LAYE_CAST_HARD: lca_string_append_format(print_context->output, "HARD"); break;
-                case LAYE_CAST_STRUCT_BITCAST: lca_string_append_format(print_context->output, "STRUCT_BITCAST"); break;
-                case LAYE_CAST_IMPLICIT: lca_string_append_format(print_context->output, "IMPLICIT"); break;
-                case LAYE_CAST_LVALUE_TO_RVALUE: lca_string_append_format(print_context->output, "LVALUE_TO_RVALUE"); break;
-                case LAYE_CAST_LVALUE_TO_REFERENCE: lca_string_append_format(print_context->output, "LVALUE_TO_REFERENCE"); break;
-                case LAYE_CAST_REFERENCE_TO_LVALUE: lca_string_append_format(print_context->output, "REFERENCE_TO_LVALUE"); break;
+                case LAYE_CAST_SOFT: lca_string_append_cstring(print_context->output, "SOFT"); break;
+                case LAYE_CAST_HARD: lca_string_append_cstring(print_context->output, "HARD"); break;
+                case LAYE_CAST_STRUCT_BITCAST: lca_string_append_cstring(print_context->output, "STRUCT_BITCAST"); break;
+                case LAYE_CAST_IMPLICIT: lca_string_append_cstring(print_context->output, "IMPLICIT"); break;
+                case LAYE_CAST_LVALUE_TO_RVALUE: lca_string_append_cstring(print_context->output, "LVALUE_TO_RVALUE"); break;
+                case LAYE_CAST_LVALUE_TO_REFERENCE: lca_string_append_cstring(print_context->output, "LVALUE_TO_REFERENCE"); break;
+                case LAYE_CAST_REFERENCE_TO_LVALUE: lca_string_append_cstring(print_context->output, "REFERENCE_TO_LVALUE"); break;
             }
         } break;
 
@@ -555,7 +619,9 @@ static void laye_node_debug_print(laye_print_context* print_context, laye_node*
         } break;
 
         case LAYE_NODE_MEMBER: {
-            lca_string_append_format(print_context->output, " %s%.*s", COL(COL_NAME), LCA_STR_EXPAND(node->member.field_name.string_value));
+            lca_string_append_char(print_context->output, ' ');
+            lca_string_append_cstring(print_context->output, COL(COL_NAME));
+            lca_string_append_view(print_context->output, node->member.field_name.string_value);
 
             assert(node->member.value != NULL);
             lca_da_push(children, node->member.value);
@@ -565,7 +631,9 @@ static void laye_node_debug_print(laye_print_context* print_context, laye_node*
             lca_da_push(children, node->unary.operand);
 
             lyir_source source = lyir_context_get_source(print_context->context->lyir_context, node->location.sourceid);
-            lca_string_append_format(print_context->output, " %s%.*s", COL(COL_NODE), (int)node->unary.operator.location.length, source.text.data + node->unary.operator.location.offset);
+            lca_string_append_char(print_context->output, ' ');
+            lca_string_append_cstring(print_context->output, COL(COL_NODE));
+            lca_string_append_view(print_context->output, lca_string_slice(source.text, node->unary.operator.location.offset, node->unary.operator.location.length));
         } break;
 
         case LAYE_NODE_BINARY: {
@@ -573,7 +641,9 @@ static void laye_node_debug_print(laye_print_context* print_context, laye_node*
             lca_da_push(children, node->binary.rhs);
 
             lyir_source source = lyir_context_get_source(print_context->context->lyir_context, node->location.sourceid);
-            lca_string_append_format(print_context->output, " %s%.*s", COL(COL_NODE), (int)node->binary.operator.location.length, source.text.data + node->binary.operator.location.offset);
+            lca_string_append_char(print_context->output, ' ');
+            lca_string_append_cstring(print_context->output, COL(COL_NODE));
+            lca_string_append_view(print_context->output, lca_string_slice(source.text, node->binary.operator.location.offset, node->binary.operator.location.length));
         } break;
 
         case LAYE_NODE_ASSIGNMENT: {
@@ -581,29 +651,38 @@ static void laye_node_debug_print(laye_print_context* print_context, laye_node*
             lca_da_push(children, node->assignment.rhs);
 
             lyir_source source = lyir_context_get_source(print_context->context->lyir_context, node->location.sourceid);
-            lca_string_append_format(print_context->output, " %s%.*s", COL(COL_NODE), (int)node->location.length, source.text.data + node->location.offset);
+            lca_string_append_char(print_context->output, ' ');
+            lca_string_append_cstring(print_context->output, COL(COL_NODE));
+            lca_string_append_view(print_context->output, lca_string_slice(source.text, node->location.offset, node->location.length));
         } break;
 
         case LAYE_NODE_NAMEREF: {
-            lca_string_append_format(print_context->output, " ");
+            lca_string_append_char(print_context->output, ' ');
             laye_nameref_print_to_string(node->nameref, print_context->output, use_color);
         } break;
 
         case LAYE_NODE_LITINT: {
-            lca_string_append_format(print_context->output, " %s%lld", COL(COL_CONST), node->litint.value);
+            lca_string_append_char(print_context->output, ' ');
+            lca_string_append_cstring(print_context->output, COL(COL_CONST));
+            lca_string_append_int(print_context->output, node->litint.value);
         } break;
 
         case LAYE_NODE_LITBOOL: {
-            lca_string_append_format(print_context->output, " %s%s", COL(COL_CONST), node->litbool.value ? "true" : "false");
+            lca_string_append_char(print_context->output, ' ');
+            lca_string_append_cstring(print_context->output, COL(COL_CONST));
+            lca_string_append_cstring(print_context->output, node->litbool.value ? "true" : "false");
         } break;
 
         case LAYE_NODE_LITSTRING: {
             lyir_source source = lyir_context_get_source(print_context->context->lyir_context, node->location.sourceid);
-            lca_string_append_format(print_context->output, " %s%.*s", COL(COL_CONST), (int)node->location.length, source.text.data + node->location.offset);
+            lca_string_append_char(print_context->output, ' ');
+            lca_string_append_cstring(print_context->output, COL(COL_CONST));
+            lca_string_append_view(print_context->output, lca_string_slice(source.text, node->location.offset, node->location.length));
         } break;
     }
 
-    lca_string_append_format(print_context->output, "%s\n", COL(RESET));
+    lca_string_append_cstring(print_context->output, COL(RESET));
+    lca_string_append_char(print_context->output, '\n');
 
     if (children != NULL) {
         laye_node_debug_print_children(print_context, children);
@@ -622,10 +701,12 @@ void laye_template_parameters_print_to_string(lca_da(laye_node*) template_params
         return;
     }
 
-    lca_string_append_format(s, "%s<", COL(RESET));
+    lca_string_append_cstring(s, COL(RESET));
+    lca_string_append_char(s, '<');
     for (int64_t i = 0; i < lca_da_count(template_params); i++) {
         if (i > 0) {
-            lca_string_append_format(s, "%s, ", COL(RESET));
+            lca_string_append_cstring(s, COL(RESET));
+            lca_string_append_cstring(s, ", ");
         }
 
         laye_node* template_param = template_params[i];
@@ -633,43 +714,55 @@ void laye_template_parameters_print_to_string(lca_da(laye_node*) template_params
 
         if (template_param->kind == LAYE_NODE_DECL_TEMPLATE_TYPE) {
             if (template_param->decl_template_type.is_duckable) {
-                lca_string_append_format(s, "%svar ", COL(COL_KEYWORD));
+                lca_string_append_cstring(s, COL(COL_KEYWORD));
+                lca_string_append_cstring(s, "var ");
             }
 
-            lca_string_append_format(s, "%s%.*s", COL(COL_TEMPLATE_PARAM), LCA_STR_EXPAND(template_param->declared_name));
+            lca_string_append_cstring(s, COL(COL_TEMPLATE_PARAM));
+            lca_string_append_view(s, template_param->declared_name);
         } else if (template_param->kind == LAYE_NODE_DECL_TEMPLATE_VALUE) {
             laye_type_print_to_string(template_param->declared_type, s, use_color);
-            lca_string_append_format(s, " ");
-            lca_string_append_format(s, "%s%.*s", COL(COL_TEMPLATE_PARAM), LCA_STR_EXPAND(template_param->declared_name));
+            lca_string_append_char(s, ' ');
+            lca_string_append_cstring(s, COL(COL_TEMPLATE_PARAM));
+            lca_string_append_view(s, template_param->declared_name);
         } else {
             fprintf(stderr, "for node kind %s\n", laye_node_kind_to_cstring(template_param->kind));
             assert(false && "invalid template parameter declaration kind");
         }
     }
 
-    lca_string_append_format(s, "%s>", COL(RESET));
+    lca_string_append_cstring(s, COL(RESET));
+    lca_string_append_char(s, '>');
 }
 
 void laye_nameref_print_to_string(laye_nameref nameref, lca_string* s, bool use_color) {
     if (nameref.kind == LAYE_NAMEREF_HEADLESS) {
-        lca_string_append_format(s, "%s::", COL(COL_DELIM));
+        lca_string_append_cstring(s, COL(COL_DELIM));
+        lca_string_append_cstring(s, "::");
     } else if (nameref.kind == LAYE_NAMEREF_GLOBAL) {
-        lca_string_append_format(s, "%sglobal%s::", COL(COL_TREE), COL(COL_DELIM));
+        lca_string_append_cstring(s, COL(COL_TREE));
+        lca_string_append_cstring(s, "global");
+        lca_string_append_cstring(s, COL(COL_DELIM));
+        lca_string_append_cstring(s, "::");
     }
 
     for (int64_t i = 0, count = lca_da_count(nameref.pieces); i < count; i++) {
         if (i > 0) {
-            lca_string_append_format(s, "%s::", COL(COL_DELIM));
+            lca_string_append_cstring(s, COL(COL_DELIM));
+            lca_string_append_cstring(s, "::");
         }
 
-        lca_string_append_format(s, "%s%.*s", COL(COL_NAME), LCA_STR_EXPAND(nameref.pieces[i].string_value));
+        lca_string_append_cstring(s, COL(COL_NAME));
+        lca_string_append_view(s, nameref.pieces[i].string_value);
     }
 
     if (0 != lca_da_count(nameref.template_arguments)) {
-        lca_string_append_format(s, "%s<", COL(COL_DELIM));
+        lca_string_append_cstring(s, COL(COL_DELIM));
+        lca_string_append_char(s, '<');
         for (int64_t i = 0, count = lca_da_count(nameref.template_arguments); i < count; i++) {
             if (i > 0) {
-                lca_string_append_format(s, "%s, ", COL(COL_DELIM));
+                lca_string_append_cstring(s, COL(COL_DELIM));
+                lca_string_append_cstring(s, ", ");
             }
 
             laye_template_arg template_argument = nameref.template_arguments[i];
@@ -688,15 +781,21 @@ void laye_nameref_print_to_string(laye_nameref nameref, lca_string* s, bool use_
                     goto retry_print_arg;
                 }
 
-                lca_string_append_format(s, "%s{? %s}", COL(COL_ERROR), laye_node_kind_to_cstring(template_argument.node->kind));
+                lca_string_append_cstring(s, COL(COL_ERROR));
+                lca_string_append_cstring(s, "{? ");
+                lca_string_append_cstring(s, laye_node_kind_to_cstring(template_argument.node->kind));
+                lca_string_append_char(s, '}');
             }
         }
 
-        lca_string_append_format(s, "%s>", COL(COL_DELIM));
+        lca_string_append_cstring(s, COL(COL_DELIM));
+        lca_string_append_char(s, '>');
     }
 
     if (nameref.referenced_declaration != NULL) {
-        lca_string_append_format(s, " %s%016llX", COL(COL_ADDR), (size_t)nameref.referenced_declaration);
+        lca_string_append_char(s, ' ');
+        lca_string_append_cstring(s, COL(COL_ADDR));
+        lca_string_append_hex(s, (size_t)nameref.referenced_declaration, 16);
     }
 }
 
@@ -707,31 +806,40 @@ void laye_constant_print_to_string(lyir_evaluated_constant constant, lca_string*
         default: assert(false && "unreachable"); break;
 
         case LYIR_EVAL_NULL: {
-            lca_string_append_format(s, "%snil", COL(COL_CONST));
+            lca_string_append_cstring(s, COL(COL_CONST));
+            lca_string_append_cstring(s, "nil");
         } break;
 
         case LYIR_EVAL_VOID: {
-            lca_string_append_format(s, "%svoid", COL(COL_CONST));
+            lca_string_append_cstring(s, COL(COL_CONST));
+            lca_string_append_cstring(s, "void");
         } break;
 
         case LYIR_EVAL_BOOL: {
             if (constant.bool_value) {
-                lca_string_append_format(s, "%strue", COL(COL_CONST));
+                lca_string_append_cstring(s, COL(COL_CONST));
+                lca_string_append_cstring(s, "true");
             } else {
-                lca_string_append_format(s, "%sfalse", COL(COL_CONST));
+                lca_string_append_cstring(s, COL(COL_CONST));
+                lca_string_append_cstring(s, "false");
             }
         } break;
 
         case LYIR_EVAL_INT: {
-            lca_string_append_format(s, "%s%lld", COL(COL_CONST), constant.int_value);
+            lca_string_append_cstring(s, COL(COL_CONST));
+            lca_string_append_int(s, constant.int_value);
         } break;
 
         case LYIR_EVAL_FLOAT: {
-            lca_string_append_format(s, "%s%f", COL(COL_CONST), constant.float_value);
+            lca_string_append_cstring(s, COL(COL_CONST));
+            lca_string_append_double(s, constant.float_value);
         } break;
 
         case LYIR_EVAL_STRING: {
-            lca_string_append_format(s, "%s\"%.*s\"", COL(COL_CONST), LCA_STR_EXPAND(constant.string_value));
+            lca_string_append_cstring(s, COL(COL_CONST));
+            lca_string_append_char(s, '"');
+            lca_string_append_view(s, constant.string_value);
+            lca_string_append_char(s, '"');
         } break;
     }
 }
@@ -748,59 +856,75 @@ void laye_type_print_to_string(laye_type type, lca_string* s, bool use_color) {
         } break;
 
         case LAYE_NODE_TYPE_POISON: {
-            lca_string_append_format(s, "%spoison", COL(COL_UNREAL));
+            lca_string_append_cstring(s, COL(COL_UNREAL));
+            lca_string_append_cstring(s, "poison");
         } break;
 
         case LAYE_NODE_TYPE_UNKNOWN: {
-            lca_string_append_format(s, "%sunknown", COL(COL_UNREAL));
+            lca_string_append_cstring(s, COL(COL_UNREAL));
+            lca_string_append_cstring(s, "unknown");
         } break;
 
         case LAYE_NODE_TYPE_VAR: {
-            lca_string_append_format(s, "%svar", COL(COL_UNREAL));
+            lca_string_append_cstring(s, COL(COL_UNREAL));
+            lca_string_append_cstring(s, "var");
         } break;
 
         case LAYE_NODE_TYPE_TYPE: {
-            lca_string_append_format(s, "%stype", COL(COL_KEYWORD));
+            lca_string_append_cstring(s, COL(COL_KEYWORD));
+            lca_string_append_cstring(s, "type");
         } break;
 
         case LAYE_NODE_TYPE_VOID: {
-            lca_string_append_format(s, "%svoid", COL(COL_KEYWORD));
+            lca_string_append_cstring(s, COL(COL_KEYWORD));
+            lca_string_append_cstring(s, "void");
         } break;
 
         case LAYE_NODE_TYPE_NORETURN: {
-            lca_string_append_format(s, "%snoreturn", COL(COL_KEYWORD));
+            lca_string_append_cstring(s, COL(COL_KEYWORD));
+            lca_string_append_cstring(s, "noreturn");
         } break;
 
         case LAYE_NODE_TYPE_BOOL: {
-            lca_string_append_format(s, "%sbool", COL(COL_KEYWORD));
+            lca_string_append_cstring(s, COL(COL_KEYWORD));
+            lca_string_append_cstring(s, "bool");
         } break;
 
         case LAYE_NODE_TYPE_INT: {
             if (type.node->type_primitive.is_platform_specified) {
-                lca_string_append_format(s, "%s%sint", COL(COL_KEYWORD), (type.node->type_primitive.is_signed ? "" : "u"));
+                lca_string_append_cstring(s, COL(COL_KEYWORD));
+                lca_string_append_cstring(s, (type.node->type_primitive.is_signed ? "" : "u"));
+                lca_string_append_cstring(s, "int");
             } else {
-                lca_string_append_format(s, "%s%s%d", COL(COL_KEYWORD), (type.node->type_primitive.is_signed ? "i" : "u"), type.node->type_primitive.bit_width);
+                lca_string_append_cstring(s, COL(COL_KEYWORD));
+                lca_string_append_cstring(s, (type.node->type_primitive.is_signed ? "i" : "u"));
+                lca_string_append_int(s, type.node->type_primitive.bit_width);
             }
         } break;
 
         case LAYE_NODE_TYPE_FLOAT: {
             if (type.node->type_primitive.is_platform_specified) {
-                lca_string_append_format(s, "%sfloat", COL(COL_KEYWORD));
+                lca_string_append_cstring(s, COL(COL_KEYWORD));
+                lca_string_append_cstring(s, "float");
             } else {
-                lca_string_append_format(s, "%sf%d", COL(COL_KEYWORD), type.node->type_primitive.bit_width);
+                lca_string_append_cstring(s, COL(COL_KEYWORD));
+                lca_string_append_char(s, 'f');
+                lca_string_append_int(s, type.node->type_primitive.bit_width);
             }
         } break;
 
         case LAYE_NODE_TYPE_TEMPLATE_PARAMETER: {
             assert(type.node->type_template_parameter.declaration != NULL);
-            lca_string_append_format(s, "%s%.*s", COL(COL_TEMPLATE_PARAM), LCA_STR_EXPAND(type.node->type_template_parameter.declaration->declared_name));
+            lca_string_append_cstring(s, COL(COL_TEMPLATE_PARAM));
+            lca_string_append_view(s, type.node->type_template_parameter.declaration->declared_name);
         } break;
 
         case LAYE_NODE_TYPE_ERROR_PAIR: {
             assert(type.node->type_error_pair.error_type.node != NULL);
             assert(type.node->type_error_pair.value_type.node != NULL);
             laye_type_print_to_string(type.node->type_error_pair.error_type, s, use_color);
-            lca_string_append_format(s, "%s!", COL(COL_DELIM));
+            lca_string_append_cstring(s, COL(COL_DELIM));
+            lca_string_append_char(s, '!');
             laye_type_print_to_string(type.node->type_error_pair.value_type, s, use_color);
         } break;
 
@@ -809,24 +933,32 @@ void laye_type_print_to_string(laye_type type, lca_string* s, bool use_color) {
             break;
 
             if (type.node->nameref.kind == LAYE_NAMEREF_HEADLESS) {
-                lca_string_append_format(s, "%s::", COL(COL_DELIM));
+                lca_string_append_cstring(s, COL(COL_DELIM));
+                lca_string_append_cstring(s, "::");
             } else if (type.node->nameref.kind == LAYE_NAMEREF_GLOBAL) {
-                lca_string_append_format(s, "%sglobal%s::", COL(COL_KEYWORD), COL(COL_DELIM));
+                lca_string_append_cstring(s, COL(COL_KEYWORD));
+                lca_string_append_cstring(s, "global");
+                lca_string_append_cstring(s, COL(COL_DELIM));
+                lca_string_append_cstring(s, "::");
             }
 
             for (int64_t i = 0, count = lca_da_count(type.node->nameref.pieces); i < count; i++) {
                 if (i > 0) {
-                    lca_string_append_format(s, "%s::", COL(COL_DELIM));
+                    lca_string_append_cstring(s, COL(COL_DELIM));
+                    lca_string_append_cstring(s, "::");
                 }
 
-                lca_string_append_format(s, "%s%.*s", COL(COL_NAME), LCA_STR_EXPAND(type.node->nameref.pieces[i].string_value));
+                lca_string_append_cstring(s, COL(COL_NAME));
+                lca_string_append_view(s, type.node->nameref.pieces[i].string_value);
             }
 
             if (0 != lca_da_count(type.node->nameref.template_arguments)) {
-                lca_string_append_format(s, "%s<", COL(COL_DELIM));
+                lca_string_append_cstring(s, COL(COL_DELIM));
+                lca_string_append_char(s, '<');
                 for (int64_t i = 0, count = lca_da_count(type.node->nameref.template_arguments); i < count; i++) {
                     if (i > 0) {
-                        lca_string_append_format(s, "%s, ", COL(COL_DELIM));
+                        lca_string_append_cstring(s, COL(COL_DELIM));
+                        lca_string_append_cstring(s, ", ");
                     }
 
                     laye_template_arg template_argument = type.node->nameref.template_arguments[i];
@@ -835,56 +967,68 @@ void laye_type_print_to_string(laye_type type, lca_string* s, bool use_color) {
                     } else if (template_argument.node->kind == LAYE_NODE_EVALUATED_CONSTANT) {
                         laye_constant_print_to_string(template_argument.node->evaluated_constant.result, s, use_color);
                     } else {
-                        lca_string_append_format(s, "%s{?}", COL(COL_ERROR));
+                        lca_string_append_cstring(s, COL(COL_ERROR));
+                        lca_string_append_cstring(s, "{?}");
                     }
                 }
 
-                lca_string_append_format(s, "%s>", COL(COL_DELIM));
+                lca_string_append_cstring(s, COL(COL_DELIM));
+                lca_string_append_char(s, '>');
             }
 
             if (type.node->nameref.referenced_type != NULL) {
-                lca_string_append_format(s, " %s%016llX", COL(COL_ADDR), (size_t)type.node->nameref.referenced_type);
+                lca_string_append_char(s, ' ');
+                lca_string_append_cstring(s, COL(COL_ADDR));
+                lca_string_append_hex(s, (size_t)type.node->nameref.referenced_type, 16);
             }
         } break;
 
         case LAYE_NODE_TYPE_FUNCTION: {
             laye_type_print_to_string(type.node->type_function.return_type, s, use_color);
 
-            lca_string_append_format(s, "%s(", COL(COL_DELIM));
+            lca_string_append_cstring(s, COL(COL_DELIM));
+            lca_string_append_char(s, '(');
             for (int64_t i = 0, count = lca_da_count(type.node->type_function.parameter_types); i < count; i++) {
                 if (i > 0) {
-                    lca_string_append_format(s, "%s, ", COL(COL_DELIM));
+                    lca_string_append_cstring(s, COL(COL_DELIM));
+                    lca_string_append_cstring(s, ", ");
                 }
 
                 laye_type_print_to_string(type.node->type_function.parameter_types[i], s, use_color);
             }
 
-            lca_string_append_format(s, "%s)", COL(COL_DELIM));
+            lca_string_append_cstring(s, COL(COL_DELIM));
+            lca_string_append_char(s, ')');
         } break;
 
         case LAYE_NODE_TYPE_REFERENCE: {
             laye_type_print_to_string(type.node->type_container.element_type, s, use_color);
-            lca_string_append_format(s, "%s&", COL(COL_DELIM));
+            lca_string_append_cstring(s, COL(COL_DELIM));
+            lca_string_append_char(s, '&');
         } break;
 
         case LAYE_NODE_TYPE_POINTER: {
             laye_type_print_to_string(type.node->type_container.element_type, s, use_color);
-            lca_string_append_format(s, "%s*", COL(COL_DELIM));
+            lca_string_append_cstring(s, COL(COL_DELIM));
+            lca_string_append_char(s, '*');
         } break;
 
         case LAYE_NODE_TYPE_BUFFER: {
             laye_type_print_to_string(type.node->type_container.element_type, s, use_color);
-            lca_string_append_format(s, "%s[*]", COL(COL_DELIM));
+            lca_string_append_cstring(s, COL(COL_DELIM));
+            lca_string_append_cstring(s, "[*]");
         } break;
 
         case LAYE_NODE_TYPE_SLICE: {
             laye_type_print_to_string(type.node->type_container.element_type, s, use_color);
-            lca_string_append_format(s, "%s[]", COL(COL_DELIM));
+            lca_string_append_cstring(s, COL(COL_DELIM));
+            lca_string_append_cstring(s, "[]");
         } break;
 
         case LAYE_NODE_TYPE_ARRAY: {
             laye_type_print_to_string(type.node->type_container.element_type, s, use_color);
-            lca_string_append_format(s, "%s[", COL(COL_DELIM));
+            lca_string_append_cstring(s, COL(COL_DELIM));
+            lca_string_append_char(s, '[');
             for (int i = 0, count = lca_da_count(type.node->type_container.length_values); i < count; i++) {
                 laye_node* length_value = type.node->type_container.length_values[i];
                 assert(length_value != NULL);
@@ -898,30 +1042,38 @@ void laye_type_print_to_string(laye_type type, lca_string* s, bool use_color) {
                         } break;
 
                         case LYIR_EVAL_INT: {
-                            lca_string_append_format(s, "%s%lld", COL(COL_CONST), constant.int_value);
+                            lca_string_append_cstring(s, COL(COL_CONST));
+                            lca_string_append_int(s, constant.int_value);
                         } break;
 
                         case LYIR_EVAL_FLOAT: {
-                            lca_string_append_format(s, "%s%f", COL(COL_CONST), constant.float_value);
+                            lca_string_append_cstring(s, COL(COL_CONST));
+                            lca_string_append_double(s, constant.float_value);
                         } break;
                     }
                 } else if (length_value->kind == LAYE_NODE_LITINT) {
-                    lca_string_append_format(s, "%s%lld", COL(COL_CONST), length_value->litint.value);
+                    lca_string_append_cstring(s, COL(COL_CONST));
+                    lca_string_append_int(s, length_value->litint.value);
                 } else {
-                    lca_string_append_format(s, "%s<expr>", COL(COL_CONST), length_value->litint.value);
+                    lca_string_append_cstring(s, COL(COL_CONST));
+                    lca_string_append_cstring(s, "<expr>");
                 }
             }
-            lca_string_append_format(s, "%s]", COL(COL_DELIM));
+            lca_string_append_cstring(s, COL(COL_DELIM));
+            lca_string_append_char(s, ']');
         } break;
 
         case LAYE_NODE_TYPE_STRUCT: {
-            lca_string_append_format(s, "%s%.*s", COL(COL_NAME), LCA_STR_EXPAND(type.node->type_struct.name));
+            lca_string_append_cstring(s, COL(COL_NAME));
+            lca_string_append_view(s, type.node->type_struct.name);
         } break;
     }
 
     if (type.is_modifiable) {
-        lca_string_append_format(s, " %smut", COL(COL_KEYWORD));
+        lca_string_append_char(s, ' ');
+        lca_string_append_cstring(s, COL(COL_KEYWORD));
+        lca_string_append_cstring(s, "mut");
     }
 
-    lca_string_append_format(s, "%s", COL(RESET));
+    lca_string_append_cstring(s, COL(RESET));
 }
@@ -46,79 +46,55 @@ typedef enum laye_builtin_runtime_function {
     LAYE_RUNTIME_ASSERT_FUNCTION,
 } laye_builtin_runtime_function;
 
-typedef enum laye_irvalue_kv_kind {
-    LAYE_IRKV_NODE,
-    LAYE_IRKV_BUILTIN,
-} laye_irvalue_kv_kind;
-
-typedef struct laye_irvalue_kv {
-    laye_irvalue_kv_kind kind;
+// keys are compared by their bytes, so the key types are made of pointer-sized fields only and have no padding.
+typedef struct laye_irvalue_node_key {
+    laye_module* module;
+    laye_node* node;
+} laye_irvalue_node_key;
 
+typedef struct laye_irvalue_builtin_key {
     laye_module* module;
-    union {
-        laye_node* node;
-        laye_builtin_runtime_function builtin;
-    };
+    int64_t builtin;
+} laye_irvalue_builtin_key;
 
-    lyir_value* value;
-} laye_irvalue_kv;
+typedef struct laye_irgen_namespace_key {
+    laye_module* module;
+    laye_symbol* symbol_namespace;
+} laye_irgen_namespace_key;
 
 typedef struct laye_irgen {
     laye_context* context;
-    lca_da(laye_irvalue_kv) ir_values;
+    // the IR value generated for each declaration or parameter node, per module.
+    lca_hashmap(laye_irvalue_node_key, lyir_value*) node_values;
+    // the runtime functions declared so far, per module.
+    lca_hashmap(laye_irvalue_builtin_key, lyir_value*) builtin_values;
+    // the imported namespaces whose declarations have been generated, per module.
+    // namespaces are shared between imports, so the same one can be reached more than once.
+    lca_hashmap(laye_irgen_namespace_key, bool) generated_namespaces;
 } laye_irgen;
 
-// NOTE(local): this pointer can and will move, it should never be stored
-static laye_irvalue_kv* laye_irgen_irvalue_kv_get_for_node(laye_irgen* irgen, laye_module* module, laye_node* node) {
-    for (int64_t i = 0, count = lca_da_count(irgen->ir_values); i < count; i++) {
-        laye_irvalue_kv* kv = &irgen->ir_values[i];
-        if (kv->kind == LAYE_IRKV_NODE && kv->module == module && kv->node == node)
-            return kv;
-    }
-
-    laye_irvalue_kv kv = {
-        .kind = LAYE_IRKV_NODE,
-        .module = module,
-        .node = node,
-    };
-
-    lca_da_push(irgen->ir_values, kv);
-    return lca_da_back(irgen->ir_values);
-}
-
-static laye_irvalue_kv* laye_irgen_irvalue_kv_get_for_builtin(laye_irgen* irgen, laye_module* module, laye_builtin_runtime_function builtin) {
-    for (int64_t i = 0, count = lca_da_count(irgen->ir_values); i < count; i++) {
-        laye_irvalue_kv* kv = &irgen->ir_values[i];
-        if (kv->kind == LAYE_IRKV_BUILTIN && kv->module == module && kv->builtin == builtin)
-            return kv;
-    }
-
-    laye_irvalue_kv kv = {
-        .kind = LAYE_IRKV_BUILTIN,
-        .module = module,
-        .builtin = builtin,
-    };
-
-    lca_da_push(irgen->ir_values, kv);
-    return lca_da_back(irgen->ir_values);
-}
-
 static lyir_value* laye_irgen_ir_value_get(laye_irgen* irgen, laye_module* module, laye_node* node) {
-    return laye_irgen_irvalue_kv_get_for_node(irgen, module, node)->value;
+    laye_irvalue_node_key key = {.module = module, .node = node};
+    __typeof__(irgen->node_values) entry = lca_hashmap_find(irgen->node_values, key);
+    return entry == NULL ? NULL : entry->value;
 }
 
 static lyir_value* laye_irgen_ir_value_get_builtin(laye_irgen* irgen, laye_module* module, laye_builtin_runtime_function builtin) {
-    return laye_irgen_irvalue_kv_get_for_builtin(irgen, module, builtin)->value;
+    laye_irvalue_builtin_key key = {.module = module, .builtin = builtin};
+    __typeof__(irgen->builtin_values) entry = lca_hashmap_find(irgen->builtin_values, key);
+    return entry == NULL ? NULL : entry->value;
 }
 
 static void laye_irgen_ir_value_set(laye_irgen* irgen, laye_module* module, laye_node* node, lyir_value* value) {
     assert(value != NULL);
-    laye_irgen_irvalue_kv_get_for_node(irgen, module, node)->value = value;
+    laye_irvalue_node_key key = {.module = module, .node = node};
+    lca_hashmap_set(irgen->node_values, key, value);
 }
 
 static void laye_irgen_ir_value_set_builtin(laye_irgen* irgen, laye_module* module, laye_builtin_runtime_function builtin, lyir_value* value) {
     assert(value != NULL);
-    laye_irgen_irvalue_kv_get_for_builtin(irgen, module, builtin)->value = value;
+    laye_irvalue_builtin_key key = {.module = module, .builtin = builtin};
+    lca_hashmap_set(irgen->builtin_values, key, value);
 }
 
 static lyir_type* laye_convert_type(laye_type type);
@@ -196,7 +172,24 @@ static void laye_irgen_generate_imported_function_declarations(laye_irgen* irgen
     assert(from_namespace != NULL);
     assert(from_namespace->kind == LAYE_SYMBOL_NAMESPACE);
 
-    for (int64_t symbol_index = 0, symbol_count = lca_da_count(from_namespace->symbols); symbol_index < symbol_count; symbol_index++) {
+    laye_irgen_namespace_key key = {.module = module, .symbol_namespace = from_namespace};
+    if (lca_hashmap_contains(irgen->generated_namespaces, key)) {
+        return;
+    }
+
+    lca_hashmap_set(irgen->generated_namespaces, key, true);
+
+    int64_t include_index = 0, include_count = lca_da_count(from_namespace->included_namespaces);
+    for (int64_t symbol_index = 0, symbol_count = lca_da_count(from_namespace->symbols); symbol_index <= symbol_count; symbol_index++) {
+        // included namespaces are visited where they were included, which keeps declarations in import order.
+        for (; include_index < include_count && from_namespace->included_namespaces[include_index].position == symbol_index; include_index++) {
+            laye_irgen_generate_imported_function_declarations(irgen, module, from_namespace->included_namespaces[include_index].symbol_namespace);
+        }
+
+        if (symbol_index == symbol_count) {
+            break;
+        }
+
         laye_symbol* symbol = from_namespace->symbols[symbol_index];
         assert(symbol != NULL);
 
@@ -214,14 +207,16 @@ static void laye_irgen_generate_imported_function_declarations(laye_irgen* irgen
             // assert(node->ir_value != NULL);
         }
     }
+
+    assert(include_index == include_count);
 }
 
 static lyir_value* laye_irgen_get_runtime_assert_function(laye_irgen* irgen, laye_module* module) {
     assert(irgen != NULL);
     assert(module != NULL);
 
-    laye_irvalue_kv* kv = laye_irgen_irvalue_kv_get_for_builtin(irgen, module, LAYE_RUNTIME_ASSERT_FUNCTION);
-    if (kv->value == NULL) {
+    lyir_value* assert_function = laye_irgen_ir_value_get_builtin(irgen, module, LAYE_RUNTIME_ASSERT_FUNCTION);
+    if (assert_function == NULL) {
         laye_context* context = module->context;
 
         lca_da(lyir_type*) parameter_types = NULL;
@@ -233,7 +228,7 @@ static lyir_value* laye_irgen_get_runtime_assert_function(laye_irgen* irgen, lay
         lca_da_push(parameter_types, laye_convert_type(LTY(context->laye_types.i8_buffer)));
 
         lyir_type* function_type = lyir_function_type(context->lyir_context, lyir_void_type(context->lyir_context), parameter_types, LYIR_CCC, false);
-        kv->value = lyir_module_create_function(
+        assert_function = lyir_module_create_function(
             module->ir_module,
             (lyir_location){0},
             LCA_SV_CONSTANT("__laye_assert_fail"),
@@ -241,10 +236,12 @@ static lyir_value* laye_irgen_get_runtime_assert_function(laye_irgen* irgen, lay
             NULL,
             LYIR_LINK_REEXPORTED
         );
+
+        laye_irgen_ir_value_set_builtin(irgen, module, LAYE_RUNTIME_ASSERT_FUNCTION, assert_function);
     }
 
-    assert(kv->value != NULL);
-    return kv->value;
+    assert(assert_function != NULL);
+    return assert_function;
 }
 
 void laye_generate_ir(laye_context* context) {
@@ -291,7 +288,9 @@ void laye_generate_ir(laye_context* context) {
             laye_node* top_level_node = module->top_level_nodes[i];
             assert(top_level_node != NULL);
 
+            lca_arena_mark temp_mark = lca_temp_mark();
             laye_irgen_generate_declaration(&irgen, module, top_level_node);
+            lca_temp_restore(temp_mark);
             // assert(top_level_node->ir_value != NULL);
         }
     }
@@ -354,7 +353,9 @@ void laye_generate_ir(laye_context* context) {
         lyir_builder_destroy(builder);
     }
 
-    lca_da_free(irgen.ir_values);
+    lca_hashmap_free(irgen.node_values);
+    lca_hashmap_free(irgen.builtin_values);
+    lca_hashmap_free(irgen.generated_namespaces);
 }
 
 static lyir_type* laye_convert_type(laye_type type) {
@@ -436,10 +437,8 @@ static lyir_type* laye_convert_type(laye_type type) {
         }
 
         case LAYE_NODE_TYPE_STRUCT: {
-            for (int64_t i = 0, count = lca_da_count(context->_all_struct_types); i < count; i++) {
-                if (context->_all_struct_types[i].node == type.node) {
-                    return context->_all_struct_types[i].type;
-                }
+            if (type.node->type_struct.cached_lyir_type != NULL) {
+                return type.node->type_struct.cached_lyir_type;
             }
 
             int64_t field_count = lca_da_count(type.node->type_struct.fields);
@@ -455,12 +454,7 @@ static lyir_type* laye_convert_type(laye_type type) {
             lyir_type* struct_type = lyir_struct_type(context->lyir_context, type.node->type_struct.name, fields);
             assert(struct_type != NULL);
 
-            struct cached_struct_type t = {
-                .node = type.node,
-                .type = struct_type,
-            };
-            lca_da_push(context->_all_struct_types, t);
-
+            type.node->type_struct.cached_lyir_type = struct_type;
             return struct_type;
         }
     }
@@ -1612,6 +1606,7 @@ static lyir_value* laye_generate_node(laye_irgen* irgen, lyir_builder* builder,
             }
 
             lca_da(lyir_value*) argument_values = NULL;
+            lca_da_reserve_exact(argument_values, lca_da_count(node->call.arguments));
             for (int64_t i = 0, count = lca_da_count(node->call.arguments); i < count; i++) {
                 lyir_value* argument_value = laye_generate_node(irgen, builder, node->call.arguments[i]);
                 lca_da_push(argument_values, argument_value);
@@ -1731,7 +1726,10 @@ static lyir_value* laye_generate_node(laye_irgen* irgen, lyir_builder* builder,
             lyir_type* type = laye_convert_type(node->type);
             assert(type != NULL);
 
-            if (node->evaluated_constant.result.kind == LYIR_EVAL_INT) {
+            if (node->evaluated_constant.result.kind == LYIR_EVAL_BOOL) {
+                assert(lyir_type_is_integer(type));
+                return lyir_int_constant_create(context, node->location, type, node->evaluated_constant.result.bool_value ? 1 : 0);
+            } else if (node->evaluated_constant.result.kind == LYIR_EVAL_INT) {
                 assert(lyir_type_is_integer(type));
                 return lyir_int_constant_create(context, node->location, type, node->evaluated_constant.result.int_value);
             } else if (node->evaluated_constant.result.kind == LYIR_EVAL_FLOAT) {
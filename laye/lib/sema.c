@@ -72,11 +72,13 @@ static void laye_sema_lvalue_to_rvalue(laye_sema* sema, laye_node** node, bool s
 static bool laye_sema_implicit_dereference(laye_sema* sema, laye_node** node);
 static bool laye_sema_implicit_de_reference(laye_sema* sema, laye_node** node);
 
-static laye_type laye_sema_get_pointer_to_type(laye_sema* sema, laye_type element_type, bool is_modifiable);
-static laye_type laye_sema_get_buffer_of_type(laye_sema* sema, laye_type element_type, bool is_modifiable);
-static laye_type laye_sema_get_reference_to_type(laye_sema* sema, laye_type element_type, bool is_modifiable);
+// pointer, buffer and reference types are derived once per module and element type, and shared after that.
+static laye_type laye_sema_get_pointer_to_type(laye_sema* sema, laye_module* module, laye_type element_type, bool is_modifiable);
+static laye_type laye_sema_get_buffer_of_type(laye_sema* sema, laye_module* module, laye_type element_type, bool is_modifiable);
+static laye_type laye_sema_get_reference_to_type(laye_sema* sema, laye_module* module, laye_type element_type, bool is_modifiable);
 
 static laye_node* laye_create_constant_node(laye_sema* sema, laye_node* node, lyir_evaluated_constant eval_result);
+static void laye_sema_fold_constant(laye_sema* sema, laye_node** node_ref);
 
 // TODO(local): redeclaration of a name as an import namespace should be a semantic error. They can't participate in overload resolution,
 // so should just be disallowed for simplicity.
@@ -91,6 +93,51 @@ static bool laye_sema_is_errored(laye_node* node) {
     return (node->dependence & LAYE_DEPENDENCE_ERROR) != 0;
 }
 
+static bool laye_sema_symbols_are_same(laye_symbol* a, laye_symbol* b) {
+    if (a == b) return true;
+    if (a->kind != LAYE_SYMBOL_ENTITY || b->kind != LAYE_SYMBOL_ENTITY) return false;
+
+    // separate symbols can still refer to the same declarations, like when a module re-exports what it imports.
+    if (lca_da_count(a->nodes) != lca_da_count(b->nodes)) return false;
+    for (int64_t i = 0, count = lca_da_count(a->nodes); i < count; i++) {
+        if (a->nodes[i] != b->nodes[i]) return false;
+    }
+
+    return true;
+}
+
+// looks up an imported name like `laye_symbol_lookup` does, but reports an error if the name is ambiguous:
+// every wildcard import includes the exports of another module, and nothing picks between two of them
+// which bring in different symbols with the same name. only the names that are looked up are checked.
+static laye_symbol* laye_sema_lookup_imported_symbol(lyir_context* lyir_context, laye_symbol* search_namespace, laye_token name_token, bool* is_ambiguous) {
+    assert(search_namespace != NULL);
+    assert(search_namespace->kind == LAYE_SYMBOL_NAMESPACE);
+    assert(is_ambiguous != NULL);
+
+    lca_string_view name = name_token.string_value;
+
+    laye_symbol* lookup = laye_symbol_lookup_declared(search_namespace, name);
+    if (lookup != NULL) {
+        return lookup;
+    }
+
+    for (int64_t i = 0, count = lca_da_count(search_namespace->included_namespaces); i < count && !*is_ambiguous; i++) {
+        laye_symbol* included_lookup = laye_sema_lookup_imported_symbol(lyir_context, search_namespace->included_namespaces[i].symbol_namespace, name_token, is_ambiguous);
+        if (included_lookup == NULL || *is_ambiguous) {
+            continue;
+        }
+
+        if (lookup == NULL) {
+            lookup = included_lookup;
+        } else if (!laye_sema_symbols_are_same(lookup, included_lookup)) {
+            lyir_write_error(lyir_context, name_token.location, "The name '%.*s' is ambiguous, more than one wildcard import provides it.", LCA_STR_EXPAND(name));
+            *is_ambiguous = true;
+        }
+    }
+
+    return lookup;
+}
+
 static laye_node* laye_sema_lookup_entity(laye_module* from_module, laye_nameref nameref, bool is_type_entity) {
     assert(from_module != NULL);
     assert(from_module->context != NULL);
@@ -131,14 +178,10 @@ static laye_node* laye_sema_lookup_entity(laye_module* from_module, laye_nameref
             laye_token name_piece_token = nameref.pieces[name_index];
             lca_string_view name_piece = name_piece_token.string_value;
 
-            laye_symbol* symbol_matching = NULL;
-            for (int64_t symbol_index = 0, symbol_count = lca_da_count(search_namespace->symbols); symbol_index < symbol_count && symbol_matching == NULL; symbol_index++) {
-                laye_symbol* symbol_imported = search_namespace->symbols[symbol_index];
-                assert(symbol_imported != NULL);
-
-                if (lca_string_view_equals(symbol_imported->name, name_piece)) {
-                    symbol_matching = symbol_imported;
-                }
+            bool is_ambiguous = false;
+            laye_symbol* symbol_matching = laye_sema_lookup_imported_symbol(lyir_context, search_namespace, name_piece_token, &is_ambiguous);
+            if (is_ambiguous) {
+                return NULL;
             }
 
             if (symbol_matching == NULL) {
@@ -332,33 +375,6 @@ static lca_string_view import_string_to_laye_identifier_string(laye_node* import
     return module_name;
 }
 
-static void laye_sema_add_symbol_shallow_copy(laye_module* module, laye_symbol* namespace_symbol, laye_symbol* symbol) {
-    laye_symbol* existing_symbol = laye_symbol_lookup(namespace_symbol, symbol->name);
-    if (existing_symbol == NULL) {
-        existing_symbol = laye_symbol_create(module, symbol->kind, symbol->name);
-        lca_da_push(namespace_symbol->symbols, existing_symbol);
-    }
-
-    assert(existing_symbol != NULL);
-    assert(existing_symbol->kind == symbol->kind);
-
-    if (symbol->kind == LAYE_SYMBOL_NAMESPACE) {
-        assert(existing_symbol->kind == LAYE_SYMBOL_NAMESPACE);
-        // this node should also be freshly created
-        assert(lca_da_count(existing_symbol->symbols) == 0);
-
-        for (int64_t j = 0, j_count = lca_da_count(symbol->symbols); j < j_count; j++) {
-            lca_da_push(existing_symbol->symbols, symbol->symbols[j]);
-        }
-    } else {
-        assert(existing_symbol->kind == LAYE_SYMBOL_ENTITY);
-
-        for (int64_t j = 0, j_count = lca_da_count(symbol->nodes); j < j_count; j++) {
-            lca_da_push(existing_symbol->nodes, symbol->nodes[j]);
-        }
-    }
-}
-
 static void laye_sema_resolve_import_query(laye_context* laye_context, laye_module* module, laye_module* queried_module, laye_node* query, bool export) {
     assert(laye_context != NULL);
     assert(module != NULL);
@@ -371,49 +387,13 @@ static void laye_sema_resolve_import_query(laye_context* laye_context, laye_modu
     laye_symbol* search_namespace = search_module->exports;
 
     if (query->import_query.is_wildcard) {
-        for (int64_t i = 0, count = lca_da_count(search_namespace->symbols); i < count; i++) {
-            laye_symbol* exported_symbol = search_namespace->symbols[i];
-            assert(exported_symbol != NULL);
-            assert(exported_symbol->name.count > 0);
-
-            laye_symbol* imported_symbol = laye_symbol_lookup(module->imports, exported_symbol->name);
-            if (imported_symbol == NULL) {
-                imported_symbol = laye_symbol_create(module, exported_symbol->kind, exported_symbol->name);
-                assert(imported_symbol != NULL);
-                lca_da_push(module->imports->symbols, imported_symbol);
-            } else {
-                if (exported_symbol->kind == LAYE_SYMBOL_NAMESPACE) {
-                    lyir_write_error(lyir_context, query->location, "Wildcard imports symbol '%.*s', which is a namespace. This symbol has already been declared, and namespace names cannot be overloaded.");
-                    continue;
-                }
-
-                if (imported_symbol->kind == LAYE_SYMBOL_NAMESPACE) {
-                    lyir_write_error(lyir_context, query->location, "Wildcard imports symbol '%.*s', which was previously imported as a namespace. Namespace names cannot be overloaded.");
-                    continue;
-                }
-            }
-
-            assert(imported_symbol != NULL);
-
-            if (exported_symbol->kind == LAYE_SYMBOL_NAMESPACE) {
-                assert(imported_symbol->kind == LAYE_SYMBOL_NAMESPACE);
-                // this node should also be freshly created
-                assert(lca_da_count(imported_symbol->symbols) == 0);
-
-                for (int64_t j = 0, j_count = lca_da_count(exported_symbol->symbols); j < j_count; j++) {
-                    lca_da_push(imported_symbol->symbols, exported_symbol->symbols[j]);
-                }
-            } else {
-                assert(imported_symbol->kind == LAYE_SYMBOL_ENTITY);
+        // the exports are not copied, they are shared with every other module which imports them.
+        // symbols declared in the importing namespace shadow them, and names which more than one
+        // wildcard import provides are only reported when they are used.
+        laye_symbol_namespace_include(module->imports, search_namespace);
 
-                for (int64_t j = 0, j_count = lca_da_count(exported_symbol->nodes); j < j_count; j++) {
-                    lca_da_push(imported_symbol->nodes, exported_symbol->nodes[j]);
-                }
-            }
-
-            if (export) {
-                laye_sema_add_symbol_shallow_copy(module, module->exports, imported_symbol);
-            }
+        if (export) {
+            laye_symbol_namespace_include(module->exports, search_namespace);
         }
     } else {
         assert(lca_da_count(query->import_query.pieces) > 0);
@@ -442,15 +422,10 @@ static void laye_sema_resolve_import_query(laye_context* laye_context, laye_modu
 
             assert(search_namespace->kind == LAYE_SYMBOL_NAMESPACE);
 
-            laye_symbol* found_lookup_symbol = NULL;
-            for (int64_t j = 0, j_count = lca_da_count(search_namespace->symbols); j < j_count; j++) {
-                laye_symbol* search_symbol = search_namespace->symbols[j];
-                assert(search_symbol != NULL);
-
-                if (lca_string_view_equals(search_symbol->name, search_name)) {
-                    found_lookup_symbol = search_symbol;
-                    break;
-                }
+            bool is_ambiguous = false;
+            laye_symbol* found_lookup_symbol = laye_sema_lookup_imported_symbol(lyir_context, search_namespace, search_token, &is_ambiguous);
+            if (is_ambiguous) {
+                break;
             }
 
             if (found_lookup_symbol == NULL) {
@@ -480,11 +455,11 @@ static void laye_sema_resolve_import_query(laye_context* laye_context, laye_modu
             query_result_name = query->import_query.pieces[lca_da_count(query->import_query.pieces) - 1].string_value;
         }
 
-        laye_symbol* imported_symbol = laye_symbol_lookup(module->imports, query_result_name);
+        laye_symbol* imported_symbol = laye_symbol_lookup_declared(module->imports, query_result_name);
         if (imported_symbol == NULL) {
             imported_symbol = laye_symbol_create(module, resolved_symbol->kind, query_result_name);
             assert(imported_symbol != NULL);
-            lca_da_push(module->imports->symbols, imported_symbol);
+            laye_symbol_namespace_add(module->imports, imported_symbol);
         } else {
             if (resolved_symbol->kind == LAYE_SYMBOL_NAMESPACE) {
                 lyir_write_error(lyir_context, query->location, "Query imports symbol '%.*s', which is a namespace. This symbol has already been declared, and namespace names cannot be overloaded.");
@@ -501,10 +476,9 @@ static void laye_sema_resolve_import_query(laye_context* laye_context, laye_modu
             assert(imported_symbol->kind == LAYE_SYMBOL_NAMESPACE);
             // this node should also be freshly created
             assert(lca_da_count(imported_symbol->symbols) == 0);
+            assert(lca_da_count(imported_symbol->included_namespaces) == 0);
 
-            for (int64_t j = 0, j_count = lca_da_count(resolved_symbol->symbols); j < j_count; j++) {
-                lca_da_push(imported_symbol->symbols, resolved_symbol->symbols[j]);
-            }
+            laye_symbol_namespace_include(imported_symbol, resolved_symbol);
         } else {
             assert(imported_symbol->kind == LAYE_SYMBOL_ENTITY);
 
@@ -668,30 +642,26 @@ static void laye_sema_build_module_symbol_tables(laye_module* module) {
                     lca_string_view module_name = import_string_to_laye_identifier_string(top_level_node);
                     assert(module_name.count > 0);
 
-                    if (laye_symbol_lookup(module->imports, module_name) != NULL) {
+                    if (laye_symbol_lookup_declared(module->imports, module_name) != NULL) {
                         lyir_write_error(lyir_context, top_level_node->location, "Redeclaration of name '%.*s'.", LCA_STR_EXPAND(module_name));
                     } else {
                         laye_symbol* import_scope = laye_symbol_create(module, LAYE_SYMBOL_NAMESPACE, module_name);
                         assert(import_scope != NULL);
 
-                        lca_da_push(module->imports->symbols, import_scope);
+                        laye_symbol_namespace_add(module->imports, import_scope);
 
                         if (is_export_import) {
-                            assert(laye_symbol_lookup(module->exports, module_name) == NULL && "somehow, this module already exports something with the same name");
-                            lca_da_push(module->exports->symbols, import_scope);
+                            assert(laye_symbol_lookup_declared(module->exports, module_name) == NULL && "somehow, this module already exports something with the same name");
+                            laye_symbol_namespace_add(module->exports, import_scope);
                         }
 
-                        // shallow-copy all of the referenced module's exports into this new scope for our own imports (and potentially exports)
+                        // the new namespace refers to the referenced module's exports rather than copying them,
+                        // so every module which imports it shares the same export table.
                         laye_module* referenced_module = top_level_node->decl_import.referenced_module;
                         assert(referenced_module != NULL);
                         assert(referenced_module->exports != NULL);
 
-                        for (int64_t export_index = 0, export_count = lca_da_count(referenced_module->exports->symbols); export_index < export_count; export_index++) {
-                            laye_symbol* imported_symbol = referenced_module->exports->symbols[export_index];
-                            assert(imported_symbol != NULL);
-                            assert(laye_symbol_lookup(import_scope, imported_symbol->name) == NULL);
-                            lca_da_push(import_scope->symbols, imported_symbol);
-                        }
+                        laye_symbol_namespace_include(import_scope, referenced_module->exports);
                     }
                 } else {
                     // no import namespaces, populate this scope directly
@@ -714,7 +684,7 @@ static void laye_sema_build_module_symbol_tables(laye_module* module) {
                     break;
                 }
 
-                laye_symbol* export_symbol = laye_symbol_lookup(module->exports, top_level_node->declared_name);
+                laye_symbol* export_symbol = laye_symbol_lookup_declared(module->exports, top_level_node->declared_name);
                 if (export_symbol != NULL) {
                     if (export_symbol->kind == LAYE_SYMBOL_NAMESPACE) {
                         lyir_write_error(lyir_context, top_level_node->location, "Redeclaration of symbol '%.*s', previously declared as a namespace.", LCA_STR_EXPAND(top_level_node->declared_name));
@@ -722,7 +692,7 @@ static void laye_sema_build_module_symbol_tables(laye_module* module) {
                     }
                 } else {
                     export_symbol = laye_symbol_create(module, LAYE_SYMBOL_ENTITY, top_level_node->declared_name);
-                    lca_da_push(module->exports->symbols, export_symbol);
+                    laye_symbol_namespace_add(module->exports, export_symbol);
                 }
 
                 assert(export_symbol != NULL);
@@ -769,6 +739,7 @@ void laye_analyse(laye_context* laye_context) {
             LCA_STR_EXPAND(lyir_context_get_source(lyir_context, to->sourceid).name)
         );
 
+        lyir_dependency_order_result_destroy(&import_order_result);
         return;
     }
 
@@ -787,7 +758,7 @@ void laye_analyse(laye_context* laye_context) {
         assert(module->exports != NULL);
     }
 
-    lca_da_free(ordered_modules);
+    lyir_dependency_order_result_destroy(&import_order_result);
 
     // TODO(local): somewhere in here, before sema is done, we have to check for redeclared symbols.
     // probably after top level types.
@@ -800,21 +771,47 @@ void laye_analyse(laye_context* laye_context) {
 
     lyir_dependency_order_result order_result = lyir_dependency_graph_get_ordered_entities(sema.dependencies);
     if (order_result.status == LYIR_DEP_CYCLE) {
-        lyir_write_error(
-            lyir_context,
-            ((laye_node*)order_result.from)->location,
-            "Cyclic dependency detected. %.*s depends on %.*s, and vice versa.",
-            LCA_STR_EXPAND(((laye_node*)order_result.from)->declared_name),
-            LCA_STR_EXPAND(((laye_node*)order_result.to)->declared_name)
-        );
+        lca_da(laye_node*) cycle = (lca_da(laye_node*))order_result.cycle;
+        int64_t cycle_count = lca_da_count(cycle);
+        assert(cycle_count > 0);
 
-        lyir_write_note(
-            lyir_context,
-            ((laye_node*)order_result.to)->location,
-            "%.*s declared here.",
-            LCA_STR_EXPAND(((laye_node*)order_result.to)->declared_name)
-        );
+        if (cycle_count <= 2) {
+            lyir_write_error(
+                lyir_context,
+                ((laye_node*)order_result.from)->location,
+                "Cyclic dependency detected. %.*s depends on %.*s, and vice versa.",
+                LCA_STR_EXPAND(((laye_node*)order_result.from)->declared_name),
+                LCA_STR_EXPAND(((laye_node*)order_result.to)->declared_name)
+            );
+
+            lyir_write_note(
+                lyir_context,
+                ((laye_node*)order_result.to)->location,
+                "%.*s declared here.",
+                LCA_STR_EXPAND(((laye_node*)order_result.to)->declared_name)
+            );
+        } else {
+            // report the whole cycle, one link at a time, so every declaration involved is pointed at.
+            lyir_write_error(
+                lyir_context,
+                cycle[0]->location,
+                "Cyclic dependency detected. %.*s depends on %.*s.",
+                LCA_STR_EXPAND(cycle[0]->declared_name),
+                LCA_STR_EXPAND(cycle[1]->declared_name)
+            );
+
+            for (int64_t i = 1; i < cycle_count; i++) {
+                lyir_write_note(
+                    lyir_context,
+                    cycle[i]->location,
+                    "%.*s depends on %.*s.",
+                    LCA_STR_EXPAND(cycle[i]->declared_name),
+                    LCA_STR_EXPAND(cycle[(i + 1) % cycle_count]->declared_name)
+                );
+            }
+        }
 
+        lyir_dependency_order_result_destroy(&order_result);
         return;
     }
 
@@ -825,22 +822,28 @@ void laye_analyse(laye_context* laye_context) {
     //     fprintf(stderr, ">>  %s :: %.*s\n", laye_node_kind_to_cstring(ordered_nodes[i]->kind), LCA_STR_EXPAND(ordered_nodes[i]->declared_name));
     // }
 
+    // temporary memory (diagnostic messages, mostly) is released after each declaration,
+    // so it never grows past what the largest declaration needs.
     for (int64_t i = 0, count = lca_da_count(ordered_nodes); i < count; i++) {
         laye_node* node = ordered_nodes[i];
         assert(node != NULL);
+        lca_arena_mark temp_mark = lca_temp_mark();
         // fprintf(stderr, ANSI_COLOR_BLUE "%016lX\n", (size_t)node);
         laye_sema_resolve_top_level_types(&sema, &node);
         assert(node != NULL);
+        lca_temp_restore(temp_mark);
     }
 
     for (int64_t i = 0, count = lca_da_count(ordered_nodes); i < count; i++) {
         laye_node* node = ordered_nodes[i];
         assert(node != NULL);
+        lca_arena_mark temp_mark = lca_temp_mark();
         laye_sema_analyse_node(&sema, &node, NOTY);
         assert(node != NULL);
+        lca_temp_restore(temp_mark);
     }
 
-    lca_da_free(ordered_nodes);
+    lyir_dependency_order_result_destroy(&order_result);
 }
 
 static laye_node* laye_sema_build_struct_type(laye_sema* sema, laye_node* node, laye_node* parent_struct) {
@@ -956,7 +959,7 @@ static void laye_sema_resolve_top_level_types(laye_sema* sema, laye_node** node_
 
             bool is_declared_main = lca_string_view_equals(LCA_SV_CONSTANT("main"), node->declared_name);
             bool has_foreign_name = node->attributes.foreign_name.count != 0;
-            bool has_body = lca_da_count(node->decl_function.body) != 0;
+            bool has_body = node->decl_function.body != NULL;
 
             if (is_declared_main && !has_foreign_name) {
                 node->attributes.calling_convention = LYIR_CCC;
@@ -1369,10 +1372,7 @@ static bool laye_sema_analyse_node(laye_sema* sema, laye_node** node_ref, laye_t
                     }
                 }
 
-                laye_type element_reference_type = LTY(laye_node_create(node->module, LAYE_NODE_TYPE_REFERENCE, node->foreach.element_binding->location, LTY(laye_context->laye_types.type)));
-                assert(element_reference_type.node != NULL);
-                element_reference_type.node->compiler_generated = true;
-                element_reference_type.node->type_container.element_type = iterable_type.node->type_container.element_type;
+                laye_type element_reference_type = laye_sema_get_reference_to_type(sema, node->module, iterable_type.node->type_container.element_type, false);
                 node->foreach.element_binding->declared_type = element_reference_type;
                 if (!laye_sema_analyse_node(sema, &node->foreach.element_binding, NOTY)) {
                     laye_sema_set_errored(node);
@@ -2044,8 +2044,7 @@ static bool laye_sema_analyse_node(laye_sema* sema, laye_node** node_ref, laye_t
                         break;
                     }
 
-                    assert(laye_type_is_pointer(node->type)); // from the parser, already constructed
-                    node->type.node->type_container.element_type = node->unary.operand->type;
+                    node->type = laye_sema_get_pointer_to_type(sema, node->module, node->unary.operand->type, false);
                 } break;
 
                 case '*': {
@@ -2446,6 +2445,7 @@ static bool laye_sema_analyse_node(laye_sema* sema, laye_node** node_ref, laye_t
 
             node->type_struct.cached_size = current_size;
             node->type_struct.cached_align = current_align;
+            laye_type_struct_cache_layout(LTY(node));
         } break;
     }
 
@@ -2466,6 +2466,11 @@ static bool laye_sema_analyse_node(laye_sema* sema, laye_node** node_ref, laye_t
     assert(node->type.node->kind != LAYE_NODE_INVALID);
     assert(node->type.node->kind != LAYE_NODE_TYPE_UNKNOWN);
 
+    laye_sema_fold_constant(sema, &node);
+    if (laye_node_is_type(node) && !laye_sema_is_errored(node)) {
+        laye_type_canonicalize(node);
+    }
+
     laye_compute_dependence(node);
 
     *node_ref = node;
@@ -2562,6 +2567,64 @@ static laye_node* laye_create_constant_node(laye_sema* sema, laye_node* node, ly
     return constant_node;
 }
 
+// replaces a unary, binary or explicit cast expression whose value is known at compile time with
+// that value, so irgen emits a single LYIR constant for it instead of an instruction sequence.
+// implicit casts are left alone, since conversion already turns constants into the target type.
+static void laye_sema_fold_constant(laye_sema* sema, laye_node** node_ref) {
+    assert(sema != NULL);
+    assert(node_ref != NULL);
+
+    laye_node* node = *node_ref;
+    assert(node != NULL);
+
+    if (node->sema_state != LYIR_SEMA_DONE || laye_sema_is_errored(node)) {
+        return;
+    }
+
+    if (node->kind == LAYE_NODE_CAST) {
+        if (node->cast.kind != LAYE_CAST_SOFT && node->cast.kind != LAYE_CAST_HARD) {
+            return;
+        }
+    } else if (node->kind != LAYE_NODE_UNARY && node->kind != LAYE_NODE_BINARY) {
+        return;
+    }
+
+    laye_context* laye_context = sema->context;
+    assert(laye_context != NULL);
+
+    lyir_context* lyir_context = laye_context->lyir_context;
+    assert(lyir_context != NULL);
+
+    lyir_evaluated_constant eval_result = {0};
+    switch (laye_expr_evaluate_with_status(node, &eval_result)) {
+        case LAYE_EVAL_NOT_CONSTANT: return;
+
+        case LAYE_EVAL_OK: {
+            // null and string constants have no single LYIR constant to become, so they keep their expression.
+            if (eval_result.kind == LYIR_EVAL_INT || eval_result.kind == LYIR_EVAL_FLOAT || eval_result.kind == LYIR_EVAL_BOOL) {
+                *node_ref = laye_create_constant_node(sema, node, eval_result);
+            }
+        } return;
+
+        case LAYE_EVAL_OVERFLOW: {
+            lca_string type_string = lca_string_create(laye_context->allocator);
+            laye_type_print_to_string(node->type, &type_string, laye_context->use_color);
+            lyir_write_error(lyir_context, node->location, "Constant expression overflows type %.*s.", LCA_STR_EXPAND(type_string));
+            lca_string_destroy(&type_string);
+        } break;
+
+        case LAYE_EVAL_DIVIDE_BY_ZERO: {
+            lyir_write_error(lyir_context, node->location, "Division by zero in constant expression.");
+        } break;
+
+        case LAYE_EVAL_SHIFT_OUT_OF_RANGE: {
+            lyir_write_error(lyir_context, node->location, "Shift amount is out of range in constant expression.");
+        } break;
+    }
+
+    laye_sema_set_errored(node);
+}
+
 static int laye_sema_convert_impl(laye_sema* sema, laye_node** node_ref, laye_type to, bool perform_conversion) {
     assert(sema != NULL);
     assert(node_ref != NULL);
@@ -2996,59 +3059,47 @@ static bool laye_sema_implicit_de_reference(laye_sema* sema, laye_node** node) {
     return laye_expr_is_lvalue(*node);
 }
 
-static laye_type laye_sema_get_pointer_to_type(laye_sema* sema, laye_type element_type, bool is_modifiable) {
+static laye_type laye_sema_get_derived_type(laye_sema* sema, laye_module* module, laye_node_kind kind, laye_type element_type, bool is_modifiable) {
     assert(sema != NULL);
+    assert(module != NULL);
     assert(element_type.node != NULL);
-    assert(element_type.node->module != NULL);
     assert(laye_node_is_type(element_type.node));
 
     laye_context* laye_context = sema->context;
     assert(laye_context != NULL);
 
-    lyir_context* lyir_context = laye_context->lyir_context;
-    assert(lyir_context != NULL);
-
-    laye_node* type = laye_node_create(element_type.node->module, LAYE_NODE_TYPE_POINTER, element_type.node->location, LTY(laye_context->laye_types.type));
-    assert(type != NULL);
-
-    type->type_container.element_type = element_type;
-    return LTY(type);
-}
-
-static laye_type laye_sema_get_buffer_of_type(laye_sema* sema, laye_type element_type, bool is_modifiable) {
-    assert(sema != NULL);
-    assert(element_type.node != NULL);
-    assert(element_type.node->module != NULL);
-    assert(laye_node_is_type(element_type.node));
-
-    laye_context* laye_context = sema->context;
-    assert(laye_context != NULL);
+    laye_node* element_node = laye_type_canonicalize(element_type.node);
+    laye_derived_type_key key = {
+        .kind = kind,
+        .element_node = element_node != NULL ? element_node : element_type.node,
+        .is_element_modifiable = element_type.is_modifiable,
+    };
 
-    lyir_context* lyir_context = laye_context->lyir_context;
-    assert(lyir_context != NULL);
+    __typeof__(module->derived_types) entry = lca_hashmap_find(module->derived_types, key);
+    if (entry != NULL) {
+        return laye_type_qualify(entry->value, is_modifiable);
+    }
 
-    laye_node* type = laye_node_create(element_type.node->module, LAYE_NODE_TYPE_BUFFER, element_type.node->location, LTY(laye_context->laye_types.type));
+    laye_node* type = laye_node_create(module, kind, element_type.node->location, LTY(laye_context->laye_types.type));
     assert(type != NULL);
-
+    type->compiler_generated = true;
     type->type_container.element_type = element_type;
-    return LTY(type);
-}
-
-static laye_type laye_sema_get_reference_to_type(laye_sema* sema, laye_type element_type, bool is_modifiable) {
-    assert(sema != NULL);
-    assert(element_type.node != NULL);
-    assert(element_type.node->module != NULL);
-    assert(laye_node_is_type(element_type.node));
+    lca_hashmap_set(module->derived_types, key, type);
 
-    laye_context* laye_context = sema->context;
-    assert(laye_context != NULL);
+    laye_type derived_type = laye_type_qualify(type, is_modifiable);
+    laye_sema_analyse_type(sema, &derived_type);
+    assert(derived_type.node == type);
+    return derived_type;
+}
 
-    lyir_context* lyir_context = laye_context->lyir_context;
-    assert(lyir_context != NULL);
+static laye_type laye_sema_get_pointer_to_type(laye_sema* sema, laye_module* module, laye_type element_type, bool is_modifiable) {
+    return laye_sema_get_derived_type(sema, module, LAYE_NODE_TYPE_POINTER, element_type, is_modifiable);
+}
 
-    laye_node* type = laye_node_create(element_type.node->module, LAYE_NODE_TYPE_REFERENCE, element_type.node->location, LTY(laye_context->laye_types.type));
-    assert(type != NULL);
+static laye_type laye_sema_get_buffer_of_type(laye_sema* sema, laye_module* module, laye_type element_type, bool is_modifiable) {
+    return laye_sema_get_derived_type(sema, module, LAYE_NODE_TYPE_BUFFER, element_type, is_modifiable);
+}
 
-    type->type_container.element_type = element_type;
-    return LTY(type);
+static laye_type laye_sema_get_reference_to_type(laye_sema* sema, laye_module* module, laye_type element_type, bool is_modifiable) {
+    return laye_sema_get_derived_type(sema, module, LAYE_NODE_TYPE_REFERENCE, element_type, is_modifiable);
 }
@@ -72,6 +72,8 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
     "                              Default: 'default'.\n"                                                             \
     "    --backend <backend>       What code generation backend to use. One of 'c' or 'llvm'.\n"                      \
     "                              Default: 'c'.\n"                                                                   \
+    "    --allocator <allocator>   What the compiler allocates its memory with. One of 'system' or 'pool'.\n"         \
+    "                              Default: 'system'.\n"                                                              \
     "\n"                                                                                                              \
     "  actions:\n"                                                                                                    \
     "    -E, --preprocess          Run the preprocessor step (for C files). Writes the result to stdout.\n"           \
@@ -357,6 +359,14 @@ static int backend_llvm(compiler_state* state);
 int main(int argc, char** argv) {
     int exit_code = 0;
 
+    // the default allocator can only be swapped out before anything has been allocated with it,
+    // so this option is looked for ahead of everything else. `parse_args` validates it later.
+    for (int i = 1; i + 1 < argc; i++) {
+        if (0 == strcmp(argv[i], "--allocator") && 0 == strcmp(argv[i + 1], "pool")) {
+            lca_default_allocator = lca_pool_allocator;
+        }
+    }
+
     lca_temp_allocator_init(lca_default_allocator, 1024 * 1024);
 
     // setup
@@ -643,6 +653,16 @@ found_stdlib:;
     // down all of our allocations. these should always be run in debug/safe
     // builds so the static analysers (like address sanitizer) can do their magic.
 program_exit:;
+    if (state.verbose) {
+        fprintf(
+            stderr,
+            "Interned %lld distinct strings in %lld bytes, %lld bytes were not copied again.\n",
+            (long long)lca_da_count(lyir_context->_interned_strings),
+            (long long)lyir_context->interned_string_bytes_stored,
+            (long long)lyir_context->interned_string_bytes_saved
+        );
+    }
+
     if (!state.assemble_only) {
         for (int64_t i = 0; i < lca_da_count(state.total_intermediate_files); i++) {
             const char* path_cstr = lca_string_as_cstring(state.total_intermediate_files[i]);
@@ -670,7 +690,7 @@ program_exit:;
     laye_context_destroy(laye_context);
     c_context_destroy(c_context);
     lyir_context_destroy(lyir_context);
-    lca_temp_allocator_clear();
+    lca_temp_allocator_destroy();
 #endif // !NDEBUG
 
     return exit_code;
@@ -879,6 +899,20 @@ static bool parse_args(compiler_state* args, int* argc, char*** argv) {
                 fprintf(stderr, "Unknown value for option '--backend': %s\n", backend);
                 return false;
             }
+        } else if (lca_string_view_equals(arg, LCA_SV_CONSTANT("--allocator"))) {
+            if (*argc == 0) {
+                fprintf(stderr, "'--allocator' requires an argument\n");
+                return false;
+            }
+
+            const char* allocator = nob_shift_args(argc, argv);
+            assert(allocator != NULL);
+
+            // the allocator itself was already picked at the start of `main`.
+            if (0 != strcmp(allocator, "system") && 0 != strcmp(allocator, "pool")) {
+                fprintf(stderr, "Unknown value for option '--allocator': %s\n", allocator);
+                return false;
+            }
         } else if (lca_string_view_equals(arg, LCA_SV_CONSTANT("-x"))) {
             if (argc == 0) {
                 fprintf(stderr, "'-x' requires an argument\n");
@@ -116,8 +116,20 @@ typedef struct lca_allocator {
 
 typedef struct lca_arena lca_arena;
 
+// a position in an arena, everything pushed after it can be released with `lca_arena_restore`.
+typedef struct lca_arena_mark {
+    int64_t block_index;
+    void* block_memory;
+    int64_t allocated;
+} lca_arena_mark;
+
 extern lca_allocator lca_default_allocator;
 extern lca_allocator temp_allocator;
+// a process-wide allocator which serves small requests from size class pools, with a cache
+// of free blocks for each thread. like `lca_default_allocator`, allocated memory is zeroed.
+// memory it hands out must only ever be given back to it, so it can only be made the default
+// allocator before anything has been allocated.
+extern lca_allocator lca_pool_allocator;
 
 /// Header data for a light-weight implelentation of typed dynamic arrays.
 typedef struct lca_da_header {
@@ -125,6 +137,23 @@ typedef struct lca_da_header {
     int64_t count;
 } lca_da_header;
 
+/// Header data for a light-weight implementation of typed, open-addressing hash maps.
+/// The map pointer points at `capacity` entries, which are followed by `capacity` 32-bit
+/// key hashes. A hash of zero marks an empty slot.
+typedef struct lca_hashmap_header {
+    lca_allocator allocator;
+    int64_t capacity;
+    int64_t count;
+} lca_hashmap_header;
+
+/// How hash map keys are hashed and compared.
+typedef enum lca_hashmap_key_kind {
+    /// The key is compared by its bytes, which is what you want for pointers and integers.
+    LCA_HASHMAP_KEY_BYTES,
+    /// The key is an `lca_string_view`, compared by the characters it refers to.
+    LCA_HASHMAP_KEY_STRING_VIEW,
+} lca_hashmap_key_kind;
+
 // invariant: should always be nul terminated
 typedef struct lca_string {
     lca_allocator allocator;
@@ -234,22 +263,66 @@ void lca_clopt_write_error(lca_string_view program_name, const char* format, ...
 void lca_clopt_usage(lca_string_view program_name, lca_clopt* opts);
 
 void lca_da_maybe_expand(void** da_ref, int64_t element_size, int64_t required_count);
+void lca_da_maybe_expand_exact(void** da_ref, int64_t element_size, int64_t required_count);
+void lca_small_da_maybe_expand(void** heap_ref, int64_t* capacity_ref, const void* inline_data, int64_t inline_capacity, int64_t count, int64_t element_size, int64_t required_count, bool exact);
+
+void lca_hashmap_init_with_allocator(void** map_ref, lca_allocator allocator, int64_t entry_size, int64_t required_count);
+void lca_hashmap_maybe_expand(void** map_ref, int64_t entry_size, int64_t required_count);
+void* lca_hashmap_find_entry(void* map, int64_t entry_size, int64_t key_size, lca_hashmap_key_kind key_kind, const void* key);
+void* lca_hashmap_insert_entry(void** map_ref, int64_t entry_size, int64_t key_size, lca_hashmap_key_kind key_kind, const void* key);
+bool lca_hashmap_remove_entry(void* map, int64_t entry_size, int64_t key_size, lca_hashmap_key_kind key_kind, const void* key);
+int64_t lca_hashmap_next_index(void* map, int64_t entry_size, int64_t index);
+void lca_hashmap_clear_entries(void* map, int64_t entry_size);
+void lca_hashmap_free_entries(void* map);
 
 void* lca_allocate(lca_allocator allocator, size_t n);
 void lca_deallocate(lca_allocator allocator, void* ptr);
 void* lca_reallocate(lca_allocator allocator, void* ptr, size_t n);
 
+// every thread has its own temp arena, so temporary allocations never race. `temp_allocator`
+// itself is shared and always allocates from the calling thread's arena. each thread which
+// uses it (including the main thread) must call `lca_temp_allocator_init` first, and worker
+// threads should call `lca_temp_allocator_destroy` before they exit.
+// the functions below all operate on the calling thread's temp arena.
 void lca_temp_allocator_init(lca_allocator allocator, int64_t block_size);
+void lca_temp_allocator_destroy(void);
+// gives every free block the calling thread's `lca_pool_allocator` caches hold back to the
+// shared pool. threads other than the main thread which used the pool allocator should call
+// this before they exit, just like `lca_temp_allocator_destroy`, or those blocks are lost.
+void lca_pool_thread_release(void);
+bool lca_temp_allocator_is_initialized(void);
 void lca_temp_allocator_clear(void);
+// like `lca_temp_allocator_clear`, but keeps the temp arena's blocks around for reuse.
+void lca_temp_allocator_reset(void);
 void lca_temp_allocator_dump(void);
+// marks and restores the temp arena, for releasing the temporary memory used by a bounded piece of work.
+lca_arena_mark lca_temp_mark(void);
+void lca_temp_restore(lca_arena_mark mark);
 
 char* lca_temp_sprintf(const char* format, ...);
 char* lca_temp_vsprintf(const char* format, va_list v);
 
+// creates an arena whose blocks start small and double in size up to `block_size`.
+// no memory is allocated for blocks until the first push.
 lca_arena* lca_arena_create(lca_allocator allocator, size_t block_size);
 void lca_arena_destroy(lca_arena* arena);
+// returns zeroed memory aligned for any fundamental type. requests larger than the
+// arena's block size are given a dedicated block of their own.
 void* lca_arena_push(lca_arena* arena, size_t size);
+void* lca_arena_push_aligned(lca_arena* arena, size_t size, size_t alignment);
+// like `lca_arena_push`, but the memory is not zeroed. for objects which are fully initialized right away.
+void* lca_arena_push_uninit(lca_arena* arena, size_t size);
+void* lca_arena_push_aligned_uninit(lca_arena* arena, size_t size, size_t alignment);
+// frees every block of the arena.
 void lca_arena_clear(lca_arena* arena);
+// makes all of the arena's memory available again without freeing its regular blocks.
+// dedicated blocks for oversize requests are freed.
+void lca_arena_reset(lca_arena* arena);
+// returns the arena's current position. clearing or resetting the arena invalidates it.
+lca_arena_mark lca_arena_get_mark(lca_arena* arena);
+// releases everything pushed since `mark` was taken. regular blocks are kept for reuse,
+// dedicated blocks for oversize requests are freed.
+void lca_arena_restore(lca_arena* arena, lca_arena_mark mark);
 void lca_arena_dump(lca_arena* arena);
 
 lca_string lca_string_create(lca_allocator allocator);
@@ -263,6 +336,16 @@ lca_string lca_string_vformat(const char* format, va_list v);
 void lca_string_append_format(lca_string* s, const char* format, ...);
 void lca_string_append_vformat(lca_string* s, const char* format, va_list v);
 void lca_string_append_rune(lca_string* s, int rune);
+// direct appends, for code which writes a lot of small pieces and can't afford to go through `vsnprintf`.
+void lca_string_append_cstring(lca_string* s, const char* cstr);
+void lca_string_append_view(lca_string* s, lca_string_view sv);
+void lca_string_append_char(lca_string* s, char c);
+void lca_string_append_int(lca_string* s, int64_t value);
+void lca_string_append_uint(lca_string* s, uint64_t value);
+// appends upper case hex digits, padded with zeroes to at least `min_digits`.
+void lca_string_append_hex(lca_string* s, uint64_t value, int min_digits);
+// appends the value the way `%f` formats it.
+void lca_string_append_double(lca_string* s, double value);
 
 void lca_string_path_parent(lca_string* string);
 void lca_string_path_append(lca_string* path, lca_string s);
@@ -283,6 +366,9 @@ bool lca_string_view_ends_with_cstring(lca_string_view s, const char* cstr);
 lca_string lca_string_view_change_extension(lca_allocator allocator, lca_string_view s, const char* new_ext);
 
 lca_string_view lca_string_view_path_file_name(lca_string_view s);
+// returns an absolute path with symbolic links and `.`/`..` components resolved,
+// or a copy of `s` if the path does not exist or can't be resolved.
+lca_string lca_string_view_path_canonicalize(lca_allocator allocator, lca_string_view s);
 
 #define lca_da(T)            T*
 #define lca_da_get_header(V) (((struct lca_da_header*)(V)) - 1)
@@ -290,6 +376,10 @@ lca_string_view lca_string_view_path_file_name(lca_string_view s);
 #define lca_da_capacity(V)   ((V) ? lca_da_get_header(V)->capacity : 0)
 #define lca_da_reserve(V, N) \
     do { lca_da_maybe_expand((void**)&(V), (int64_t)sizeof *(V), N); } while (0)
+// like `lca_da_reserve`, but grows the array to exactly `N` elements instead of rounding up.
+// use it when the final count is known up front and the array will not grow past it.
+#define lca_da_reserve_exact(V, N) \
+    do { lca_da_maybe_expand_exact((void**)&(V), (int64_t)sizeof *(V), N); } while (0)
 #define lca_da_count_set(V, N)                    \
     do {                                          \
         lca_da_reserve(V, N);                     \
@@ -313,24 +403,111 @@ lca_string_view lca_string_view_path_file_name(lca_string_view s);
         (V)[(I)] = (E);                                                                          \
     } while (0)
 #define lca_da_back(V) (&(V)[lca_da_count(V) - 1])
-#define lca_da_free(V)                                             \
-    do {                                                           \
-        if (V) {                                                   \
-            memset(V, 0, (size_t)lca_da_count(V) * (sizeof *(V))); \
-            LCA_FREE(lca_da_get_header(V));                        \
-            (V) = NULL;                                            \
-        }                                                          \
+#define lca_da_free(V)                      \
+    do {                                    \
+        if (V) {                            \
+            LCA_FREE(lca_da_get_header(V)); \
+            (V) = NULL;                     \
+        }                                   \
     } while (0)
 #define lca_da_free_all(V, F)                                                                                    \
     do {                                                                                                         \
         if (V) {                                                                                                 \
             for (int64_t lca_da_index = 0; lca_da_index < lca_da_count(V); lca_da_index++) F((V)[lca_da_index]); \
-            memset(V, 0, (size_t)lca_da_count(V) * (sizeof *(V)));                                               \
             LCA_FREE(lca_da_get_header(V));                                                                      \
             (V) = NULL;                                                                                          \
         }                                                                                                        \
     } while (0)
 
+// A typed dynamic array which stores up to `N` elements inline and only spills to the heap
+// once it outgrows them. Unlike `lca_da` this is a struct and not a pointer, so name it with
+// a typedef (e.g. `typedef lca_small_da(int, 4) int_list;`) before passing it around.
+// The elements move when the array spills, so always index through `lca_small_da_data`.
+#define lca_small_da(T, N) \
+    struct {               \
+        int64_t count;     \
+        int64_t capacity;  \
+        T* heap;           \
+        T inline_data[N];  \
+    }
+#define lca_small_da_inline_capacity(V) ((int64_t)(sizeof((V).inline_data) / sizeof *((V).inline_data)))
+#define lca_small_da_data(V)            ((V).heap ? (V).heap : (V).inline_data)
+#define lca_small_da_count(V)           ((V).count)
+#define lca_small_da_capacity(V)        ((V).heap ? (V).capacity : lca_small_da_inline_capacity(V))
+#define lca_small_da_maybe_expand_(V, N, Exact) \
+    lca_small_da_maybe_expand((void**)&(V).heap, &(V).capacity, (V).inline_data, lca_small_da_inline_capacity(V), (V).count, (int64_t)sizeof *((V).inline_data), N, Exact)
+#define lca_small_da_reserve(V, N) \
+    do { lca_small_da_maybe_expand_(V, N, false); } while (0)
+#define lca_small_da_reserve_exact(V, N) \
+    do { lca_small_da_maybe_expand_(V, N, true); } while (0)
+#define lca_small_da_push(V, E)                              \
+    do {                                                     \
+        lca_small_da_maybe_expand_(V, (V).count + 1, false); \
+        lca_small_da_data(V)[(V).count] = E;                 \
+        (V).count++;                                         \
+    } while (0)
+#define lca_small_da_free(V)              \
+    do {                                  \
+        if ((V).heap) LCA_FREE((V).heap); \
+        (V).heap = NULL;                  \
+        (V).capacity = 0;                 \
+        (V).count = 0;                    \
+    } while (0)
+
+// A typed hash map from `K` to `V`, stored as a pointer to its entries with an
+// `lca_hashmap_header` in front of them, the same way `lca_da` works.
+// A NULL map is a valid empty map, which allocates from `lca_default_allocator`
+// on first insert unless `lca_hashmap_init` chose a different allocator.
+//
+// `lca_string_view` keys compare by content, any other key type compares by its bytes;
+// pointers and integers are the intended use. String view keys are not copied, the
+// characters they refer to must outlive the map.
+//
+// Every use of `lca_hashmap(K, V)` is a distinct struct type, so typedef it when the
+// same map type needs to be named in more than one place.
+#define lca_hashmap(K, V) \
+    struct {              \
+        K key;            \
+        V value;          \
+    }*
+#define lca_hashmap_get_header(M) (((struct lca_hashmap_header*)(M)) - 1)
+#define lca_hashmap_count(M)      ((M) ? lca_hashmap_get_header(M)->count : 0)
+#define lca_hashmap_capacity(M)   ((M) ? lca_hashmap_get_header(M)->capacity : 0)
+#define lca_hashmap_key_kind_of(M) \
+    _Generic((M)->key, lca_string_view: LCA_HASHMAP_KEY_STRING_VIEW, default: LCA_HASHMAP_KEY_BYTES)
+#define lca_hashmap_key_args(M, K) \
+    (int64_t)sizeof *(M), (int64_t)sizeof (M)->key, lca_hashmap_key_kind_of(M), (__typeof__((M)->key)[1]){K}
+#define lca_hashmap_init(M, A, N) \
+    do { lca_hashmap_init_with_allocator((void**)&(M), A, (int64_t)sizeof *(M), N); } while (0)
+#define lca_hashmap_reserve(M, N) \
+    do { lca_hashmap_maybe_expand((void**)&(M), (int64_t)sizeof *(M), N); } while (0)
+// evaluates to a pointer to the entry for `K`, or NULL if the map does not contain it.
+#define lca_hashmap_find(M, K)     ((__typeof__(M))lca_hashmap_find_entry((M), lca_hashmap_key_args(M, K)))
+#define lca_hashmap_contains(M, K) (lca_hashmap_find(M, K) != NULL)
+// evaluates to a pointer to the entry for `K`, adding one with a zeroed value if the map does not contain it yet.
+#define lca_hashmap_insert(M, K)   ((__typeof__(M))lca_hashmap_insert_entry((void**)&(M), lca_hashmap_key_args(M, K)))
+#define lca_hashmap_set(M, K, V)                                     \
+    do {                                                             \
+        __typeof__(M) lca_hashmap_entry_ = lca_hashmap_insert(M, K); \
+        lca_hashmap_entry_->value = (V);                             \
+    } while (0)
+// evaluates to true if an entry for `K` was removed. invalidates entry pointers, and must not be used while iterating.
+#define lca_hashmap_remove(M, K) lca_hashmap_remove_entry((M), lca_hashmap_key_args(M, K))
+// iterates the indices `I` of every entry in the map, in no particular order.
+#define lca_hashmap_for_each(M, I)                                          \
+    for (int64_t I = lca_hashmap_next_index((M), (int64_t)sizeof *(M), -1); \
+         I < lca_hashmap_capacity(M);                                       \
+         I = lca_hashmap_next_index((M), (int64_t)sizeof *(M), I))
+#define lca_hashmap_clear(M) \
+    do { lca_hashmap_clear_entries((M), (int64_t)sizeof *(M)); } while (0)
+#define lca_hashmap_free(M)              \
+    do {                                 \
+        if (M) {                         \
+            lca_hashmap_free_entries(M); \
+            (M) = NULL;                  \
+        }                                \
+    } while (0)
+
 char* lca_shift_args(int* argc, char*** argv);
 
 bool lca_stdout_isatty(void);
@@ -338,6 +515,11 @@ bool lca_stderr_isatty(void);
 
 bool lca_file_exists(const char* file_path);
 lca_string lca_file_read(lca_allocator allocator, const char* file_path);
+// maps the contents of a file into read-only memory which is followed by at least one NUL byte,
+// so it can be handed to code expecting a terminated string. returns false if the file could not be
+// mapped that way, in which case it should be read with `lca_file_read` instead.
+bool lca_file_map(const char* file_path, lca_string_view* out_contents);
+void lca_file_unmap(lca_string_view contents);
 
 char* lca_plat_self_exe(void);
 
@@ -349,6 +531,13 @@ lca_command_result lca_command_run(lca_command command);
 #if defined(LCA_IMPLEMENTATION)
 
 #    include <errno.h>
+#    include <stdatomic.h>
+
+#    if defined(_MSC_VER) && !defined(__clang__)
+#        define LCA_THREAD_LOCAL __declspec(thread)
+#    else
+#        define LCA_THREAD_LOCAL _Thread_local
+#    endif
 
 #    ifdef _WIN32
 #        define WIN32_LEAN_AND_MEAN
@@ -362,32 +551,309 @@ lca_command_result lca_command_run(lca_command command);
 #    else
 #        include <execinfo.h>
 #        include <fcntl.h>
+#        include <sys/mman.h>
 #        include <sys/stat.h>
 #        include <sys/types.h>
 #        include <sys/wait.h>
 #        include <unistd.h>
 #    endif
 
-void lca_da_maybe_expand(void** da_ref, int64_t element_size, int64_t required_count) {
+static void lca_da_expand(void** da_ref, int64_t element_size, int64_t required_count, bool exact) {
     if (required_count <= 0) return;
 
-    struct lca_da_header* header = lca_da_get_header(*da_ref);
+    struct lca_da_header* header = NULL;
     if (!*da_ref) {
-        int64_t initial_capacity = 32;
+        int64_t initial_capacity = required_count;
+        if (!exact) {
+            initial_capacity = 32;
+            while (required_count > initial_capacity)
+                initial_capacity *= 2;
+        }
+
         void* new_data = LCA_MALLOC((sizeof *header) + (size_t)(initial_capacity * element_size));
         header = new_data;
 
         header->capacity = initial_capacity;
         header->count = 0;
-    } else if (required_count > header->capacity) {
-        while (required_count > header->capacity)
-            header->capacity *= 2;
-        header = LCA_REALLOC(header, (sizeof *header) + (size_t)(header->capacity * element_size));
+    } else {
+        header = lca_da_get_header(*da_ref);
+        if (required_count > header->capacity) {
+            if (exact) {
+                header->capacity = required_count;
+            } else {
+                while (required_count > header->capacity)
+                    header->capacity *= 2;
+            }
+
+            header = LCA_REALLOC(header, (sizeof *header) + (size_t)(header->capacity * element_size));
+        }
     }
 
     *da_ref = (void*)(header + 1);
 }
 
+void lca_da_maybe_expand(void** da_ref, int64_t element_size, int64_t required_count) {
+    lca_da_expand(da_ref, element_size, required_count, false);
+}
+
+void lca_da_maybe_expand_exact(void** da_ref, int64_t element_size, int64_t required_count) {
+    lca_da_expand(da_ref, element_size, required_count, true);
+}
+
+void lca_small_da_maybe_expand(void** heap_ref, int64_t* capacity_ref, const void* inline_data, int64_t inline_capacity, int64_t count, int64_t element_size, int64_t required_count, bool exact) {
+    assert(heap_ref != NULL);
+    assert(capacity_ref != NULL);
+    assert(count >= 0);
+
+    if (*heap_ref == NULL) {
+        if (required_count <= inline_capacity) return;
+
+        int64_t new_capacity = required_count;
+        if (!exact) {
+            new_capacity = inline_capacity < 2 ? 4 : inline_capacity * 2;
+            while (required_count > new_capacity)
+                new_capacity *= 2;
+        }
+
+        void* heap = LCA_MALLOC((size_t)(new_capacity * element_size));
+        assert(heap != NULL);
+        if (count > 0) memcpy(heap, inline_data, (size_t)(count * element_size));
+
+        *heap_ref = heap;
+        *capacity_ref = new_capacity;
+    } else if (required_count > *capacity_ref) {
+        int64_t new_capacity = required_count;
+        if (!exact) {
+            new_capacity = *capacity_ref;
+            while (required_count > new_capacity)
+                new_capacity *= 2;
+        }
+
+        *heap_ref = LCA_REALLOC(*heap_ref, (size_t)(new_capacity * element_size));
+        assert(*heap_ref != NULL);
+        *capacity_ref = new_capacity;
+    }
+}
+
+static uint32_t* lca_hashmap_hashes(lca_hashmap_header* header, int64_t entry_size) {
+    return (uint32_t*)((char*)(header + 1) + header->capacity * entry_size);
+}
+
+static uint32_t lca_hashmap_hash_key(lca_hashmap_key_kind key_kind, int64_t key_size, const void* key) {
+    const uint8_t* data = key;
+    int64_t count = key_size;
+
+    if (key_kind == LCA_HASHMAP_KEY_STRING_VIEW) {
+        const lca_string_view* sv = key;
+        data = (const uint8_t*)sv->data;
+        count = sv->count;
+    } else if (key_size == 8) {
+        // pointers and 64-bit integers; the high bits of a multiplicative hash are well mixed.
+        uint64_t value;
+        memcpy(&value, key, 8);
+        uint32_t hash = (uint32_t)((value * 0x9E3779B97F4A7C15ull) >> 32);
+        return hash == 0 ? 1 : hash;
+    } else if (key_size % 8 == 0) {
+        // keys made of several pointers or 64-bit integers are mixed a word at a time, the same way.
+        uint64_t hash = 0;
+        for (int64_t i = 0; i < key_size; i += 8) {
+            uint64_t value;
+            memcpy(&value, data + i, 8);
+            hash = (((hash << 5) | (hash >> 59)) ^ value) * 0x9E3779B97F4A7C15ull;
+        }
+
+        uint32_t result = (uint32_t)(hash >> 32);
+        return result == 0 ? 1 : result;
+    }
+
+    // 64-bit FNV-1a
+    uint64_t hash = 14695981039346656037ull;
+    for (int64_t i = 0; i < count; i++) {
+        hash ^= data[i];
+        hash *= 1099511628211ull;
+    }
+
+    uint32_t result = (uint32_t)(hash ^ (hash >> 32));
+    return result == 0 ? 1 : result;
+}
+
+static bool lca_hashmap_key_equals(lca_hashmap_key_kind key_kind, int64_t key_size, const void* entry_key, const void* key) {
+    if (key_kind == LCA_HASHMAP_KEY_STRING_VIEW) {
+        return lca_string_view_equals(*(const lca_string_view*)entry_key, *(const lca_string_view*)key);
+    }
+
+    return 0 == memcmp(entry_key, key, (size_t)key_size);
+}
+
+static lca_hashmap_header* lca_hashmap_allocate(lca_allocator allocator, int64_t entry_size, int64_t required_count) {
+    // keep the load factor at or below 3/4, so probing always finds an empty slot quickly.
+    int64_t capacity = 16;
+    while (required_count * 4 > capacity * 3)
+        capacity *= 2;
+
+    size_t size = (sizeof(lca_hashmap_header)) + (size_t)(capacity * (entry_size + (int64_t)sizeof(uint32_t)));
+    lca_hashmap_header* header = lca_allocate(allocator, size);
+    assert(header != NULL);
+    memset(header, 0, size);
+
+    header->allocator = allocator;
+    header->capacity = capacity;
+    return header;
+}
+
+void lca_hashmap_init_with_allocator(void** map_ref, lca_allocator allocator, int64_t entry_size, int64_t required_count) {
+    assert(map_ref != NULL);
+    assert(*map_ref == NULL && "hash map is already initialized");
+    *map_ref = (void*)(lca_hashmap_allocate(allocator, entry_size, required_count) + 1);
+}
+
+void lca_hashmap_maybe_expand(void** map_ref, int64_t entry_size, int64_t required_count) {
+    assert(map_ref != NULL);
+
+    if (*map_ref == NULL) {
+        lca_hashmap_init_with_allocator(map_ref, lca_default_allocator, entry_size, required_count);
+        return;
+    }
+
+    lca_hashmap_header* header = lca_hashmap_get_header(*map_ref);
+    if (required_count * 4 <= header->capacity * 3) return;
+
+    lca_hashmap_header* new_header = lca_hashmap_allocate(header->allocator, entry_size, required_count);
+    new_header->count = header->count;
+
+    char* entries = (char*)(header + 1);
+    uint32_t* hashes = lca_hashmap_hashes(header, entry_size);
+
+    char* new_entries = (char*)(new_header + 1);
+    uint32_t* new_hashes = lca_hashmap_hashes(new_header, entry_size);
+    int64_t new_mask = new_header->capacity - 1;
+
+    // the stored hashes are enough to place every entry again, no keys need to be compared.
+    for (int64_t i = 0; i < header->capacity; i++) {
+        if (hashes[i] == 0) continue;
+
+        int64_t slot = (int64_t)hashes[i] & new_mask;
+        while (new_hashes[slot] != 0)
+            slot = (slot + 1) & new_mask;
+
+        new_hashes[slot] = hashes[i];
+        memcpy(new_entries + slot * entry_size, entries + i * entry_size, (size_t)entry_size);
+    }
+
+    lca_deallocate(header->allocator, header);
+    *map_ref = (void*)(new_header + 1);
+}
+
+static int64_t lca_hashmap_find_index(lca_hashmap_header* header, int64_t entry_size, int64_t key_size, lca_hashmap_key_kind key_kind, const void* key, uint32_t hash) {
+    char* entries = (char*)(header + 1);
+    uint32_t* hashes = lca_hashmap_hashes(header, entry_size);
+    int64_t mask = header->capacity - 1;
+
+    for (int64_t slot = (int64_t)hash & mask; hashes[slot] != 0; slot = (slot + 1) & mask) {
+        if (hashes[slot] == hash && lca_hashmap_key_equals(key_kind, key_size, entries + slot * entry_size, key)) {
+            return slot;
+        }
+    }
+
+    return -1;
+}
+
+void* lca_hashmap_find_entry(void* map, int64_t entry_size, int64_t key_size, lca_hashmap_key_kind key_kind, const void* key) {
+    if (map == NULL) return NULL;
+
+    lca_hashmap_header* header = lca_hashmap_get_header(map);
+    uint32_t hash = lca_hashmap_hash_key(key_kind, key_size, key);
+
+    int64_t slot = lca_hashmap_find_index(header, entry_size, key_size, key_kind, key, hash);
+    if (slot < 0) return NULL;
+
+    return (char*)map + slot * entry_size;
+}
+
+void* lca_hashmap_insert_entry(void** map_ref, int64_t entry_size, int64_t key_size, lca_hashmap_key_kind key_kind, const void* key) {
+    assert(map_ref != NULL);
+    lca_hashmap_maybe_expand(map_ref, entry_size, lca_hashmap_count(*map_ref) + 1);
+
+    lca_hashmap_header* header = lca_hashmap_get_header(*map_ref);
+    char* entries = (char*)(header + 1);
+    uint32_t* hashes = lca_hashmap_hashes(header, entry_size);
+    int64_t mask = header->capacity - 1;
+
+    uint32_t hash = lca_hashmap_hash_key(key_kind, key_size, key);
+
+    int64_t slot = (int64_t)hash & mask;
+    for (; hashes[slot] != 0; slot = (slot + 1) & mask) {
+        if (hashes[slot] == hash && lca_hashmap_key_equals(key_kind, key_size, entries + slot * entry_size, key)) {
+            return entries + slot * entry_size;
+        }
+    }
+
+    // empty slots are always zeroed, so only the key has to be written.
+    hashes[slot] = hash;
+    memcpy(entries + slot * entry_size, key, (size_t)key_size);
+    header->count++;
+
+    return entries + slot * entry_size;
+}
+
+bool lca_hashmap_remove_entry(void* map, int64_t entry_size, int64_t key_size, lca_hashmap_key_kind key_kind, const void* key) {
+    if (map == NULL) return false;
+
+    lca_hashmap_header* header = lca_hashmap_get_header(map);
+    char* entries = (char*)(header + 1);
+    uint32_t* hashes = lca_hashmap_hashes(header, entry_size);
+    int64_t mask = header->capacity - 1;
+
+    uint32_t hash = lca_hashmap_hash_key(key_kind, key_size, key);
+    int64_t hole = lca_hashmap_find_index(header, entry_size, key_size, key_kind, key, hash);
+    if (hole < 0) return false;
+
+    // backward shift deletion: move later entries of the probe sequence into the hole
+    // when that does not place them before their home slot, so no tombstones are needed.
+    for (int64_t slot = (hole + 1) & mask; hashes[slot] != 0; slot = (slot + 1) & mask) {
+        int64_t home = (int64_t)hashes[slot] & mask;
+        if (((slot - home) & mask) >= ((slot - hole) & mask)) {
+            hashes[hole] = hashes[slot];
+            memcpy(entries + hole * entry_size, entries + slot * entry_size, (size_t)entry_size);
+            hole = slot;
+        }
+    }
+
+    hashes[hole] = 0;
+    memset(entries + hole * entry_size, 0, (size_t)entry_size);
+    header->count--;
+
+    return true;
+}
+
+int64_t lca_hashmap_next_index(void* map, int64_t entry_size, int64_t index) {
+    if (map == NULL) return 0;
+
+    lca_hashmap_header* header = lca_hashmap_get_header(map);
+    uint32_t* hashes = lca_hashmap_hashes(header, entry_size);
+
+    for (index = index + 1; index < header->capacity; index++) {
+        if (hashes[index] != 0) break;
+    }
+
+    return index;
+}
+
+void lca_hashmap_clear_entries(void* map, int64_t entry_size) {
+    if (map == NULL) return;
+
+    lca_hashmap_header* header = lca_hashmap_get_header(map);
+    memset(map, 0, (size_t)(header->capacity * (entry_size + (int64_t)sizeof(uint32_t))));
+    header->count = 0;
+}
+
+void lca_hashmap_free_entries(void* map) {
+    if (map == NULL) return;
+
+    lca_hashmap_header* header = lca_hashmap_get_header(map);
+    lca_deallocate(header->allocator, header);
+}
+
 lca_string lca_string_create(lca_allocator allocator) {
     int64_t capacity = 32;
     char* data = lca_allocate(allocator, (size_t)capacity * sizeof *data);
@@ -425,13 +891,321 @@ char* lca_string_as_cstring(lca_string s) {
     return s.data;
 }
 
+// string comparison and search kernels.
+// identifiers are compared and searched constantly (scope lookup, symbol lookup, the ccly macro
+// table), so these work a word or a vector at a time instead of a byte at a time. the SWAR
+// kernels are portable; on x86-64 the SSE2 kernels are always available and the AVX2 ones are
+// picked at runtime the first time any of them is used, if the CPU supports them.
+
+#    if defined(__x86_64__) || defined(_M_X64) || defined(__SSE2__)
+#        define LCA_HAS_SSE2 1
+#        include <emmintrin.h>
+#    endif
+
+#    if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#        define LCA_HAS_AVX2 1
+#        include <immintrin.h>
+#    endif
+
+typedef enum lca_simd_level {
+    LCA_SIMD_UNKNOWN,
+    LCA_SIMD_SWAR,
+    LCA_SIMD_SSE2,
+    LCA_SIMD_AVX2,
+} lca_simd_level;
+
+static atomic_int lca_simd_level_cached = LCA_SIMD_UNKNOWN;
+
+static lca_simd_level lca_simd_level_get(void) {
+    int level = atomic_load_explicit(&lca_simd_level_cached, memory_order_relaxed);
+    if (level != LCA_SIMD_UNKNOWN) return (lca_simd_level)level;
+
+    level = LCA_SIMD_SWAR;
+#    if defined(LCA_HAS_SSE2)
+    level = LCA_SIMD_SSE2;
+#    endif
+#    if defined(LCA_HAS_AVX2)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) level = LCA_SIMD_AVX2;
+#    endif
+
+    atomic_store_explicit(&lca_simd_level_cached, level, memory_order_relaxed);
+    return (lca_simd_level)level;
+}
+
+static int lca_count_trailing_zeros32(uint32_t value) {
+    assert(value != 0);
+#    if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctz(value);
+#    else
+    int result = 0;
+    while ((value & 1) == 0) {
+        value >>= 1;
+        result++;
+    }
+    return result;
+#    endif
+}
+
+static int lca_highest_bit32(uint32_t value) {
+    assert(value != 0);
+#    if defined(__GNUC__) || defined(__clang__)
+    return 31 - __builtin_clz(value);
+#    else
+    int result = 0;
+    while (value >>= 1)
+        result++;
+    return result;
+#    endif
+}
+
+static uint64_t lca_swar_load64(const char* data) {
+    uint64_t word;
+    memcpy(&word, data, sizeof word);
+    return word;
+}
+
+static uint32_t lca_swar_load32(const char* data) {
+    uint32_t word;
+    memcpy(&word, data, sizeof word);
+    return word;
+}
+
+// sets the high bit of every byte in `word` which is zero, and no other bits.
+// unlike the usual `(x - 0x01..) & ~x & 0x80..` trick this has no false positives,
+// so it doesn't matter which end of the word a match is looked for from.
+static uint64_t lca_swar_zero_bytes(uint64_t word) {
+    const uint64_t low_bits = 0x7F7F7F7F7F7F7F7FULL;
+    uint64_t sum = (word & low_bits) + low_bits;
+    return ~(sum | word | low_bits);
+}
+
+static bool lca_memory_equals_swar(const char* a, const char* b, int64_t count) {
+    if (count < 8) {
+        if (count >= 4) {
+            // two overlapping loads cover every length from 4 to 8.
+            return lca_swar_load32(a) == lca_swar_load32(b) && lca_swar_load32(a + count - 4) == lca_swar_load32(b + count - 4);
+        }
+
+        for (int64_t i = 0; i < count; i++) {
+            if (a[i] != b[i]) return false;
+        }
+
+        return true;
+    }
+
+    int64_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        if (lca_swar_load64(a + i) != lca_swar_load64(b + i)) return false;
+    }
+
+    return i == count || lca_swar_load64(a + count - 8) == lca_swar_load64(b + count - 8);
+}
+
+static int64_t lca_index_of_swar(const char* data, int64_t start, int64_t count, char c) {
+    uint64_t pattern = 0x0101010101010101ULL * (uint8_t)c;
+
+    int64_t i = start;
+    for (; i + 8 <= count; i += 8) {
+        if (lca_swar_zero_bytes(lca_swar_load64(data + i) ^ pattern)) break;
+    }
+
+    for (; i < count; i++) {
+        if (data[i] == c) return i;
+    }
+
+    return -1;
+}
+
+// searches `data[0 .. end)` from the back.
+static int64_t lca_last_index_of_swar(const char* data, int64_t end, char c) {
+    uint64_t pattern = 0x0101010101010101ULL * (uint8_t)c;
+
+    int64_t i = end;
+    for (; i >= 8; i -= 8) {
+        if (lca_swar_zero_bytes(lca_swar_load64(data + i - 8) ^ pattern)) break;
+    }
+
+    while (i > 0) {
+        i--;
+        if (data[i] == c) return i;
+    }
+
+    return -1;
+}
+
+#    if defined(LCA_HAS_SSE2)
+static bool lca_memory_equals_sse2(const char* a, const char* b, int64_t count) {
+    if (count < 16) return lca_memory_equals_swar(a, b, count);
+
+    int64_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m128i a_chunk = _mm_loadu_si128((const __m128i*)(a + i));
+        __m128i b_chunk = _mm_loadu_si128((const __m128i*)(b + i));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(a_chunk, b_chunk)) != 0xFFFF) return false;
+    }
+
+    if (i == count) return true;
+
+    __m128i a_tail = _mm_loadu_si128((const __m128i*)(a + count - 16));
+    __m128i b_tail = _mm_loadu_si128((const __m128i*)(b + count - 16));
+    return _mm_movemask_epi8(_mm_cmpeq_epi8(a_tail, b_tail)) == 0xFFFF;
+}
+
+static int64_t lca_index_of_sse2(const char* data, int64_t count, char c) {
+    if (count < 16) return lca_index_of_swar(data, 0, count, c);
+
+    __m128i pattern = _mm_set1_epi8(c);
+
+    int64_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        uint32_t mask = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(data + i)), pattern));
+        if (mask) return i + lca_count_trailing_zeros32(mask);
+    }
+
+    if (i == count) return -1;
+
+    // the last chunk overlaps bytes which were already searched, so ignore matches in those.
+    uint32_t mask = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(data + count - 16)), pattern));
+    mask >>= i - (count - 16);
+    return mask ? i + lca_count_trailing_zeros32(mask) : -1;
+}
+
+static int64_t lca_last_index_of_sse2(const char* data, int64_t count, char c) {
+    if (count < 16) return lca_last_index_of_swar(data, count, c);
+
+    __m128i pattern = _mm_set1_epi8(c);
+
+    int64_t i = count;
+    for (; i >= 16; i -= 16) {
+        uint32_t mask = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(data + i - 16)), pattern));
+        if (mask) return i - 16 + lca_highest_bit32(mask);
+    }
+
+    if (i == 0) return -1;
+
+    // the first chunk overlaps bytes which were already searched, so ignore matches in those.
+    uint32_t mask = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)data), pattern));
+    mask &= (uint32_t)((1U << i) - 1);
+    return mask ? lca_highest_bit32(mask) : -1;
+}
+#    endif
+
+#    if defined(LCA_HAS_AVX2)
+__attribute__((target("avx2"))) static bool lca_memory_equals_avx2(const char* a, const char* b, int64_t count) {
+    if (count < 32) return lca_memory_equals_sse2(a, b, count);
+
+    int64_t i = 0;
+    for (; i + 32 <= count; i += 32) {
+        __m256i a_chunk = _mm256_loadu_si256((const __m256i*)(a + i));
+        __m256i b_chunk = _mm256_loadu_si256((const __m256i*)(b + i));
+        if ((uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(a_chunk, b_chunk)) != 0xFFFFFFFFU) return false;
+    }
+
+    if (i == count) return true;
+
+    __m256i a_tail = _mm256_loadu_si256((const __m256i*)(a + count - 32));
+    __m256i b_tail = _mm256_loadu_si256((const __m256i*)(b + count - 32));
+    return (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(a_tail, b_tail)) == 0xFFFFFFFFU;
+}
+
+__attribute__((target("avx2"))) static int64_t lca_index_of_avx2(const char* data, int64_t count, char c) {
+    if (count < 32) return lca_index_of_sse2(data, count, c);
+
+    __m256i pattern = _mm256_set1_epi8(c);
+
+    int64_t i = 0;
+    for (; i + 32 <= count; i += 32) {
+        uint32_t mask = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*)(data + i)), pattern));
+        if (mask) return i + lca_count_trailing_zeros32(mask);
+    }
+
+    if (i == count) return -1;
+
+    // the last chunk overlaps bytes which were already searched, so ignore matches in those.
+    uint32_t mask = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*)(data + count - 32)), pattern));
+    mask >>= i - (count - 32);
+    return mask ? i + lca_count_trailing_zeros32(mask) : -1;
+}
+
+__attribute__((target("avx2"))) static int64_t lca_last_index_of_avx2(const char* data, int64_t count, char c) {
+    if (count < 32) return lca_last_index_of_sse2(data, count, c);
+
+    __m256i pattern = _mm256_set1_epi8(c);
+
+    int64_t i = count;
+    for (; i >= 32; i -= 32) {
+        uint32_t mask = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*)(data + i - 32)), pattern));
+        if (mask) return i - 32 + lca_highest_bit32(mask);
+    }
+
+    if (i == 0) return -1;
+
+    // the first chunk overlaps bytes which were already searched, so ignore matches in those.
+    uint32_t mask = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*)data), pattern));
+    mask &= (uint32_t)((1ULL << i) - 1);
+    return mask ? lca_highest_bit32(mask) : -1;
+}
+#    endif
+
+static bool lca_memory_equals(const char* a, const char* b, int64_t count) {
+    assert(count >= 0);
+    if (count == 0 || a == b) return true;
+    // identifiers are mostly shorter than a vector, and the word-at-a-time kernels win there.
+    if (count < 16) return lca_memory_equals_swar(a, b, count);
+
+    switch (lca_simd_level_get()) {
+#    if defined(LCA_HAS_AVX2)
+        case LCA_SIMD_AVX2: {
+            if (count >= 32) return lca_memory_equals_avx2(a, b, count);
+        } [[fallthrough]];
+#    endif
+#    if defined(LCA_HAS_SSE2)
+        case LCA_SIMD_SSE2: return lca_memory_equals_sse2(a, b, count);
+#    endif
+        default: return lca_memory_equals_swar(a, b, count);
+    }
+}
+
+static int64_t lca_memory_index_of(const char* data, int64_t count, char c) {
+    assert(count >= 0);
+    if (count == 0) return -1;
+    if (count < 16) return lca_index_of_swar(data, 0, count, c);
+
+    switch (lca_simd_level_get()) {
+#    if defined(LCA_HAS_AVX2)
+        case LCA_SIMD_AVX2: {
+            if (count >= 32) return lca_index_of_avx2(data, count, c);
+        } [[fallthrough]];
+#    endif
+#    if defined(LCA_HAS_SSE2)
+        case LCA_SIMD_SSE2: return lca_index_of_sse2(data, count, c);
+#    endif
+        default: return lca_index_of_swar(data, 0, count, c);
+    }
+}
+
+static int64_t lca_memory_last_index_of(const char* data, int64_t count, char c) {
+    assert(count >= 0);
+    if (count == 0) return -1;
+    if (count < 16) return lca_last_index_of_swar(data, count, c);
+
+    switch (lca_simd_level_get()) {
+#    if defined(LCA_HAS_AVX2)
+        case LCA_SIMD_AVX2: {
+            if (count >= 32) return lca_last_index_of_avx2(data, count, c);
+        } [[fallthrough]];
+#    endif
+#    if defined(LCA_HAS_SSE2)
+        case LCA_SIMD_SSE2: return lca_last_index_of_sse2(data, count, c);
+#    endif
+        default: return lca_last_index_of_swar(data, count, c);
+    }
+}
+
 bool lca_string_equals(lca_string a, lca_string b) {
     if (a.count != b.count) return false;
-    for (int64_t i = 0; i < a.count; i++) {
-        if (a.data[i] != b.data[i])
-            return false;
-    }
-    return true;
+    return lca_memory_equals(a.data, b.data, a.count);
 }
 
 lca_string_view lca_string_slice(lca_string s, int64_t offset, int64_t length) {
@@ -506,6 +1280,79 @@ void lca_string_append_rune(lca_string* s, int rune) {
     s->count += 1;
 }
 
+static void lca_string_append_data(lca_string* s, const char* data, int64_t count) {
+    assert(s != NULL);
+    // keep room for the NUL terminator, the same as the formatting functions leave.
+    lca_string_ensure_capacity(s, s->count + count + 1);
+    memcpy(s->data + s->count, data, (size_t)count);
+    s->count += count;
+    s->data[s->count] = 0;
+}
+
+void lca_string_append_cstring(lca_string* s, const char* cstr) {
+    assert(cstr != NULL);
+    lca_string_append_data(s, cstr, (int64_t)strlen(cstr));
+}
+
+void lca_string_append_view(lca_string* s, lca_string_view sv) {
+    lca_string_append_data(s, sv.data, sv.count);
+}
+
+void lca_string_append_char(lca_string* s, char c) {
+    assert(s != NULL);
+    lca_string_ensure_capacity(s, s->count + 2);
+    s->data[s->count] = c;
+    s->count += 1;
+    s->data[s->count] = 0;
+}
+
+void lca_string_append_uint(lca_string* s, uint64_t value) {
+    // digits are written backwards from the end of the buffer.
+    char buffer[20];
+    int64_t start = (int64_t)sizeof buffer;
+    do {
+        buffer[--start] = (char)('0' + value % 10);
+        value /= 10;
+    } while (value != 0);
+
+    lca_string_append_data(s, buffer + start, (int64_t)sizeof buffer - start);
+}
+
+void lca_string_append_int(lca_string* s, int64_t value) {
+    if (value < 0) {
+        lca_string_append_char(s, '-');
+        // negated as unsigned so INT64_MIN doesn't overflow.
+        lca_string_append_uint(s, 0 - (uint64_t)value);
+    } else {
+        lca_string_append_uint(s, (uint64_t)value);
+    }
+}
+
+void lca_string_append_hex(lca_string* s, uint64_t value, int min_digits) {
+    assert(min_digits >= 0 && min_digits <= 16);
+
+    char buffer[16];
+    int64_t start = (int64_t)sizeof buffer;
+    do {
+        buffer[--start] = "0123456789ABCDEF"[value & 0xF];
+        value >>= 4;
+    } while (value != 0);
+
+    while ((int64_t)sizeof buffer - start < min_digits) {
+        buffer[--start] = '0';
+    }
+
+    lca_string_append_data(s, buffer + start, (int64_t)sizeof buffer - start);
+}
+
+void lca_string_append_double(lca_string* s, double value) {
+    // the largest double is 309 digits before the decimal point, `%f` adds 7 more after it.
+    char buffer[320];
+    int n = snprintf(buffer, sizeof buffer, "%f", value);
+    assert(n >= 0 && (size_t)n < sizeof buffer);
+    lca_string_append_data(s, buffer, n);
+}
+
 void lca_string_path_parent(lca_string* string) {
     if (string->count > 0 && (string->data[string->count - 1] == '/' || string->data[string->count - 1] == '\\')) {
         string->data[string->count - 1] = 0;
@@ -566,11 +1413,7 @@ lca_string_view lca_string_view_slice(lca_string_view sv, int64_t offset, int64_
 
 bool lca_string_view_equals(lca_string_view a, lca_string_view b) {
     if (a.count != b.count) return false;
-    for (int64_t i = 0; i < a.count; i++) {
-        if (a.data[i] != b.data[i])
-            return false;
-    }
-    return true;
+    return lca_memory_equals(a.data, b.data, a.count);
 }
 
 bool lca_string_view_equals_cstring(lca_string_view a, const char* b) {
@@ -585,11 +1428,7 @@ bool lca_string_view_equals_cstring(lca_string_view a, const char* b) {
 
 bool lca_string_view_starts_with(lca_string_view a, lca_string_view b) {
     if (a.count < b.count) return false;
-    for (int64_t i = 0; i < b.count; i++) {
-        if (a.data[i] != b.data[i])
-            return false;
-    }
-    return true;
+    return lca_memory_equals(a.data, b.data, b.count);
 }
 
 lca_string lca_string_view_to_string(lca_allocator allocator, lca_string_view s) {
@@ -607,23 +1446,11 @@ char* lca_string_view_to_cstring(lca_allocator allocator, lca_string_view s) {
 }
 
 int64_t lca_string_view_index_of(lca_string_view s, char c) {
-    for (int64_t i = 0; i < s.count; i++) {
-        if (s.data[i] == c) {
-            return i;
-        }
-    }
-
-    return -1;
+    return lca_memory_index_of(s.data, s.count, c);
 }
 
 int64_t lca_string_view_last_index_of(lca_string_view s, char c) {
-    for (int64_t i = s.count - 1; i >= 0; i--) {
-        if (s.data[i] == c) {
-            return i;
-        }
-    }
-
-    return -1;
+    return lca_memory_last_index_of(s.data, s.count, c);
 }
 
 bool lca_string_view_ends_with_cstring(lca_string_view s, const char* cstr) {
@@ -676,26 +1503,67 @@ lca_string_view lca_string_view_path_file_name(lca_string_view s) {
     return s;
 }
 
+lca_string lca_string_view_path_canonicalize(lca_allocator allocator, lca_string_view s) {
+    char* path_cstr = lca_string_view_to_cstring(allocator, s);
+    assert(path_cstr != NULL);
+
+#    if _WIN32
+    char* canonical_path_cstr = _fullpath(NULL, path_cstr, 0);
+#    else
+    char* canonical_path_cstr = realpath(path_cstr, NULL);
+#    endif
+
+    lca_deallocate(allocator, path_cstr);
+
+    if (canonical_path_cstr == NULL) {
+        return lca_string_view_to_string(allocator, s);
+    }
+
+    lca_string canonical_path = lca_string_view_to_string(allocator, lca_string_view_from_cstring(canonical_path_cstr));
+    free(canonical_path_cstr);
+
+    return canonical_path;
+}
+
 typedef struct lca_arena_block {
     void* memory;
     int64_t allocated;
     int64_t capacity;
 } lca_arena_block;
 
+// the size of the first block of an arena, unless its maximum block size is smaller.
+#    define LCA_ARENA_INITIAL_BLOCK_SIZE ((int64_t)4096)
+
 struct lca_arena {
     lca_allocator allocator;
+    // blocks before `current_block` are used up, blocks after it are unused ones kept by a reset.
+    // dedicated blocks are inserted before the current block.
     lca_da(lca_arena_block) blocks;
+    // the index of the block memory is pushed from, or -1 if there is none yet.
+    int64_t current_block;
+    // the largest size regular blocks grow to.
     int64_t block_size;
+    // the size of the next regular block to allocate.
+    int64_t next_block_size;
 };
 
 void* lca_lca_default_allocator_function(void* user_data, size_t count, void* ptr);
 void* lca_temp_allocator_function(void* user_data, size_t count, void* ptr);
+void* lca_pool_allocator_function(void* user_data, size_t count, void* ptr);
 
 lca_allocator lca_default_allocator = {
     .allocator_function = lca_lca_default_allocator_function
 };
 
-lca_allocator temp_allocator = {0};
+lca_allocator lca_pool_allocator = {
+    .allocator_function = lca_pool_allocator_function
+};
+
+lca_allocator temp_allocator = {
+    .allocator_function = lca_temp_allocator_function
+};
+
+static LCA_THREAD_LOCAL lca_arena* lca_temp_arena = NULL;
 
 void* lca_allocate(lca_allocator allocator, size_t n) {
     return allocator.allocator_function(allocator.user_data, n, NULL);
@@ -724,31 +1592,304 @@ void* lca_lca_default_allocator_function(void* user_data, size_t count, void* pt
     }
 }
 
+// the pool's size classes are 16 to 128 bytes in steps of 16, then four classes per doubling up to 8192 bytes.
+// anything larger is allocated on its own, straight from the system.
+#    define LCA_POOL_SMALL_CLASS_COUNT 8
+#    define LCA_POOL_CLASS_COUNT       32
+#    define LCA_POOL_MAX_BLOCK_SIZE    ((size_t)8192)
+#    define LCA_POOL_LARGE_CLASS       ((int64_t)-1)
+// blocks are carved out of chunks of at least this size, which are never returned to the system.
+#    define LCA_POOL_CHUNK_SIZE ((size_t)64 * 1024)
+// how many free blocks a thread can hold on to for each class, and how many of them
+// move between a thread's cache and the shared pool at once.
+#    define LCA_POOL_CACHE_CAPACITY 64
+#    define LCA_POOL_BATCH_COUNT    32
+
+// every block is preceded by a header, which keeps the memory handed out aligned for any fundamental type.
+typedef struct lca_pool_header {
+    int64_t size_class;
+    // the usable size of a pooled block, or the requested size of a large allocation.
+    int64_t size;
+} lca_pool_header;
+
+static_assert(sizeof(lca_pool_header) % _Alignof(max_align_t) == 0, "pool block headers must keep blocks aligned");
+
+// free blocks are kept as stacks of pointers rather than lists linked through the blocks,
+// so freeing a block never touches its memory and batches move with a single copy.
+typedef struct lca_pool_cache {
+    void* blocks[LCA_POOL_CACHE_CAPACITY];
+    int64_t count;
+} lca_pool_cache;
+
+typedef struct lca_pool_free_stack {
+    void** blocks;
+    int64_t count;
+    int64_t capacity;
+} lca_pool_free_stack;
+
+static struct {
+    atomic_flag lock;
+    lca_pool_free_stack free_stacks[LCA_POOL_CLASS_COUNT];
+    // the part of the most recent chunk of each class that hasn't been carved into blocks yet.
+    char* chunk_cursors[LCA_POOL_CLASS_COUNT];
+    char* chunk_ends[LCA_POOL_CLASS_COUNT];
+} lca_pool = {
+    .lock = ATOMIC_FLAG_INIT,
+};
+
+static LCA_THREAD_LOCAL lca_pool_cache lca_pool_thread_caches[LCA_POOL_CLASS_COUNT];
+
+static int lca_pool_log2(uint64_t value) {
+#    if defined(__GNUC__) || defined(__clang__)
+    return 63 - __builtin_clzll(value);
+#    else
+    int result = 0;
+    while (value >>= 1)
+        result++;
+    return result;
+#    endif
+}
+
+static int64_t lca_pool_size_class(size_t size) {
+    assert(size > 0 && size <= LCA_POOL_MAX_BLOCK_SIZE);
+    if (size <= 128) {
+        return (int64_t)((size + 15) >> 4) - 1;
+    }
+
+    // the top three bits of `size - 1` pick the class within its doubling.
+    int shift = lca_pool_log2(size - 1) - 2;
+    return LCA_POOL_SMALL_CLASS_COUNT + (shift - 5) * 4 + (int64_t)((size - 1) >> shift) - 4;
+}
+
+static size_t lca_pool_class_block_size(int64_t size_class) {
+    assert(size_class >= 0 && size_class < LCA_POOL_CLASS_COUNT);
+    if (size_class < LCA_POOL_SMALL_CLASS_COUNT) {
+        return (size_t)(size_class + 1) * 16;
+    }
+
+    int64_t doubling_index = size_class - LCA_POOL_SMALL_CLASS_COUNT;
+    int shift = 5 + (int)(doubling_index / 4);
+    return (size_t)(doubling_index % 4 + 5) << shift;
+}
+
+static void lca_pool_lock(void) {
+    while (atomic_flag_test_and_set_explicit(&lca_pool.lock, memory_order_acquire)) {
+        // the lock is only ever held for a batch copy, so spin, but let the CPU know we are.
+#    if defined(LCA_HAS_SSE2)
+        _mm_pause();
+#    elif (defined(__aarch64__) || defined(__arm__)) && (defined(__GNUC__) || defined(__clang__))
+        __asm__ volatile("yield");
+#    elif defined(_MSC_VER) && defined(_M_ARM64)
+        __yield();
+#    endif
+    }
+}
+
+static void lca_pool_unlock(void) {
+    atomic_flag_clear_explicit(&lca_pool.lock, memory_order_release);
+}
+
+static void lca_pool_refill_cache(int64_t size_class, lca_pool_cache* cache) {
+    assert(cache->count == 0);
+
+    lca_pool_lock();
+
+    lca_pool_free_stack* free_stack = &lca_pool.free_stacks[size_class];
+    if (free_stack->count > 0) {
+        int64_t moved_count = free_stack->count < LCA_POOL_BATCH_COUNT ? free_stack->count : LCA_POOL_BATCH_COUNT;
+        free_stack->count -= moved_count;
+        memcpy(cache->blocks, free_stack->blocks + free_stack->count, (size_t)moved_count * sizeof *cache->blocks);
+        cache->count = moved_count;
+
+        lca_pool_unlock();
+        return;
+    }
+
+    size_t block_size = lca_pool_class_block_size(size_class);
+    size_t stride = sizeof(lca_pool_header) + block_size;
+
+    while (cache->count < LCA_POOL_BATCH_COUNT) {
+        if (lca_pool.chunk_ends[size_class] - lca_pool.chunk_cursors[size_class] < (ptrdiff_t)stride) {
+            size_t chunk_size = stride * LCA_POOL_BATCH_COUNT;
+            if (chunk_size < LCA_POOL_CHUNK_SIZE) chunk_size = LCA_POOL_CHUNK_SIZE;
+
+            char* chunk = malloc(chunk_size);
+            assert(chunk != NULL);
+            lca_pool.chunk_cursors[size_class] = chunk;
+            lca_pool.chunk_ends[size_class] = chunk + chunk_size;
+        }
+
+        lca_pool_header* header = (lca_pool_header*)lca_pool.chunk_cursors[size_class];
+        lca_pool.chunk_cursors[size_class] += stride;
+        *header = (lca_pool_header){
+            .size_class = size_class,
+            .size = (int64_t)block_size,
+        };
+
+        cache->blocks[cache->count] = header + 1;
+        cache->count++;
+    }
+
+    lca_pool_unlock();
+}
+
+// must be called with the pool locked.
+static void lca_pool_push_free_blocks(int64_t size_class, void** blocks, int64_t count) {
+    lca_pool_free_stack* free_stack = &lca_pool.free_stacks[size_class];
+    if (free_stack->count + count > free_stack->capacity) {
+        if (free_stack->capacity == 0) free_stack->capacity = 256;
+        while (free_stack->count + count > free_stack->capacity)
+            free_stack->capacity *= 2;
+        free_stack->blocks = realloc(free_stack->blocks, (size_t)free_stack->capacity * sizeof *free_stack->blocks);
+        assert(free_stack->blocks != NULL);
+    }
+
+    memcpy(free_stack->blocks + free_stack->count, blocks, (size_t)count * sizeof *blocks);
+    free_stack->count += count;
+}
+
+static void lca_pool_flush_cache(int64_t size_class, lca_pool_cache* cache) {
+    assert(cache->count == LCA_POOL_CACHE_CAPACITY);
+
+    // the oldest blocks go, the most recently freed ones are the likeliest to still be in cache.
+    lca_pool_lock();
+    lca_pool_push_free_blocks(size_class, cache->blocks, LCA_POOL_BATCH_COUNT);
+    lca_pool_unlock();
+
+    memmove(cache->blocks, cache->blocks + LCA_POOL_BATCH_COUNT, (size_t)(cache->count - LCA_POOL_BATCH_COUNT) * sizeof *cache->blocks);
+    cache->count -= LCA_POOL_BATCH_COUNT;
+}
+
+static void* lca_pool_allocate(size_t count) {
+    if (count > LCA_POOL_MAX_BLOCK_SIZE) {
+        lca_pool_header* header = calloc(1, sizeof *header + count);
+        assert(header != NULL);
+        header->size_class = LCA_POOL_LARGE_CLASS;
+        header->size = (int64_t)count;
+        return header + 1;
+    }
+
+    int64_t size_class = lca_pool_size_class(count);
+    lca_pool_cache* cache = &lca_pool_thread_caches[size_class];
+    if (cache->count == 0) {
+        lca_pool_refill_cache(size_class, cache);
+    }
+
+    cache->count--;
+    void* block = cache->blocks[cache->count];
+
+    memset(block, 0, count);
+    return block;
+}
+
+static void lca_pool_deallocate(void* ptr) {
+    lca_pool_header* header = (lca_pool_header*)ptr - 1;
+    if (header->size_class == LCA_POOL_LARGE_CLASS) {
+        free(header);
+        return;
+    }
+
+    lca_pool_cache* cache = &lca_pool_thread_caches[header->size_class];
+    if (cache->count == LCA_POOL_CACHE_CAPACITY) {
+        lca_pool_flush_cache(header->size_class, cache);
+    }
+
+    cache->blocks[cache->count] = ptr;
+    cache->count++;
+}
+
+void lca_pool_thread_release(void) {
+    lca_pool_lock();
+
+    for (int64_t size_class = 0; size_class < LCA_POOL_CLASS_COUNT; size_class++) {
+        lca_pool_cache* cache = &lca_pool_thread_caches[size_class];
+        if (cache->count == 0) continue;
+
+        lca_pool_push_free_blocks(size_class, cache->blocks, cache->count);
+        cache->count = 0;
+    }
+
+    lca_pool_unlock();
+}
+
+static void* lca_pool_reallocate(void* ptr, size_t count) {
+    lca_pool_header* header = (lca_pool_header*)ptr - 1;
+    size_t old_size = (size_t)header->size;
+
+    if (header->size_class == LCA_POOL_LARGE_CLASS) {
+        if (count > LCA_POOL_MAX_BLOCK_SIZE) {
+            header = realloc(header, sizeof *header + count);
+            assert(header != NULL);
+            header->size = (int64_t)count;
+            return header + 1;
+        }
+    } else if (count <= old_size) {
+        return ptr;
+    }
+
+    void* result = lca_pool_allocate(count);
+    memcpy(result, ptr, old_size < count ? old_size : count);
+    lca_pool_deallocate(ptr);
+    return result;
+}
+
+void* lca_pool_allocator_function(void* user_data, size_t count, void* ptr) {
+    if (count == 0) {
+        if (ptr != NULL) lca_pool_deallocate(ptr);
+        return NULL;
+    } else if (ptr == NULL) {
+        return lca_pool_allocate(count);
+    } else {
+        return lca_pool_reallocate(ptr, count);
+    }
+}
+
 void* lca_temp_allocator_function(void* user_data, size_t count, void* ptr) {
-    lca_arena* temp_arena = temp_allocator.user_data;
-    assert(temp_arena != NULL && "Where did the arena go? did you init it?");
+    lca_arena* temp_arena = lca_temp_arena;
+    assert(temp_arena != NULL && "Where did the arena go? did you init it on this thread?");
     assert(ptr == NULL && "Cannot reallocate temp arena memory");
     return lca_arena_push(temp_arena, count);
 }
 
 void lca_temp_allocator_init(lca_allocator allocator, int64_t block_size) {
-    assert(temp_allocator.user_data == NULL);
-    temp_allocator = (lca_allocator){
-        .user_data = lca_arena_create(allocator, block_size),
-        .allocator_function = lca_temp_allocator_function,
-    };
+    assert(lca_temp_arena == NULL && "the temp allocator was already initialized on this thread");
+    lca_temp_arena = lca_arena_create(allocator, (size_t)block_size);
+    assert(lca_temp_arena != NULL);
+}
+
+void lca_temp_allocator_destroy(void) {
+    if (lca_temp_arena == NULL) return;
+    lca_arena_destroy(lca_temp_arena);
+    lca_temp_arena = NULL;
+}
 
-    assert(temp_allocator.user_data != NULL);
+bool lca_temp_allocator_is_initialized(void) {
+    return lca_temp_arena != NULL;
 }
 
 void lca_temp_allocator_clear(void) {
-    lca_arena* temp_arena = temp_allocator.user_data;
-    lca_arena_clear(temp_arena);
+    assert(lca_temp_arena != NULL);
+    lca_arena_clear(lca_temp_arena);
+}
+
+void lca_temp_allocator_reset(void) {
+    assert(lca_temp_arena != NULL);
+    lca_arena_reset(lca_temp_arena);
 }
 
 void lca_temp_allocator_dump(void) {
-    lca_arena* temp_arena = temp_allocator.user_data;
-    lca_arena_dump(temp_arena);
+    assert(lca_temp_arena != NULL);
+    lca_arena_dump(lca_temp_arena);
+}
+
+lca_arena_mark lca_temp_mark(void) {
+    assert(lca_temp_arena != NULL);
+    return lca_arena_get_mark(lca_temp_arena);
+}
+
+void lca_temp_restore(lca_arena_mark mark) {
+    assert(lca_temp_arena != NULL);
+    lca_arena_restore(lca_temp_arena, mark);
 }
 
 char* lca_temp_sprintf(const char* format, ...) {
@@ -771,23 +1912,27 @@ char* lca_temp_vsprintf(const char* format, va_list v) {
     return result;
 }
 
-lca_arena_block lca_arena_block_create(lca_arena* arena) {
+lca_arena_block lca_arena_block_create(lca_arena* arena, int64_t capacity) {
+    void* memory = lca_allocate(arena->allocator, (size_t)capacity);
+    assert(memory != NULL);
     return (lca_arena_block){
-        .memory = lca_allocate(arena->allocator, arena->block_size),
-        .capacity = arena->block_size,
+        .memory = memory,
+        .capacity = capacity,
     };
 }
 
 lca_arena* lca_arena_create(lca_allocator allocator, size_t block_size) {
-    lca_arena* arena = lca_allocate(allocator, block_size);
+    assert(block_size > 0);
+
+    lca_arena* arena = lca_allocate(allocator, sizeof *arena);
+    assert(arena != NULL);
     *arena = (lca_arena){
         .allocator = allocator,
-        .block_size = block_size
+        .current_block = -1,
+        .block_size = (int64_t)block_size,
+        .next_block_size = (int64_t)block_size < LCA_ARENA_INITIAL_BLOCK_SIZE ? (int64_t)block_size : LCA_ARENA_INITIAL_BLOCK_SIZE,
     };
 
-    lca_arena_block first_block = lca_arena_block_create(arena);
-    lca_da_push(arena->blocks, first_block);
-
     return arena;
 }
 
@@ -808,41 +1953,192 @@ void lca_arena_destroy(lca_arena* arena) {
     lca_deallocate(allocator, arena);
 }
 
-void* lca_arena_push(lca_arena* arena, size_t count) {
-    assert(count <= (size_t)arena->block_size && "Requested more memory than a temp arena block can hold :(");
+static void* lca_arena_block_push_aligned(lca_arena_block* block, int64_t count, int64_t alignment) {
+    uintptr_t start = (uintptr_t)block->memory + (uintptr_t)block->allocated;
+    uintptr_t aligned_start = (start + (uintptr_t)alignment - 1) & ~((uintptr_t)alignment - 1);
+    int64_t padding = (int64_t)(aligned_start - start);
+
+    if (block->capacity - block->allocated < padding + count) {
+        return NULL;
+    }
+
+    block->allocated += padding + count;
+    return (void*)aligned_start;
+}
+
+static void lca_arena_insert_block(lca_arena* arena, int64_t index, lca_arena_block block) {
+    int64_t block_count = lca_da_count(arena->blocks);
+    assert(index >= 0 && index <= block_count);
+
+    lca_da_push(arena->blocks, block);
+    memmove(&arena->blocks[index + 1], &arena->blocks[index], (size_t)(block_count - index) * sizeof *arena->blocks);
+    arena->blocks[index] = block;
+}
 
-    lca_arena_block* block = &arena->blocks[lca_da_count(arena->blocks) - 1];
-    if (block->capacity - block->allocated < (int64_t)count) {
-        lca_arena_block new_block = lca_arena_block_create(arena);
-        lca_da_push(arena->blocks, new_block);
-        block = &arena->blocks[lca_da_count(arena->blocks) - 1];
+void* lca_arena_push_aligned_uninit(lca_arena* arena, size_t size, size_t alignment) {
+    assert(arena != NULL);
+    assert(alignment > 0 && (alignment & (alignment - 1)) == 0 && "Arena alignment must be a power of two");
+
+    int64_t count = (int64_t)size;
+
+    // the current block first, then any unused blocks kept by a reset.
+    for (int64_t i = arena->current_block < 0 ? 0 : arena->current_block, block_count = lca_da_count(arena->blocks); i < block_count; i++) {
+        void* result = lca_arena_block_push_aligned(&arena->blocks[i], count, (int64_t)alignment);
+        if (result != NULL) {
+            arena->current_block = i;
+            return result;
+        }
+    }
+
+    // block memory is only guaranteed to be aligned the way malloc aligns it, anything stricter may need padding.
+    int64_t required_capacity = count;
+    if ((int64_t)alignment > (int64_t)_Alignof(max_align_t)) {
+        required_capacity += (int64_t)alignment - 1;
+    }
+
+    if (required_capacity > arena->block_size) {
+        // a dedicated block, exactly as large as this request. it goes before the current
+        // block so that the space remaining in the current block can still be used.
+        lca_arena_block dedicated_block = lca_arena_block_create(arena, required_capacity);
+        void* result = lca_arena_block_push_aligned(&dedicated_block, count, (int64_t)alignment);
+        assert(result != NULL);
+
+        if (arena->current_block < 0) {
+            // pushes still try it first, but that only costs a failed check.
+            lca_da_push(arena->blocks, dedicated_block);
+            arena->current_block = 0;
+        } else {
+            lca_arena_insert_block(arena, arena->current_block, dedicated_block);
+            arena->current_block++;
+        }
+
+        return result;
     }
 
-    void* result = (char*)block->memory + block->allocated;
-    block->allocated += count;
-    memset(result, 0, count);
+    int64_t new_block_size = arena->next_block_size;
+    while (new_block_size < required_capacity)
+        new_block_size *= 2;
+    if (new_block_size > arena->block_size)
+        new_block_size = arena->block_size;
+
+    arena->next_block_size = new_block_size * 2 > arena->block_size ? arena->block_size : new_block_size * 2;
+
+    // the new block goes right after the current one, the kept blocks after it were too small for this request.
+    lca_arena_block new_block = lca_arena_block_create(arena, new_block_size);
+    void* result = lca_arena_block_push_aligned(&new_block, count, (int64_t)alignment);
+    assert(result != NULL);
+
+    arena->current_block++;
+    lca_arena_insert_block(arena, arena->current_block, new_block);
+
+    return result;
+}
 
+void* lca_arena_push_aligned(lca_arena* arena, size_t size, size_t alignment) {
+    void* result = lca_arena_push_aligned_uninit(arena, size, alignment);
+    memset(result, 0, size);
     return result;
 }
 
+void* lca_arena_push(lca_arena* arena, size_t count) {
+    return lca_arena_push_aligned(arena, count, _Alignof(max_align_t));
+}
+
+void* lca_arena_push_uninit(lca_arena* arena, size_t count) {
+    return lca_arena_push_aligned_uninit(arena, count, _Alignof(max_align_t));
+}
+
 void lca_arena_clear(lca_arena* arena) {
     for (int64_t i = 0, count = lca_da_count(arena->blocks); i < count; i++) {
         lca_arena_block* block = &arena->blocks[i];
-        memset(block->memory, 0, block->capacity);
         lca_deallocate(arena->allocator, block->memory);
     }
 
     lca_da_free(arena->blocks);
     arena->blocks = NULL;
 
-    lca_arena_block first_block = lca_arena_block_create(arena);
-    lca_da_push(arena->blocks, first_block);
+    arena->current_block = -1;
+    arena->next_block_size = arena->block_size < LCA_ARENA_INITIAL_BLOCK_SIZE ? arena->block_size : LCA_ARENA_INITIAL_BLOCK_SIZE;
+}
+
+void lca_arena_reset(lca_arena* arena) {
+    int64_t kept_count = 0;
+    for (int64_t i = 0, count = lca_da_count(arena->blocks); i < count; i++) {
+        lca_arena_block block = arena->blocks[i];
+        if (block.capacity > arena->block_size) {
+            lca_deallocate(arena->allocator, block.memory);
+            continue;
+        }
+
+        block.allocated = 0;
+        arena->blocks[kept_count] = block;
+        kept_count++;
+    }
+
+    if (arena->blocks != NULL) {
+        lca_da_get_header(arena->blocks)->count = kept_count;
+    }
+
+    arena->current_block = kept_count > 0 ? 0 : -1;
+}
+
+lca_arena_mark lca_arena_get_mark(lca_arena* arena) {
+    assert(arena != NULL);
+
+    if (arena->current_block < 0) {
+        return (lca_arena_mark){
+            .block_index = -1,
+        };
+    }
+
+    lca_arena_block* block = &arena->blocks[arena->current_block];
+    return (lca_arena_mark){
+        .block_index = arena->current_block,
+        .block_memory = block->memory,
+        .allocated = block->allocated,
+    };
+}
+
+void lca_arena_restore(lca_arena* arena, lca_arena_mark mark) {
+    assert(arena != NULL);
+
+    if (mark.block_index < 0) {
+        lca_arena_reset(arena);
+        return;
+    }
+
+    // blocks before the marked one never move. dedicated blocks pushed since the mark are
+    // inserted at or after its index, and regular blocks only ever follow the marked block.
+    int64_t kept_count = mark.block_index;
+    int64_t marked_block = -1;
+    for (int64_t i = mark.block_index, count = lca_da_count(arena->blocks); i < count; i++) {
+        lca_arena_block block = arena->blocks[i];
+        if (block.memory == mark.block_memory) {
+            assert(marked_block < 0);
+            block.allocated = mark.allocated;
+            marked_block = kept_count;
+        } else if (block.capacity > arena->block_size) {
+            lca_deallocate(arena->allocator, block.memory);
+            continue;
+        } else {
+            assert(marked_block >= 0 && "Arena mark is no longer valid");
+            block.allocated = 0;
+        }
+
+        arena->blocks[kept_count] = block;
+        kept_count++;
+    }
+
+    assert(marked_block >= 0 && "Arena mark is no longer valid");
+    lca_da_get_header(arena->blocks)->count = kept_count;
+    arena->current_block = marked_block;
 }
 
 void lca_arena_dump(lca_arena* arena) {
     fprintf(stderr, "<Memory Arena %p>\n", (void*)arena);
     fprintf(stderr, "  Block Count: %ld\n", lca_da_count(arena->blocks));
     fprintf(stderr, "  Block Size: %ld\n", arena->block_size);
+    fprintf(stderr, "  Next Block Size: %ld\n", arena->next_block_size);
     fprintf(stderr, "  Block Storage: %p\n", (void*)arena->blocks);
     fprintf(stderr, "  Allocator:\n");
     fprintf(stderr, "    User Data: %p\n", (void*)arena->allocator.user_data);
@@ -911,6 +2207,52 @@ lca_string lca_file_read(lca_allocator allocator, const char* file_path) {
     return lca_string_from_data(allocator, data, count, count + 1);
 }
 
+bool lca_file_map(const char* file_path, lca_string_view* out_contents) {
+    assert(file_path != NULL);
+    assert(out_contents != NULL);
+
+#    if _WIN32
+    return false;
+#    else
+    int fd = open(file_path, O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat statbuf;
+    if (fstat(fd, &statbuf) < 0 || !S_ISREG(statbuf.st_mode)) {
+        close(fd);
+        return false;
+    }
+
+    // the bytes past the end of the file in its last page read as zero, which is the NUL terminator.
+    // files which exactly fill their last page have no such bytes, so those (and empty files) are read instead.
+    int64_t count = (int64_t)statbuf.st_size;
+    int64_t page_size = (int64_t)sysconf(_SC_PAGESIZE);
+    if (count == 0 || count % page_size == 0) {
+        close(fd);
+        return false;
+    }
+
+    void* data = mmap(NULL, (size_t)count, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+
+    if (data == MAP_FAILED) return false;
+
+    *out_contents = (lca_string_view){
+        .data = data,
+        .count = count,
+    };
+
+    return true;
+#    endif
+}
+
+void lca_file_unmap(lca_string_view contents) {
+#    if !_WIN32
+    if (contents.data == NULL) return;
+    munmap((void*)contents.data, (size_t)contents.count);
+#    endif
+}
+
 char* lca_plat_self_exe(void) {
 #    if defined(__linux__)
     char* buffer = malloc(1024);
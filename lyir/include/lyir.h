@@ -58,10 +58,17 @@ typedef struct lyir_dependency_graph lyir_dependency_graph;
 // TODO(local): probably just include this in source files instead
 
 typedef int64_t lyir_sourceid;
+// identifies a distinct interned string within a context, see `lyir_context_intern_symbol`.
+typedef int32_t lyir_symbolid;
 
 typedef struct lyir_source {
     lca_string name;
     lca_string text;
+    // true if `text` is a read-only mapping of the source file rather than an allocated copy of it.
+    bool is_text_mapped;
+    // the offset of the first character of every line in `text`, built the
+    // first time a location within this source is resolved to a line and column.
+    lca_da(int64_t) line_start_offsets;
 } lyir_source;
 
 typedef struct lyir_target_info {
@@ -97,6 +104,7 @@ extern lyir_target_info* lyir_x86_64_windows;
 
 typedef struct lyir_type lyir_type;
 typedef struct lyir_value lyir_value;
+typedef struct lyir_use lyir_use;
 typedef struct lyir_module lyir_module;
 typedef struct lyir_builder lyir_builder;
 
@@ -107,6 +115,14 @@ typedef struct lyir_struct_member {
 
 typedef void (*lyir_ir_pass_function)(lyir_module* module);
 
+// identifies a uniqued integer or float constant by its value kind, type and bit pattern.
+// keys are compared by their bytes, so this is made of pointer-sized fields only and has no padding.
+typedef struct lyir_constant_key {
+    int64_t kind;
+    lyir_type* type;
+    uint64_t bits;
+} lyir_constant_key;
+
 typedef struct lyir_context {
     lca_allocator allocator;
     lyir_target_info* target;
@@ -116,12 +132,20 @@ typedef struct lyir_context {
     bool use_byte_positions_in_diagnostics;
 
     lca_da(lyir_source) sources;
+    // maps the canonical path of every source (as an interned string) to its id, so each file is only loaded once.
+    lca_hashmap(lca_string_view, lyir_sourceid) _sources_by_path;
     lca_da(lca_string_view) library_directories;
     lca_da(lca_string_view) link_libraries;
 
     int64_t max_interned_string_size;
     lca_arena* string_arena;
-    lca_da(lca_string) _interned_strings;
+    // every distinct interned string, indexed by its symbol id.
+    lca_da(lca_string_view) _interned_strings;
+    // the symbol id of every interned string, keyed by the interned copy.
+    lca_hashmap(lca_string_view, lyir_symbolid) _interned_string_index;
+    // how many bytes were copied into storage, and how many were not because the string was already interned.
+    int64_t interned_string_bytes_stored;
+    int64_t interned_string_bytes_saved;
     lca_da(lca_string) allocated_strings;
     lca_da(lyir_module*) ir_modules;
 
@@ -134,16 +158,30 @@ typedef struct lyir_context {
         lyir_type* poison;
         lyir_type* ptr;
         lyir_type* _void;
-        lca_da(lyir_type*) int_types;
         lyir_type* f32;
         lyir_type* f64;
     } types;
 
+    // every structural type (integers, arrays, functions and anonymous structs) is created
+    // once and looked up here afterwards, so equal types are always the same pointer.
+    // open addressing with linear probing, always a power of two in capacity.
+    struct {
+        lyir_type** entries;
+        int64_t capacity;
+        int64_t count;
+    } _unique_types;
+
     struct {
         lyir_value* _void;
     } values;
 
+    // values owned by the context rather than a module, e.g. constants, live in this arena.
+    lca_arena* value_arena;
     lca_da(lyir_value*) _all_values;
+
+    // integer and float constants are unique by their type and bit pattern, so equal constants
+    // are always the same pointer.
+    lca_hashmap(lyir_constant_key, lyir_value*) _unique_constants;
     lca_da(lyir_type*) _all_struct_types;
 } lyir_context;
 
@@ -245,12 +283,25 @@ typedef void lyir_dependency_entity;
 typedef struct lyir_dependency_entry {
     void* node;
     lca_da(lyir_dependency_entity*) dependencies;
+    // true if this entity was recorded as depending on itself.
+    bool depends_on_itself;
 } lyir_dependency_entry;
 
+typedef struct lyir_dependency_edge {
+    lyir_dependency_entity* node;
+    lyir_dependency_entity* dependency;
+} lyir_dependency_edge;
+
 struct lyir_dependency_graph {
     lyir_context* context;
     lca_arena* arena;
+    // every entity in the graph, in the order it was first seen, including entities which
+    // were only ever named as a dependency.
     lca_da(lyir_dependency_entry*) entries;
+    // the index into `entries` of each entity.
+    lca_hashmap(lyir_dependency_entity*, int64_t) entry_indices;
+    // every dependency already recorded, so duplicates are dropped in constant time.
+    lca_hashmap(lyir_dependency_edge, bool) edges;
 };
 
 typedef struct lyir_dependency_order_result {
@@ -259,14 +310,21 @@ typedef struct lyir_dependency_order_result {
         LYIR_DEP_CYCLE,
     } status;
 
-    union {
-        lca_da(lyir_dependency_entity*) ordered_entities;
-
-        struct {
-            lyir_dependency_entity* from;
-            lyir_dependency_entity* to;
-        };
-    };
+    // every entity in the graph, with dependencies before the entities depending on them.
+    // the members of each strongly connected component are adjacent.
+    lca_da(lyir_dependency_entity*) ordered_entities;
+    // the index into `ordered_entities` where each strongly connected component starts.
+    // no component depends on a component after it, so components can be processed in this order,
+    // and components which don't depend on each other can be processed independently.
+    lca_da(int64_t) component_starts;
+
+    // for LYIR_DEP_CYCLE, the cycle closed by the first back edge found, as a closed path:
+    // each entity depends on the next, and the last one depends on the first.
+    lca_da(lyir_dependency_entity*) cycle;
+    // the back edge itself, which is also the first two entities of `cycle`.
+    // `from` depends on `to` (they're equal for an entity depending on itself).
+    lyir_dependency_entity* from;
+    lyir_dependency_entity* to;
 } lyir_dependency_order_result;
 
 typedef enum lyir_type_kind {
@@ -418,7 +476,12 @@ void lyir_write_warn(lyir_context* context, lyir_location location, const char*
 void lyir_write_error(lyir_context* context, lyir_location location, const char* format, ...);
 void lyir_write_ice(lyir_context* context, lyir_location location, const char* format, ...);
 
+// Returns the canonical copy of `s` owned by the context. Interning the same text twice
+// returns the same view, so interned strings can be compared by their data pointer.
 lca_string_view lyir_context_intern_string_view(lyir_context* context, lca_string_view s);
+// Like `lyir_context_intern_string_view`, but returns a small integer id for the string instead.
+lyir_symbolid lyir_context_intern_symbol(lyir_context* context, lca_string_view s);
+lca_string_view lyir_context_symbol_name_get(lyir_context* context, lyir_symbolid symbol);
 
 #define LYIR_ICE(C, L, F) do { lyir_write_ice(C, L, F); abort(); } while (0)
 #define LYIR_ICEV(C, L, F, ...) do { lyir_write_ice(C, L, F, __VA_ARGS__); abort(); } while (0)
@@ -434,7 +497,13 @@ lyir_dependency_graph* lyir_dependency_graph_create_in_context(lyir_context* con
 void lyir_dependency_graph_destroy(lyir_dependency_graph* graph);
 void lyir_depgraph_add_dependency(lyir_dependency_graph* graph, lyir_dependency_entity* node, lyir_dependency_entity* dependency);
 void lyir_depgraph_ensure_tracked(lyir_dependency_graph* graph, lyir_dependency_entity* node);
+// orders the graph's entities and finds its strongly connected components, in time linear in the
+// number of entities and dependencies. the result must be released with `lyir_dependency_order_result_destroy`.
 lyir_dependency_order_result lyir_dependency_graph_get_ordered_entities(lyir_dependency_graph* graph);
+void lyir_dependency_order_result_destroy(lyir_dependency_order_result* result);
+int64_t lyir_dependency_order_result_component_count(lyir_dependency_order_result* result);
+// returns the members of the component at `component_index`, and stores how many there are in `out_count`.
+lyir_dependency_entity** lyir_dependency_order_result_component_get(lyir_dependency_order_result* result, int64_t component_index, int64_t* out_count);
 
 int lyir_get_significant_bits(int64_t value);
 
@@ -486,6 +555,10 @@ lyir_type* lyir_function_type(
     lyir_calling_convention calling_convention,
     bool is_variadic
 );
+// Types are unique within a context: structurally equal types are always pointer-equal, and the
+// type takes ownership of any parameter or member list passed to it (freeing it if the type already exists).
+// Named struct types are the exception; each call creates a new, distinct type, while an empty name
+// creates an anonymous struct type which is unique by its members.
 lyir_type* lyir_struct_type(lyir_context* context, lca_string_view name, lca_da(lyir_struct_member) members);
 
 bool lyir_type_is_ptr(lyir_type* type);
@@ -517,14 +590,23 @@ void lyir_type_print_to_string(lyir_type* type, lca_string* s, bool use_color);
 int64_t lyir_function_type_parameter_count_get(lyir_type* function_type);
 lyir_type* lyir_function_type_parameter_type_get_at_index(lyir_type* function_type, int64_t parameter_index);
 bool lyir_function_type_is_variadic(lyir_type* function_type);
-void lyir_function_type_parameter_type_set_at_index(lyir_type* function_type, int64_t parameter_index, lyir_type* param_type);
 
 // Value API
 
 const char* lyir_value_kind_to_cstring(lyir_value_kind kind);
 
+// Every operand slot referring to a value counts as a separate use, so a user may appear more than once.
+// Prefer walking the use list directly; looking up a user by index walks the list from the start.
 int64_t lyir_value_user_count_get(lyir_value* value);
 lyir_value* lyir_value_user_get_at_index(lyir_value* value, int64_t user_index);
+lyir_use* lyir_value_first_use_get(lyir_value* value);
+lyir_use* lyir_use_next_get(lyir_use* use);
+lyir_value* lyir_use_value_get(lyir_use* use);
+lyir_value* lyir_use_user_get(lyir_use* use);
+int64_t lyir_use_operand_index_get(lyir_use* use);
+// Rewrites every operand which refers to `value` to refer to `replacement` instead,
+// in time proportional to the number of uses of `value`.
+void lyir_value_replace_all_uses_with(lyir_value* value, lyir_value* replacement);
 
 int64_t lyir_value_integer_constant_get(lyir_value* value);
 double lyir_value_float_constant_get(lyir_value* value);
@@ -544,6 +626,8 @@ bool lyir_value_is_function(lyir_value* value);
 bool lyir_value_is_instruction(lyir_value* value);
 
 lyir_value* lyir_void_constant_create(lyir_context* context);
+// Integer and float constants are shared by every user of the same type and bit pattern,
+// so `location` is ignored and the constant they return has no location.
 lyir_value* lyir_int_constant_create(lyir_context* context, lyir_location location, lyir_type* type, int64_t value);
 lyir_value* lyir_float_constant_create(lyir_context* context, lyir_location location, lyir_type* type, double value);
 lyir_value* lyir_array_constant_create(lyir_context* context, lyir_location location, lyir_type* type, void* data, int64_t length, bool is_string_literal);
@@ -573,11 +657,23 @@ bool lyir_value_block_has_name(lyir_value* block);
 lca_string_view lyir_value_block_name_get(lyir_value* block);
 int64_t lyir_value_block_index_get(lyir_value* block);
 int64_t lyir_value_block_instruction_count_get(lyir_value* block);
+// Instructions are stored as a linked list, so prefer walking them with `lyir_value_instruction_next_get`.
+// Sequential lookups by index are still cheap, since the block caches the last instruction it looked up.
 lyir_value* lyir_value_block_instruction_get_at_index(lyir_value* block, int64_t instruction_index);
+lyir_value* lyir_value_block_first_instruction_get(lyir_value* block);
+lyir_value* lyir_value_block_last_instruction_get(lyir_value* block);
 bool lyir_value_block_is_terminated(lyir_value* block);
+// Moves the instructions from `first` through `last` (inclusive, both in the same block) into `block`,
+// before `insert_before` or at the end of the block if it is NULL. `insert_before` must not be one of the moved instructions.
+void lyir_value_block_splice(lyir_value* block, lyir_value* insert_before, lyir_value* first, lyir_value* last);
 
 // - Instruction API
 
+lyir_value* lyir_value_instruction_prev_get(lyir_value* instruction);
+lyir_value* lyir_value_instruction_next_get(lyir_value* instruction);
+// Unlinks this instruction from its block without destroying it, so it can be inserted somewhere else.
+void lyir_value_instruction_remove_from_parent(lyir_value* instruction);
+
 lyir_builtin_kind lyir_value_builtin_kind_get(lyir_value* instruction);
 
 bool lyir_value_global_is_string(lyir_value* global);
@@ -88,33 +88,38 @@ static void cback_print_module(cback_codegen* codegen, lyir_module* module) {
     cback_define_structs(codegen, context);
 
     for (int64_t i = 0, count = lyir_module_global_count(module); i < count; i++) {
-        if (i > 0) lca_string_append_format(codegen->output, "\n");
+        if (i > 0) lca_string_append_char(codegen->output, '\n');
         lyir_value* global = lyir_module_get_global_at_index(module, i);
         cback_print_global(codegen, global);
     }
 
-    if (lyir_module_global_count(module) > 0) lca_string_append_format(codegen->output, "\n");
+    if (lyir_module_global_count(module) > 0) lca_string_append_char(codegen->output, '\n');
 
     for (int64_t i = 0, count = lyir_module_function_count(module); i < count; i++) {
-        //if (i > 0) lca_string_append_format(codegen->output,  "\n");
+        //if (i > 0) lca_string_append_char(codegen->output, '\n');
         lyir_value* function = lyir_module_get_function_at_index(module, i);
         cback_declare_function(codegen, function);
     }
 
-    if (lyir_module_function_count(module) > 0) lca_string_append_format(codegen->output,  "\n");
+    if (lyir_module_function_count(module) > 0) lca_string_append_char(codegen->output, '\n');
 
     for (int64_t i = 0, count = lyir_module_function_count(module); i < count; i++) {
-        if (i > 0) lca_string_append_format(codegen->output,  "\n");
+        if (i > 0) lca_string_append_char(codegen->output, '\n');
         lyir_value* function = lyir_module_get_function_at_index(module, i);
+        lca_arena_mark temp_mark = lca_temp_mark();
         cback_define_function(codegen, function);
+        lca_temp_restore(temp_mark);
     }
 }
 
 static void cback_print_header(cback_codegen* codegen, lyir_module* module) {
-    lca_string_append_format(codegen->output, "// Source File: '%.*s'\n\n", LCA_STR_EXPAND(lyir_module_name(module)));
+    lca_string_append_cstring(codegen->output, "// Source File: '");
+    lca_string_append_view(codegen->output, lyir_module_name(module));
+    lca_string_append_cstring(codegen->output, "'\n\n");
 
     lca_string source_text = lca_file_read(codegen->context->allocator, "./lyir/lib/lyir_cir_preamble.h");
-    lca_string_append_format(codegen->output, "%s\n", lca_string_as_cstring(source_text));
+    lca_string_append_cstring(codegen->output, lca_string_as_cstring(source_text));
+    lca_string_append_char(codegen->output, '\n');
     lca_string_destroy(&source_text);
 }
 
@@ -122,12 +127,16 @@ static void cback_declare_structs(cback_codegen* codegen, lyir_context* context)
     for (int64_t i = 0; i < lyir_context_get_struct_type_count(codegen->context); i++) {
         lyir_type* struct_type = lyir_context_get_struct_type_at_index(codegen->context, i);
         if (lyir_type_struct_is_named(struct_type)) {
-            lca_string_append_format(codegen->output, "typedef struct %.*s %.*s;\n", LCA_STR_EXPAND(lyir_type_struct_name_get(struct_type)), LCA_STR_EXPAND(lyir_type_struct_name_get(struct_type)));
+            lca_string_append_cstring(codegen->output, "typedef struct ");
+            lca_string_append_view(codegen->output, lyir_type_struct_name_get(struct_type));
+            lca_string_append_char(codegen->output, ' ');
+            lca_string_append_view(codegen->output, lyir_type_struct_name_get(struct_type));
+            lca_string_append_cstring(codegen->output, ";\n");
         }
     }
 
     if (lyir_context_get_struct_type_count(codegen->context) > 0) {
-        lca_string_append_format(codegen->output, "\n");
+        lca_string_append_char(codegen->output, '\n');
     }
 }
 
@@ -135,18 +144,22 @@ static void cback_define_structs(cback_codegen* codegen, lyir_context* context)
     for (int64_t i = 0; i < lyir_context_get_struct_type_count(codegen->context); i++) {
         lyir_type* struct_type = lyir_context_get_struct_type_at_index(codegen->context, i);
         if (lyir_type_struct_is_named(struct_type)) {
-            lca_string_append_format(codegen->output, "struct %.*s {\n", LCA_STR_EXPAND(lyir_type_struct_name_get(struct_type)), LCA_STR_EXPAND(lyir_type_struct_name_get(struct_type)));
+            lca_string_append_cstring(codegen->output, "struct ");
+            lca_string_append_view(codegen->output, lyir_type_struct_name_get(struct_type));
+            lca_string_append_cstring(codegen->output, " {\n");
 
             for (int64_t member_index = 0; member_index < lyir_type_struct_member_count_get(struct_type); member_index++) {
-                lca_string_append_format(codegen->output, "    ");
+                lca_string_append_cstring(codegen->output, "    ");
 
                 lyir_type* member_type = lyir_type_struct_member_type_get_at_index(struct_type, member_index);
                 cback_print_type(codegen, member_type);
 
-                lca_string_append_format(codegen->output, " member_%d;\n", member_index);
+                lca_string_append_cstring(codegen->output, " member_");
+                lca_string_append_int(codegen->output, member_index);
+                lca_string_append_cstring(codegen->output, ";\n");
             }
         
-            lca_string_append_format(codegen->output, "};\n\n");
+            lca_string_append_cstring(codegen->output, "};\n\n");
         }
     }
 }
@@ -158,9 +171,10 @@ static void cback_print_block_name(cback_codegen* codegen, lyir_value* block) {
     if (lyir_value_block_has_name(block)) {
         lca_string_view block_name = lyir_value_block_name_get(block);
         // TODO(local): probably need to sanitize this
-        lca_string_append_format(codegen->output, "%.*s", LCA_STR_EXPAND(block_name));
+        lca_string_append_view(codegen->output, block_name);
     } else {
-        lca_string_append_format(codegen->output, "lyir_bb_%ld", lyir_value_block_index_get(block));
+        lca_string_append_cstring(codegen->output, "lyir_bb_");
+        lca_string_append_int(codegen->output, lyir_value_block_index_get(block));
     }
 }
 
@@ -169,10 +183,12 @@ static void cback_print_global(cback_codegen* codegen, lyir_value* global) {
 
 static void cback_print_function_prototype(cback_codegen* codegen, lyir_value* function) {
     cback_print_type(codegen, lyir_value_function_return_type_get(function));
-    lca_string_append_format(codegen->output, " %.*s(", LCA_STR_EXPAND(lyir_value_function_name_get(function)));
+    lca_string_append_char(codegen->output, ' ');
+    lca_string_append_view(codegen->output, lyir_value_function_name_get(function));
+    lca_string_append_char(codegen->output, '(');
 
     for (int64_t i = 0; i < lyir_value_function_parameter_count_get(function); i++) {
-        if (i > 0) lca_string_append_format(codegen->output, ", ");
+        if (i > 0) lca_string_append_cstring(codegen->output, ", ");
 
         lyir_value* param = lyir_value_function_parameter_get_at_index(function, i);
         assert(param != NULL);
@@ -181,151 +197,154 @@ static void cback_print_function_prototype(cback_codegen* codegen, lyir_value* f
         assert(param_type != NULL);
 
         cback_print_type(codegen, param_type);
-        lca_string_append_format(codegen->output, " %.*s", LCA_STR_EXPAND(lyir_value_name_get(param)));
+        lca_string_append_char(codegen->output, ' ');
+        lca_string_append_view(codegen->output, lyir_value_name_get(param));
     }
 
     if (lyir_value_function_is_variadic(function)) {
         if (lyir_value_function_parameter_count_get(function) > 0) {
-            lca_string_append_format(codegen->output, ", ...");
+            lca_string_append_cstring(codegen->output, ", ...");
         } else {
-            lca_string_append_format(codegen->output, "...");
+            lca_string_append_cstring(codegen->output, "...");
         }
     }
 
-    lca_string_append_format(codegen->output, ")");
+    lca_string_append_char(codegen->output, ')');
 }
 
 static void cback_declare_function(cback_codegen* codegen, lyir_value* function) {
     cback_print_function_prototype(codegen, function);
-    lca_string_append_format(codegen->output, ";\n");
+    lca_string_append_cstring(codegen->output, ";\n");
 }
 
 static void cback_define_function(cback_codegen* codegen, lyir_value* function) {
     cback_print_function_prototype(codegen, function);
-    lca_string_append_format(codegen->output, " {\n");
+    lca_string_append_cstring(codegen->output, " {\n");
 
     for (int64_t block_index = 0; block_index < lyir_value_function_block_count_get(function); block_index++) {
         lyir_value* block = lyir_value_function_block_get_at_index(function, block_index);
         assert(block != NULL);
 
         cback_print_block_name(codegen, block);
-        lca_string_append_format(codegen->output, ":;\n");
+        lca_string_append_cstring(codegen->output, ":;\n");
         for (int64_t inst_index = 0; inst_index < lyir_value_block_instruction_count_get(block); inst_index++) {
             lyir_value* inst = lyir_value_block_instruction_get_at_index(block, inst_index);
             assert(inst != NULL);
 
-            lca_string_append_format(codegen->output, "    ");
+            lca_string_append_cstring(codegen->output, "    ");
 
             if (!lyir_type_is_void(lyir_value_type_get(inst))) {
                 cback_print_value(codegen, inst, true);
-                lca_string_append_format(codegen->output, " = ");
+                lca_string_append_cstring(codegen->output, " = ");
             }
             
             switch (lyir_value_kind_get(inst)) {
                 default: {
                     fprintf(stderr, "for lyir type '%s'\n", lyir_value_kind_to_cstring(lyir_value_kind_get(inst)));
                     //assert(false && "unhandled LYIR instruction in C backend\n");
-                    lca_string_append_format(codegen->output, "<<%s>>;", lyir_value_kind_to_cstring(lyir_value_kind_get(inst)));
+                    lca_string_append_cstring(codegen->output, "<<");
+                    lca_string_append_cstring(codegen->output, lyir_value_kind_to_cstring(lyir_value_kind_get(inst)));
+                    lca_string_append_cstring(codegen->output, ">>;");
                 } break;
 
                 case LYIR_IR_RETURN: {
-                    lca_string_append_format(codegen->output, "return");
+                    lca_string_append_cstring(codegen->output, "return");
 
                     if (lyir_value_return_has_value(inst)) {
-                        lca_string_append_format(codegen->output, " ");
+                        lca_string_append_char(codegen->output, ' ');
                         cback_print_value(codegen, lyir_value_return_value_get(inst), false);
                     }
 
-                    lca_string_append_format(codegen->output, ";");
+                    lca_string_append_char(codegen->output, ';');
                 } break;
 
                 case LYIR_IR_BRANCH: {
-                    lca_string_append_format(codegen->output, "goto ");
+                    lca_string_append_cstring(codegen->output, "goto ");
                     cback_print_block_name(codegen, lyir_value_branch_pass_get(inst));
-                    lca_string_append_format(codegen->output, ";");
+                    lca_string_append_char(codegen->output, ';');
                 } break;
 
                 case LYIR_IR_COND_BRANCH: {
                     lyir_value* condition_value = lyir_value_operand_get(inst);
                     lyir_value* pass_block = lyir_value_branch_pass_get(inst);
                     lyir_value* fail_block = lyir_value_branch_fail_get(inst);
-                    lca_string_append_format(codegen->output, "if (");
+                    lca_string_append_cstring(codegen->output, "if (");
                     cback_print_value(codegen, condition_value, false);
-                    lca_string_append_format(codegen->output, ") { goto ");
+                    lca_string_append_cstring(codegen->output, ") { goto ");
                     cback_print_block_name(codegen, pass_block);
-                    lca_string_append_format(codegen->output, "; } else { goto ");
+                    lca_string_append_cstring(codegen->output, "; } else { goto ");
                     cback_print_block_name(codegen, fail_block);
-                    lca_string_append_format(codegen->output, "; }");
+                    lca_string_append_cstring(codegen->output, "; }");
                 } break;
 
                 case LYIR_IR_ALLOCA: {
-                    lca_string_append_format(codegen->output, "{0};");
+                    lca_string_append_cstring(codegen->output, "{0};");
                 } break;
 
                 case LYIR_IR_STORE: {
-                    lca_string_append_format(codegen->output, "*(");
+                    lca_string_append_cstring(codegen->output, "*(");
                     cback_print_type(codegen, lyir_value_type_get(lyir_value_operand_get(inst)));
-                    lca_string_append_format(codegen->output, "*)(");
+                    lca_string_append_cstring(codegen->output, "*)(");
                     cback_print_value(codegen, lyir_value_address_get(inst), false);
-                    lca_string_append_format(codegen->output, ") = ");
+                    lca_string_append_cstring(codegen->output, ") = ");
                     cback_print_value(codegen, lyir_value_operand_get(inst), false);
-                    lca_string_append_format(codegen->output, ";");
+                    lca_string_append_char(codegen->output, ';');
                 } break;
 
                 case LYIR_IR_LOAD: {
-                    lca_string_append_format(codegen->output, "*(");
+                    lca_string_append_cstring(codegen->output, "*(");
                     cback_print_type(codegen, lyir_value_type_get(inst));
-                    lca_string_append_format(codegen->output, "*)(");
+                    lca_string_append_cstring(codegen->output, "*)(");
                     cback_print_value(codegen, lyir_value_address_get(inst), false);
-                    lca_string_append_format(codegen->output, ");");
+                    lca_string_append_cstring(codegen->output, ");");
                 } break;
 
                 case LYIR_IR_ADD: {
-                    lca_string_append_format(codegen->output, "(");
+                    lca_string_append_char(codegen->output, '(');
                     cback_print_value(codegen, lyir_value_lhs_get(inst), false);
-                    lca_string_append_format(codegen->output, ") + (");
+                    lca_string_append_cstring(codegen->output, ") + (");
                     cback_print_value(codegen, lyir_value_rhs_get(inst), false);
-                    lca_string_append_format(codegen->output, ");");
+                    lca_string_append_cstring(codegen->output, ");");
                 } break;
 
                 case LYIR_IR_SUB: {
-                    lca_string_append_format(codegen->output, "(");
+                    lca_string_append_char(codegen->output, '(');
                     cback_print_value(codegen, lyir_value_lhs_get(inst), false);
-                    lca_string_append_format(codegen->output, ") - (");
+                    lca_string_append_cstring(codegen->output, ") - (");
                     cback_print_value(codegen, lyir_value_rhs_get(inst), false);
-                    lca_string_append_format(codegen->output, ");");
+                    lca_string_append_cstring(codegen->output, ");");
                 } break;
 
                 case LYIR_IR_ICMP_SLT: {
-                    lca_string_append_format(codegen->output, "(");
+                    lca_string_append_char(codegen->output, '(');
                     cback_print_value(codegen, lyir_value_lhs_get(inst), false);
-                    lca_string_append_format(codegen->output, ") < (");
+                    lca_string_append_cstring(codegen->output, ") < (");
                     cback_print_value(codegen, lyir_value_rhs_get(inst), false);
-                    lca_string_append_format(codegen->output, ");");
+                    lca_string_append_cstring(codegen->output, ");");
                 } break;
 
                 case LYIR_IR_CALL: {
                     cback_print_value(codegen, lyir_value_callee_get(inst), false);
-                    lca_string_append_format(codegen->output, "(");
+                    lca_string_append_char(codegen->output, '(');
 
                     for (int64_t i = 0, count = lyir_value_call_argument_count_get(inst); i < count; i++) {
                         if (i > 0) {
-                            lca_string_append_format(codegen->output, ", ");
+                            lca_string_append_cstring(codegen->output, ", ");
                         }
 
                         lyir_value* argument = lyir_value_call_argument_get_at_index(inst, i);
                         cback_print_value(codegen, argument, false);
                     }
 
-                    lca_string_append_format(codegen->output, ");");
+                    lca_string_append_cstring(codegen->output, ");");
                 } break;
             }
 
-            lca_string_append_format(codegen->output, "\n");
+            lca_string_append_char(codegen->output, '\n');
         }
     }
 
-    lca_string_append_format(codegen->output, "}\n");
+    lca_string_append_cstring(codegen->output, "}\n");
 }
 
 static void cback_print_type(cback_codegen* codegen, lyir_type* type) {
@@ -336,27 +355,29 @@ static void cback_print_type(cback_codegen* codegen, lyir_type* type) {
         } break;
 
         case LYIR_TYPE_VOID: {
-            lca_string_append_format(codegen->output, "void");
+            lca_string_append_cstring(codegen->output, "void");
         } break;
 
         case LYIR_TYPE_POINTER: {
-            lca_string_append_format(codegen->output, "lyir_ptr");
+            lca_string_append_cstring(codegen->output, "lyir_ptr");
         } break;
 
         case LYIR_TYPE_INTEGER: {
             int bit_width = lyir_type_size_in_bits(type);
             if (bit_width == 1) {
-                lca_string_append_format(codegen->output, "lyir_bool");
+                lca_string_append_cstring(codegen->output, "lyir_bool");
             } else if (bit_width == 8) {
-                lca_string_append_format(codegen->output, "lyir_i8");
+                lca_string_append_cstring(codegen->output, "lyir_i8");
             } else if (bit_width == 16) {
-                lca_string_append_format(codegen->output, "lyir_i16");
+                lca_string_append_cstring(codegen->output, "lyir_i16");
             } else if (bit_width == 32) {
-                lca_string_append_format(codegen->output, "lyir_i32");
+                lca_string_append_cstring(codegen->output, "lyir_i32");
             } else if (bit_width == 64) {
-                lca_string_append_format(codegen->output, "lyir_i64");
+                lca_string_append_cstring(codegen->output, "lyir_i64");
             } else {
-                lca_string_append_format(codegen->output, "_BitInt(%d)", bit_width);
+                lca_string_append_cstring(codegen->output, "_BitInt(");
+                lca_string_append_int(codegen->output, bit_width);
+                lca_string_append_char(codegen->output, ')');
                 //fprintf(stderr, "unsupported bit width: %d\n", bit_width);
                 //assert(false && "unsupported int bit width in C backend");
             }
@@ -365,9 +386,9 @@ static void cback_print_type(cback_codegen* codegen, lyir_type* type) {
         case LYIR_TYPE_FLOAT: {
             int bit_width = lyir_type_size_in_bits(type);
             if (bit_width == 32) {
-                lca_string_append_format(codegen->output, "lyir_f32");
+                lca_string_append_cstring(codegen->output, "lyir_f32");
             } else if (bit_width == 64) {
-                lca_string_append_format(codegen->output, "lyir_f64");
+                lca_string_append_cstring(codegen->output, "lyir_f64");
             } else {
                 fprintf(stderr, "unsupported bit width: %d\n", bit_width);
                 assert(false && "unsupported float bit width in C backend");
@@ -379,7 +400,7 @@ static void cback_print_type(cback_codegen* codegen, lyir_type* type) {
 static void cback_print_value(cback_codegen* codegen, lyir_value* value, bool include_type) {
     if (include_type) {
         cback_print_type(codegen, lyir_value_type_get(value));
-        lca_string_append_format(codegen->output, " ");
+        lca_string_append_char(codegen->output, ' ');
     }
 
     switch (lyir_value_kind_get(value)) {
@@ -387,46 +408,49 @@ static void cback_print_value(cback_codegen* codegen, lyir_value* value, bool in
             lca_string_view name = lyir_value_name_get(value);
             if (name.count == 0) {
                 int64_t index = lyir_value_index_get(value);
-                lca_string_append_format(codegen->output, "lyir_inst_%lld", index);
+                lca_string_append_cstring(codegen->output, "lyir_inst_");
+                lca_string_append_int(codegen->output, index);
             } else {
-                lca_string_append_format(codegen->output, "%.*s", LCA_STR_EXPAND(name));
+                lca_string_append_view(codegen->output, name);
             }
         } break;
 
         case LYIR_IR_FUNCTION: {
-            lca_string_append_format(codegen->output, "%.*s", LCA_STR_EXPAND(lyir_value_function_name_get(value)));
+            lca_string_append_view(codegen->output, lyir_value_function_name_get(value));
         } break;
 
         case LYIR_IR_GLOBAL_VARIABLE: {
             lca_string_view name = lyir_value_name_get(value);
             if (name.count == 0) {
                 int64_t index = lyir_value_index_get(value);
-                lca_string_append_format(codegen->output, "lyir_glbl_%lld", index);
+                lca_string_append_cstring(codegen->output, "lyir_glbl_");
+                lca_string_append_int(codegen->output, index);
             } else {
-                lca_string_append_format(codegen->output, "%.*s", LCA_STR_EXPAND(name));
+                lca_string_append_view(codegen->output, name);
             }
         } break;
 
         case LYIR_IR_INTEGER_CONSTANT: {
             int64_t ival = lyir_value_integer_constant_get(value);
             if (lyir_type_is_ptr(lyir_value_type_get(value)) && ival == 0)
-                lca_string_append_format(codegen->output, "NULL");
-            else lca_string_append_format(codegen->output, "%lld", ival);
+                lca_string_append_cstring(codegen->output, "NULL");
+            else lca_string_append_int(codegen->output, ival);
         } break;
 
         case LYIR_IR_FLOAT_CONSTANT: {
             double float_value = lyir_value_float_constant_get(value);
-            lca_string_append_format(codegen->output, "%f", float_value);
+            lca_string_append_double(codegen->output, float_value);
         } break;
 
         case LYIR_IR_ALLOCA: {
-            if (!include_type) lca_string_append_format(codegen->output, "&");
+            if (!include_type) lca_string_append_char(codegen->output, '&');
             lca_string_view name = lyir_value_name_get(value);
             if (name.count == 0) {
                 int64_t index = lyir_value_index_get(value);
-                lca_string_append_format(codegen->output, "lyir_inst_%lld", index);
+                lca_string_append_cstring(codegen->output, "lyir_inst_");
+                lca_string_append_int(codegen->output, index);
             } else {
-                lca_string_append_format(codegen->output, "%.*s", LCA_STR_EXPAND(name));
+                lca_string_append_view(codegen->output, name);
             }
         } break;
     }
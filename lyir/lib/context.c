@@ -114,6 +114,12 @@ lyir_context* lyir_context_create(lca_allocator allocator) {
     context->type_arena = lca_arena_create(allocator, 1024 * 1024);
     assert(context->type_arena != NULL);
 
+    context->value_arena = lca_arena_create(allocator, 256 * 1024);
+    assert(context->value_arena != NULL);
+
+    lca_hashmap_init(context->_interned_string_index, allocator, 1024);
+    lca_hashmap_init(context->_unique_constants, allocator, 64);
+
     return context;
 }
 
@@ -125,15 +131,23 @@ void lyir_context_destroy(lyir_context* context) {
     for (int64_t i = 0, count = lca_da_count(context->sources); i < count; i++) {
         lyir_source* source = &context->sources[i];
         lca_string_destroy(&source->name);
-        lca_string_destroy(&source->text);
+        if (source->is_text_mapped) {
+            lca_file_unmap(lca_string_as_view(source->text));
+        } else {
+            lca_string_destroy(&source->text);
+        }
+
+        lca_da_free(source->line_start_offsets);
     }
 
     lca_da_free(context->sources);
+    lca_hashmap_free(context->_sources_by_path);
     lca_da_free(context->library_directories);
     lca_da_free(context->link_libraries);
 
     lca_arena_destroy(context->string_arena);
     lca_da_free(context->_interned_strings);
+    lca_hashmap_free(context->_interned_string_index);
 
     for (int64_t i = 0, count = lca_da_count(context->allocated_strings); i < count; i++) {
         lca_string* string = &context->allocated_strings[i];
@@ -158,43 +172,67 @@ void lyir_context_destroy(lyir_context* context) {
         layec_type_destroy(context->_all_types[i]);
     }
     
-    lca_da_free(context->types.int_types);
+    lca_deallocate(allocator, context->_unique_types.entries);
     lca_da_free(context->_all_types);
     lca_da_free(context->_all_struct_types);
     lca_arena_destroy(context->type_arena);
 
     for (int64_t i = 0, count = lca_da_count(context->_all_values); i < count; i++) {
         layec_value_destroy(context->_all_values[i]);
-        lca_deallocate(allocator, context->_all_values[i]);
     }
 
     lca_da_free(context->_all_values);
+    lca_hashmap_free(context->_unique_constants);
+    lca_arena_destroy(context->value_arena);
 
     *context = (lyir_context){0};
     lca_deallocate(allocator, context);
 }
 
-static int read_file_to_string(lca_allocator allocator, lca_string file_path, lca_string* out_contents) {
+static int read_file_to_string(lca_allocator allocator, lca_string file_path, lca_string* out_contents, bool* out_is_mapped) {
     assert(out_contents != NULL);
+    assert(out_is_mapped != NULL);
     const char* file_path_cstr = lca_string_as_cstring(file_path);
     assert(file_path_cstr != NULL);
+
+    // mapped files are never written to, and are NUL terminated just like the strings `lca_file_read` returns.
+    lca_string_view mapped_contents = {0};
+    if (lca_file_map(file_path_cstr, &mapped_contents)) {
+        *out_contents = (lca_string){
+            .data = (char*)mapped_contents.data,
+            .count = mapped_contents.count,
+            .capacity = mapped_contents.count + 1,
+        };
+        *out_is_mapped = true;
+        return 0;
+    }
+
     *out_contents = lca_file_read(allocator, file_path_cstr);
+    *out_is_mapped = false;
     return 0;
 }
 
+// returns the key a source is registered under, which is the same for every spelling of a path to the same file.
+static lca_string_view lyir_context_source_path_key(lyir_context* context, lca_string_view file_path) {
+    lca_string canonical_path = lca_string_view_path_canonicalize(context->allocator, file_path);
+    lca_string_view key = lyir_context_intern_string_view(context, lca_string_as_view(canonical_path));
+    lca_string_destroy(&canonical_path);
+    return key;
+}
+
 lyir_sourceid lyir_context_get_or_add_source_from_file(lyir_context* context, lca_string_view file_path) {
     assert(context != NULL);
 
-    lyir_sourceid sourceid = 0;
-    for (; sourceid < lca_da_count(context->sources); sourceid++) {
-        if (lca_string_view_equals(lca_string_as_view(context->sources[sourceid].name), file_path))
-            return sourceid;
+    __typeof__(context->_sources_by_path) existing_source = lca_hashmap_find(context->_sources_by_path, lyir_context_source_path_key(context, file_path));
+    if (existing_source != NULL) {
+        return existing_source->value;
     }
 
     lca_string file_path_owned = lca_string_view_to_string(context->allocator, file_path);
     lca_string text = {0};
+    bool is_text_mapped = false;
     
-    int error_code = read_file_to_string(context->allocator, file_path_owned, &text);
+    int error_code = read_file_to_string(context->allocator, file_path_owned, &text, &is_text_mapped);
     if (error_code != 0) {
         //const char* error_string = strerror(error_code);
         //fprintf(stderr, "Error when opening source file \"%.*s\": %s\n", LCA_STR_EXPAND(file_path), error_string);
@@ -203,7 +241,9 @@ lyir_sourceid lyir_context_get_or_add_source_from_file(lyir_context* context, lc
         return -1;
     }
 
-    return lyir_context_get_or_add_source_from_string(context, file_path_owned, text);
+    lyir_sourceid sourceid = lyir_context_get_or_add_source_from_string(context, file_path_owned, text);
+    context->sources[sourceid].is_text_mapped = is_text_mapped;
+    return sourceid;
 }
 
 lyir_sourceid lyir_context_get_or_add_source_from_string(lyir_context* context, lca_string name, lca_string source_text) {
@@ -216,6 +256,13 @@ lyir_sourceid lyir_context_get_or_add_source_from_string(lyir_context* context,
     };
 
     lca_da_push(context->sources, source);
+
+    // the first source registered for a path is the one every later lookup finds.
+    lca_string_view path_key = lyir_context_source_path_key(context, lca_string_as_view(name));
+    if (!lca_hashmap_contains(context->_sources_by_path, path_key)) {
+        lca_hashmap_set(context->_sources_by_path, path_key, sourceid);
+    }
+
     return sourceid;
 }
 
@@ -225,6 +272,18 @@ lyir_source lyir_context_get_source(lyir_context* context, lyir_sourceid sourcei
     return context->sources[sourceid];
 }
 
+static void lyir_context_build_line_start_offsets(lyir_source* source) {
+    assert(source != NULL);
+    assert(source->line_start_offsets == NULL);
+
+    lca_da_push(source->line_start_offsets, 0);
+    for (int64_t i = 0; i < source->text.count; i++) {
+        if (source->text.data[i] == '\n') {
+            lca_da_push(source->line_start_offsets, i + 1);
+        }
+    }
+}
+
 bool lyir_context_get_location_info(lyir_context* context, lyir_location location, lca_string_view* out_name, int64_t* out_line, int64_t* out_column) {
     assert(context != NULL);
 
@@ -236,21 +295,27 @@ bool lyir_context_get_location_info(lyir_context* context, lyir_location locatio
     if (location.offset >= source.text.count) return false;
     if (location.offset + location.length > source.text.count) return false;
 
-    int64_t last_line_start_offset = 0;
-    int64_t line_number = 1;
+    if (source.line_start_offsets == NULL) {
+        lyir_context_build_line_start_offsets(&context->sources[location.sourceid]);
+        source = context->sources[location.sourceid];
+    }
 
-    char lastc = 0;
-    for (int64_t i = 0; i <= location.offset; i++) {
-        if (lastc == '\n') {
-            last_line_start_offset = i;
-            line_number++;
-        }
+    // find the last line which starts at or before the location.
+    int64_t low = 0;
+    int64_t high = lca_da_count(source.line_start_offsets) - 1;
+    assert(high >= 0);
 
-        lastc = source.text.data[i];
+    while (low < high) {
+        int64_t middle = low + (high - low + 1) / 2;
+        if (source.line_start_offsets[middle] <= location.offset) {
+            low = middle;
+        } else {
+            high = middle - 1;
+        }
     }
 
-    if (out_line != NULL) *out_line = line_number;
-    if (out_column != NULL) *out_column = 1 + (location.offset - last_line_start_offset);
+    if (out_line != NULL) *out_line = 1 + low;
+    if (out_column != NULL) *out_column = 1 + (location.offset - source.line_start_offsets[low]);
 
     return true;
 }
@@ -383,19 +448,49 @@ void lyir_write_ice(lyir_context* context, lyir_location location, const char* f
 
 #undef GET_MESSAGE
 
-lca_string_view lyir_context_intern_string_view(lyir_context* context, lca_string_view s) {
+lyir_symbolid lyir_context_intern_symbol(lyir_context* context, lca_string_view s) {
+    assert(context != NULL);
+    assert(s.count == 0 || s.data != NULL);
+
+    __typeof__(context->_interned_string_index) existing = lca_hashmap_find(context->_interned_string_index, s);
+    if (existing != NULL) {
+        context->interned_string_bytes_saved += s.count + 1;
+        return existing->value;
+    }
+
+    lca_string_view interned;
     if (s.count + 1 > context->max_interned_string_size) {
         lca_string allocated_string = lca_string_view_to_string(context->allocator, s);
         lca_da_push(context->allocated_strings, allocated_string);
-        return lca_string_as_view(allocated_string);
+        interned = lca_string_as_view(allocated_string);
+    } else {
+        char* arena_string_data = lca_arena_push_aligned_uninit(context->string_arena, (size_t)s.count + 1, 1);
+        memcpy(arena_string_data, s.data, (size_t)s.count);
+        arena_string_data[s.count] = 0;
+        interned = (lca_string_view){
+            .data = arena_string_data,
+            .count = s.count,
+        };
     }
 
-    // TODO(local): these aren't properly interned yet, do that eventually.
+    context->interned_string_bytes_stored += s.count + 1;
 
-    char* arena_string_data = lca_arena_push(context->string_arena, s.count + 1);
-    memcpy(arena_string_data, s.data, (size_t)s.count);
-    
-    lca_string arena_string = lca_string_from_data(context->allocator, arena_string_data, s.count, s.count + 1);
+    int64_t id = lca_da_count(context->_interned_strings);
+    assert(id < INT32_MAX);
+    lca_da_push(context->_interned_strings, interned);
+
+    // the index refers to the interned copy, which lives as long as the context does.
+    lca_hashmap_set(context->_interned_string_index, interned, (lyir_symbolid)id);
+
+    return (lyir_symbolid)id;
+}
 
-    return lca_string_as_view(arena_string);
+lca_string_view lyir_context_symbol_name_get(lyir_context* context, lyir_symbolid symbol) {
+    assert(context != NULL);
+    assert(symbol >= 0 && symbol < lca_da_count(context->_interned_strings));
+    return context->_interned_strings[symbol];
+}
+
+lca_string_view lyir_context_intern_string_view(lyir_context* context, lca_string_view s) {
+    return lyir_context_symbol_name_get(context, lyir_context_intern_symbol(context, s));
 }
@@ -50,6 +50,8 @@ lyir_dependency_graph* lyir_dependency_graph_create_in_context(lyir_context* con
     graph->context = context;
     graph->arena = lca_arena_create(context->allocator, 1024 * sizeof(lyir_dependency_entry));
     assert(graph->arena != NULL);
+    lca_hashmap_init(graph->entry_indices, context->allocator, 64);
+    lca_hashmap_init(graph->edges, context->allocator, 64);
     lca_da_push(context->_all_depgraphs, graph);
 
     return graph;
@@ -68,42 +70,68 @@ void lyir_dependency_graph_destroy(lyir_dependency_graph* graph) {
     }
 
     lca_da_free(graph->entries);
+    lca_hashmap_free(graph->entry_indices);
+    lca_hashmap_free(graph->edges);
     lca_arena_destroy(graph->arena);
 
     *graph = (lyir_dependency_graph){0};
     lca_deallocate(allocator, graph);
 }
 
+static int64_t lyir_depgraph_entry_index(lyir_dependency_graph* graph, lyir_dependency_entity* node) {
+    assert(graph != NULL);
+    assert(graph->arena != NULL);
+    assert(node != NULL);
+
+    int64_t new_index = lca_da_count(graph->entries);
+    __typeof__(graph->entry_indices) index_entry = lca_hashmap_insert(graph->entry_indices, node);
+    assert(index_entry != NULL);
+
+    // a freshly inserted entry has a zeroed value, which is ambiguous with index 0, so the
+    // stored value is the index plus one.
+    if (index_entry->value != 0) {
+        return index_entry->value - 1;
+    }
+
+    index_entry->value = new_index + 1;
+
+    lyir_dependency_entry* entry = lca_arena_push(graph->arena, sizeof *entry);
+    entry->node = node;
+    lca_da_push(graph->entries, entry);
+
+    return new_index;
+}
+
 void lyir_depgraph_add_dependency(lyir_dependency_graph* graph, lyir_dependency_entity* node, lyir_dependency_entity* dependency) {
     assert(graph != NULL);
     assert(graph->arena != NULL);
     assert(node != NULL);
 
-    lyir_dependency_entry* entry = NULL;
-    for (int64_t i = 0, count = lca_da_count(graph->entries); i < count; i++) {
-        if (graph->entries[i]->node == node) {
-            entry = graph->entries[i];
-            break;
-        }
+    int64_t entry_index = lyir_depgraph_entry_index(graph, node);
+    if (dependency == NULL) {
+        return;
     }
 
-    if (entry == NULL) {
-        entry = lca_arena_push(graph->arena, sizeof *entry);
-        entry->node = node;
-        lca_da_push(graph->entries, entry);
+    lyir_dependency_edge edge = {
+        .node = node,
+        .dependency = dependency,
+    };
+
+    if (lca_hashmap_contains(graph->edges, edge)) {
+        return;
     }
 
-    assert(entry != NULL);
-    assert(entry->node == node);
+    lca_hashmap_set(graph->edges, edge, true);
 
-    if (dependency != NULL) {
-        for (int64_t i = 0, count = lca_da_count(entry->dependencies); i < count; i++) {
-            if (entry->dependencies[i] == dependency) {
-                return;
-            }
-        }
+    // the dependency gets an entry of its own, so the ordering pass never has to deal with entities it doesn't know.
+    lyir_depgraph_entry_index(graph, dependency);
+
+    lyir_dependency_entry* entry = graph->entries[entry_index];
+    assert(entry->node == node);
+    lca_da_push(entry->dependencies, dependency);
 
-        lca_da_push(entry->dependencies, dependency);
+    if (dependency == node) {
+        entry->depends_on_itself = true;
     }
 }
 
@@ -114,120 +142,180 @@ void lyir_depgraph_ensure_tracked(lyir_dependency_graph* graph, lyir_dependency_
     lyir_depgraph_add_dependency(graph, node, NULL);
 }
 
-static int64_t dynarr_index_of(lca_da(void*) entities, void* entity) {
-    for (int64_t i = 0, count = lca_da_count(entities); i < count; i++) {
-        if (entity == entities[i])
-            return i;
+// the state of one entity in an iterative Tarjan strongly connected components pass.
+typedef struct lyir_depgraph_visit {
+    // the order in which the entity was first reached, or -1 if it hasn't been yet.
+    int64_t index;
+    // the smallest index reachable from this entity's subtree while staying on the stack.
+    int64_t lowlink;
+    // how many of the entity's dependencies have already been walked.
+    int64_t next_dependency;
+    // where the entity sits on the walk stack while it is being walked, or -1.
+    int64_t walk_position;
+    bool is_on_stack;
+} lyir_depgraph_visit;
+
+// records the cycle closed by the back edge from `walk_stack[walk_stack_count - 1]` to `dependency_index`,
+// which is the edge the old recursive walk stopped at. `from` depends on `to`, and the path from `to`
+// up the walk stack leads back to `from`.
+static void lyir_depgraph_record_cycle(
+    lyir_dependency_graph* graph,
+    lyir_dependency_order_result* result,
+    lyir_depgraph_visit* visits,
+    int64_t* walk_stack,
+    int64_t walk_stack_count,
+    int64_t dependency_index
+) {
+    assert(graph != NULL);
+    assert(result != NULL);
+    assert(walk_stack_count > 0);
+
+    int64_t from_index = walk_stack[walk_stack_count - 1];
+    int64_t to_position = visits[dependency_index].walk_position;
+    assert(to_position >= 0 && to_position < walk_stack_count);
+
+    lca_da_push(result->cycle, graph->entries[from_index]->node);
+    for (int64_t i = to_position; i < walk_stack_count - 1; i++) {
+        lca_da_push(result->cycle, graph->entries[walk_stack[i]]->node);
     }
 
-    return -1;
+    result->from = graph->entries[from_index]->node;
+    result->to = graph->entries[dependency_index]->node;
 }
 
-static lyir_dependency_order_result resolve_dependencies(
-    lyir_dependency_graph* graph,
-    // clang-format off
-    lca_da(lyir_dependency_entity*)* resolved,
-    lca_da(lyir_dependency_entity*)* seen,
-    // clang-format on
-    lyir_dependency_entity* entity
-) {
-#define RESOLVED (*resolved)
-#define SEEN     (*seen)
-
+lyir_dependency_order_result lyir_dependency_graph_get_ordered_entities(lyir_dependency_graph* graph) {
     assert(graph != NULL);
-    assert(resolved != NULL);
-    assert(seen != NULL);
 
     lyir_dependency_order_result result = {0};
-    if (-1 != dynarr_index_of(RESOLVED, entity)) {
+
+    int64_t entry_count = lca_da_count(graph->entries);
+    if (entry_count == 0) {
+        result.status = LYIR_DEP_OK;
         return result;
     }
 
-    lca_da_push(SEEN, entity);
-
-    int64_t entry_index = -1; // dynarr_index_of((void**)graph->entries, entity);
-    for (int64_t i = 0; i < lca_da_count(graph->entries) && entry_index == -1; i++) {
-        if (graph->entries[i]->node == entity) {
-            entry_index = i;
-        }
-    }
+    lca_arena_mark temp_mark = lca_temp_mark();
 
-    bool requires_resolution = entry_index >= 0 && lca_da_count(graph->entries[entry_index]->dependencies) >= 0;
+    lyir_depgraph_visit* visits = lca_allocate(temp_allocator, (size_t)entry_count * sizeof *visits);
+    // the entities which have been reached but not yet assigned to a component.
+    int64_t* tarjan_stack = lca_allocate(temp_allocator, (size_t)entry_count * sizeof *tarjan_stack);
+    // the entities currently being walked, which replaces the recursion of the textbook algorithm.
+    int64_t* walk_stack = lca_allocate(temp_allocator, (size_t)entry_count * sizeof *walk_stack);
+    int64_t tarjan_stack_count = 0;
+    int64_t walk_stack_count = 0;
 
-    if (requires_resolution) {
-#define DEPS (*dependencies)
-        lca_da(lyir_dependency_entity*)* dependencies = &graph->entries[entry_index]->dependencies;
+    for (int64_t i = 0; i < entry_count; i++) {
+        visits[i] = (lyir_depgraph_visit){.index = -1, .walk_position = -1};
+    }
 
-        for (int64_t i = 0, count = lca_da_count(DEPS); i < count; i++) {
-            lyir_dependency_entity* dep = DEPS[i];
-            assert(dep != NULL);
+    lca_da_reserve_exact(result.ordered_entities, entry_count);
+
+    int64_t next_visit_index = 0;
+    bool found_cycle = false;
+
+    // roots are taken in the order entities were added, and dependencies in the order they were recorded,
+    // so an acyclic graph is ordered exactly the way a recursive depth-first walk would order it.
+    for (int64_t root = 0; root < entry_count; root++) {
+        if (visits[root].index >= 0) continue;
+
+        visits[root].index = visits[root].lowlink = next_visit_index++;
+        visits[root].is_on_stack = true;
+        visits[root].walk_position = walk_stack_count;
+        tarjan_stack[tarjan_stack_count++] = root;
+        walk_stack[walk_stack_count++] = root;
+
+        while (walk_stack_count > 0) {
+            int64_t current = walk_stack[walk_stack_count - 1];
+            lyir_depgraph_visit* current_visit = &visits[current];
+            lyir_dependency_entry* entry = graph->entries[current];
+
+            if (current_visit->next_dependency < lca_da_count(entry->dependencies)) {
+                lyir_dependency_entity* dependency = entry->dependencies[current_visit->next_dependency++];
+                int64_t dependency_index = lca_hashmap_find(graph->entry_indices, dependency)->value - 1;
+                assert(dependency_index >= 0 && dependency_index < entry_count);
+
+                lyir_depgraph_visit* dependency_visit = &visits[dependency_index];
+                if (dependency_visit->index < 0) {
+                    dependency_visit->index = dependency_visit->lowlink = next_visit_index++;
+                    dependency_visit->is_on_stack = true;
+                    dependency_visit->walk_position = walk_stack_count;
+                    tarjan_stack[tarjan_stack_count++] = dependency_index;
+                    walk_stack[walk_stack_count++] = dependency_index;
+                    continue;
+                }
+
+                // an edge back onto the walk stack closes a cycle. the first one found is reported.
+                if (!found_cycle && dependency_visit->walk_position >= 0) {
+                    found_cycle = true;
+                    lyir_depgraph_record_cycle(graph, &result, visits, walk_stack, walk_stack_count, dependency_index);
+                }
+
+                if (dependency_visit->is_on_stack && dependency_visit->index < current_visit->lowlink) {
+                    current_visit->lowlink = dependency_visit->index;
+                }
 
-            if (-1 != dynarr_index_of((void**)RESOLVED, dep)) {
                 continue;
             }
 
-            int64_t dep_seen_index = dynarr_index_of((void**)SEEN, dep);
-            if (-1 != dep_seen_index) {
-                result.status = LYIR_DEP_CYCLE;
-                result.from = entity;
-                result.to = dep;
-                return result;
+            walk_stack_count--;
+            current_visit->walk_position = -1;
+            if (walk_stack_count > 0) {
+                lyir_depgraph_visit* parent_visit = &visits[walk_stack[walk_stack_count - 1]];
+                if (current_visit->lowlink < parent_visit->lowlink) {
+                    parent_visit->lowlink = current_visit->lowlink;
+                }
             }
 
-            lyir_dependency_order_result dep_result = resolve_dependencies(
-                graph,
-                resolved,
-                seen,
-                dep
-            );
-
-            if (dep_result.status != LYIR_DEP_OK) {
-                return dep_result;
+            if (current_visit->lowlink != current_visit->index) {
+                continue;
             }
+
+            // `current` is the root of a component; everything above it on the stack belongs to it.
+            lca_da_push(result.component_starts, lca_da_count(result.ordered_entities));
+
+            int64_t member = -1;
+            do {
+                assert(tarjan_stack_count > 0);
+                member = tarjan_stack[--tarjan_stack_count];
+                visits[member].is_on_stack = false;
+                lca_da_push(result.ordered_entities, graph->entries[member]->node);
+            } while (member != current);
         }
-#undef DEPS
     }
 
-    lca_da_push(RESOLVED, entity);
-
-    int64_t seen_index = dynarr_index_of((void**)SEEN, entity);
-    assert(seen_index >= 0);
-    assert(seen_index < lca_da_count(SEEN));
-    if (lca_da_count(SEEN) == 1) {
-        lca_da_pop(SEEN);
-    } else {
-        SEEN[seen_index] = SEEN[lca_da_count(SEEN) - 1];
-        SEEN[lca_da_count(SEEN) - 1] = NULL;
-        lca_da_count_set(SEEN, lca_da_count(SEEN) - 1);
-    }
+    assert(tarjan_stack_count == 0);
+    assert(lca_da_count(result.ordered_entities) == entry_count);
+
+    result.status = found_cycle ? LYIR_DEP_CYCLE : LYIR_DEP_OK;
 
+    lca_temp_restore(temp_mark);
     return result;
+}
 
-#undef SEEN
-#undef RESOLVED
+void lyir_dependency_order_result_destroy(lyir_dependency_order_result* result) {
+    if (result == NULL) return;
+    lca_da_free(result->ordered_entities);
+    lca_da_free(result->component_starts);
+    lca_da_free(result->cycle);
+    *result = (lyir_dependency_order_result){0};
 }
 
-lyir_dependency_order_result lyir_dependency_graph_get_ordered_entities(lyir_dependency_graph* graph) {
-    assert(graph != NULL);
+int64_t lyir_dependency_order_result_component_count(lyir_dependency_order_result* result) {
+    assert(result != NULL);
+    return lca_da_count(result->component_starts);
+}
 
-    lyir_dependency_order_result result = {0};
-    lca_da(lyir_dependency_entity*) seen = NULL;
+lyir_dependency_entity** lyir_dependency_order_result_component_get(lyir_dependency_order_result* result, int64_t component_index, int64_t* out_count) {
+    assert(result != NULL);
+    assert(out_count != NULL);
 
-    for (int64_t i = 0, count = lca_da_count(graph->entries); i < count; i++) {
-        lyir_dependency_order_result entry_result = resolve_dependencies(
-            graph,
-            &result.ordered_entities,
-            &seen,
-            graph->entries[i]->node
-        );
-
-        if (entry_result.status != LYIR_DEP_OK) {
-            lca_da_free(seen);
-            return entry_result;
-        }
-    }
+    int64_t component_count = lca_da_count(result->component_starts);
+    assert(component_index >= 0 && component_index < component_count);
 
-    lca_da_free(seen);
-    result.status = LYIR_DEP_OK;
-    return result;
+    int64_t start = result->component_starts[component_index];
+    int64_t end = component_index + 1 < component_count ? result->component_starts[component_index + 1] : lca_da_count(result->ordered_entities);
+    assert(start < end);
+
+    *out_count = end - start;
+    return &result->ordered_entities[start];
 }
@@ -91,6 +91,21 @@ typedef struct layec_incoming_value {
     lyir_value* block;
 } layec_incoming_value;
 
+// most calls and builtins take only a few arguments and most phis merge two values,
+// so these keep their operands inline in the value and only allocate when they outgrow them.
+typedef lca_small_da(lyir_value*, 3) layec_argument_list;
+typedef lca_small_da(layec_incoming_value, 2) layec_incoming_value_list;
+
+// one record for every operand slot of every user. records are linked into an intrusive
+// list on the value they refer to, so adding and removing a use takes constant time.
+struct lyir_use {
+    lyir_value* value;
+    lyir_value* user;
+    int64_t operand_index;
+    lyir_use* prev;
+    lyir_use* next;
+};
+
 struct lyir_value {
     lyir_value_kind kind;
     lyir_location location;
@@ -103,10 +118,17 @@ struct lyir_value {
     int64_t index;
     lyir_linkage linkage;
 
-    // for values which want their uses tracked, a list of all users of this value.
-    lca_da(lyir_value*) users;
+    // for values which want their uses tracked, a list of all uses of this value.
+    lyir_use* first_use;
+    int64_t use_count;
+    // the use records for this value's own operands, indexed by operand slot.
+    lyir_use* operand_uses;
+    int64_t operand_use_capacity;
 
     lyir_value* parent_block;
+    // instructions are kept in an intrusive doubly-linked list owned by their parent block.
+    lyir_value* prev_instruction;
+    lyir_value* next_instruction;
 
     lyir_value* address;
     lyir_value* operand;
@@ -117,7 +139,7 @@ struct lyir_value {
 
         struct {
             lyir_builtin_kind kind;
-            lca_da(lyir_value*) arguments;
+            layec_argument_list arguments;
         } builtin;
 
         struct {
@@ -130,13 +152,22 @@ struct lyir_value {
             lca_string_view name;
             int64_t index;
             lyir_value* parent_function;
-            lca_da(lyir_value*) instructions;
+            lyir_value* first_instruction;
+            lyir_value* last_instruction;
+            int64_t instruction_count;
+            // the most recent instruction looked up by index, so walking the block by index
+            // in either direction doesn't have to start over from one of its ends every time.
+            lyir_value* cached_instruction;
+            int64_t cached_instruction_index;
         } block;
 
         struct {
             lca_string_view name;
             lca_da(lyir_value*) parameters;
             lca_da(lyir_value*) blocks;
+            // set when instructions are inserted or retyped; the instruction indices are
+            // recalculated lazily the next time one of them is requested.
+            bool instruction_indices_dirty;
         } function;
 
         int64_t parameter_index;
@@ -158,7 +189,7 @@ struct lyir_value {
             lyir_value* fail;
         } branch;
 
-        lca_da(layec_incoming_value) incoming_values;
+        layec_incoming_value_list incoming_values;
 
         struct {
             lyir_value* callee;
@@ -166,7 +197,7 @@ struct lyir_value {
             // and we may be calling through a function pointer, for example
             lyir_type* callee_type;
             lyir_calling_convention calling_convention;
-            lca_da(lyir_value*) arguments;
+            layec_argument_list arguments;
             bool is_tail_call : 1;
         } call;
     };
@@ -177,47 +208,307 @@ struct lyir_builder {
 
     lyir_value* function;
     lyir_value* block;
-    int64_t insert_index;
+    // new instructions are inserted before this one, or at the end of the block if it's NULL.
+    lyir_value* insert_before;
 };
 
-static void layec_value_add_user(lyir_value* value, lyir_value* user) {
+// only values owned by a module track their uses; constants live in the context and are shared between modules.
+static bool layec_value_tracks_uses(lyir_value* value) {
     assert(value != NULL);
+    return value->module != NULL;
+}
+
+static lyir_value** layec_value_operand_slot(lyir_value* user, int64_t operand_index) {
     assert(user != NULL);
+    assert(operand_index >= 0);
+
+    switch (user->kind) {
+        default: {
+            fprintf(stderr, "for value kind %s\n", lyir_value_kind_to_cstring(user->kind));
+            assert(false && "this value has no operands");
+            return NULL;
+        }
 
-    for (int64_t i = 0, count = lca_da_count(value->users); i < count; i++) {
-        if (value->users[i] == user) {
-            return;
+        case LYIR_IR_GLOBAL_VARIABLE: {
+            assert(operand_index == 0);
+            return &user->operand;
+        }
+
+        case LYIR_IR_CALL: {
+            if (operand_index == 0) return &user->call.callee;
+            assert(operand_index - 1 < lca_small_da_count(user->call.arguments));
+            return &lca_small_da_data(user->call.arguments)[operand_index - 1];
+        }
+
+        case LYIR_IR_BUILTIN: {
+            assert(operand_index < lca_small_da_count(user->builtin.arguments));
+            return &lca_small_da_data(user->builtin.arguments)[operand_index];
+        }
+
+        case LYIR_IR_PHI: {
+            assert(operand_index / 2 < lca_small_da_count(user->incoming_values));
+            layec_incoming_value* incoming_value = &lca_small_da_data(user->incoming_values)[operand_index / 2];
+            return operand_index % 2 == 0 ? &incoming_value->value : &incoming_value->block;
+        }
+
+        case LYIR_IR_LOAD: {
+            assert(operand_index == 0);
+            return &user->address;
+        }
+
+        case LYIR_IR_STORE:
+        case LYIR_IR_PTRADD: {
+            assert(operand_index < 2);
+            return operand_index == 0 ? &user->address : &user->operand;
+        }
+
+        case LYIR_IR_BRANCH: {
+            assert(operand_index == 0);
+            return &user->branch.pass;
+        }
+
+        case LYIR_IR_COND_BRANCH: {
+            assert(operand_index < 3);
+            if (operand_index == 0) return &user->operand;
+            return operand_index == 1 ? &user->branch.pass : &user->branch.fail;
+        }
+
+        case LYIR_IR_RETURN: {
+            assert(operand_index == 0);
+            return &user->return_value;
+        }
+
+        case LYIR_IR_ZEXT:
+        case LYIR_IR_SEXT:
+        case LYIR_IR_TRUNC:
+        case LYIR_IR_BITCAST:
+        case LYIR_IR_NEG:
+        case LYIR_IR_COPY:
+        case LYIR_IR_COMPL:
+        case LYIR_IR_FPTOUI:
+        case LYIR_IR_FPTOSI:
+        case LYIR_IR_UITOFP:
+        case LYIR_IR_SITOFP:
+        case LYIR_IR_FPTRUNC:
+        case LYIR_IR_FPEXT: {
+            assert(operand_index == 0);
+            return &user->operand;
         }
-    }
 
-    lca_da_push(value->users, user);
+        case LYIR_IR_ADD:
+        case LYIR_IR_FADD:
+        case LYIR_IR_SUB:
+        case LYIR_IR_FSUB:
+        case LYIR_IR_MUL:
+        case LYIR_IR_FMUL:
+        case LYIR_IR_SDIV:
+        case LYIR_IR_UDIV:
+        case LYIR_IR_FDIV:
+        case LYIR_IR_SMOD:
+        case LYIR_IR_UMOD:
+        case LYIR_IR_FMOD:
+        case LYIR_IR_SHL:
+        case LYIR_IR_SAR:
+        case LYIR_IR_SHR:
+        case LYIR_IR_AND:
+        case LYIR_IR_OR:
+        case LYIR_IR_XOR:
+        case LYIR_IR_ICMP_EQ:
+        case LYIR_IR_ICMP_NE:
+        case LYIR_IR_ICMP_SLT:
+        case LYIR_IR_ICMP_SLE:
+        case LYIR_IR_ICMP_SGT:
+        case LYIR_IR_ICMP_SGE:
+        case LYIR_IR_ICMP_ULT:
+        case LYIR_IR_ICMP_ULE:
+        case LYIR_IR_ICMP_UGT:
+        case LYIR_IR_ICMP_UGE:
+        case LYIR_IR_FCMP_FALSE:
+        case LYIR_IR_FCMP_OEQ:
+        case LYIR_IR_FCMP_OGT:
+        case LYIR_IR_FCMP_OGE:
+        case LYIR_IR_FCMP_OLT:
+        case LYIR_IR_FCMP_OLE:
+        case LYIR_IR_FCMP_ONE:
+        case LYIR_IR_FCMP_ORD:
+        case LYIR_IR_FCMP_UEQ:
+        case LYIR_IR_FCMP_UGT:
+        case LYIR_IR_FCMP_UGE:
+        case LYIR_IR_FCMP_ULT:
+        case LYIR_IR_FCMP_ULE:
+        case LYIR_IR_FCMP_UNE:
+        case LYIR_IR_FCMP_UNO:
+        case LYIR_IR_FCMP_TRUE: {
+            assert(operand_index < 2);
+            return operand_index == 0 ? &user->binary.lhs : &user->binary.rhs;
+        }
+    }
 }
 
-static void layec_value_remove_user(lyir_value* value, lyir_value* user) {
+static void layec_use_link(lyir_use* use, lyir_value* value) {
+    assert(use != NULL);
+    assert(use->value == NULL);
     assert(value != NULL);
+
+    use->value = value;
+    if (!layec_value_tracks_uses(value)) {
+        return;
+    }
+
+    use->prev = NULL;
+    use->next = value->first_use;
+    if (value->first_use != NULL) {
+        value->first_use->prev = use;
+    }
+
+    value->first_use = use;
+    value->use_count++;
+}
+
+static void layec_use_unlink(lyir_use* use) {
+    assert(use != NULL);
+
+    lyir_value* value = use->value;
+    if (value == NULL) {
+        return;
+    }
+
+    use->value = NULL;
+    if (!layec_value_tracks_uses(value)) {
+        return;
+    }
+
+    if (use->prev == NULL) {
+        value->first_use = use->next;
+    } else {
+        use->prev->next = use->next;
+    }
+
+    if (use->next != NULL) {
+        use->next->prev = use->prev;
+    }
+
+    use->prev = NULL;
+    use->next = NULL;
+
+    assert(value->use_count > 0);
+    value->use_count--;
+}
+
+static lyir_use* layec_value_operand_use(lyir_value* user, int64_t operand_index) {
     assert(user != NULL);
+    assert(user->module != NULL);
+    assert(operand_index >= 0);
+
+    if (operand_index >= user->operand_use_capacity) {
+        int64_t new_capacity = user->operand_use_capacity == 0 ? 2 : user->operand_use_capacity * 2;
+        while (new_capacity <= operand_index) new_capacity *= 2;
+
+        lyir_use* new_operand_uses = lca_arena_push_uninit(user->module->arena, new_capacity * (int64_t)sizeof *new_operand_uses);
+        assert(new_operand_uses != NULL);
+
+        // only the records past the old ones need clearing, the rest are copied over below.
+        memset(&new_operand_uses[user->operand_use_capacity], 0, (size_t)(new_capacity - user->operand_use_capacity) * sizeof *new_operand_uses);
+
+        // the old records are left in the arena, but whatever links to them has to follow them to their new home.
+        for (int64_t i = 0; i < user->operand_use_capacity; i++) {
+            lyir_use* use = &new_operand_uses[i];
+            *use = user->operand_uses[i];
 
-    for (int64_t i = 0, count = lca_da_count(value->users); i < count; i++) {
-        if (value->users[i] == user) {
-            if (i != count - 1) {
-                value->users[i] = value->users[count - 1];
+            if (use->value == NULL || !layec_value_tracks_uses(use->value)) {
+                continue;
+            }
+
+            if (use->prev == NULL) {
+                use->value->first_use = use;
+            } else {
+                use->prev->next = use;
             }
 
-            lca_da_pop(value->users);
-            return;
+            if (use->next != NULL) {
+                use->next->prev = use;
+            }
         }
+
+        user->operand_uses = new_operand_uses;
+        user->operand_use_capacity = new_capacity;
     }
+
+    return &user->operand_uses[operand_index];
+}
+
+static void layec_value_operand_set(lyir_value* user, int64_t operand_index, lyir_value* value) {
+    assert(user != NULL);
+    assert(value != NULL);
+
+    lyir_use* use = layec_value_operand_use(user, operand_index);
+    assert(use != NULL);
+
+    layec_use_unlink(use);
+    use->user = user;
+    use->operand_index = operand_index;
+
+    *layec_value_operand_slot(user, operand_index) = value;
+    layec_use_link(use, value);
 }
 
 int64_t lyir_value_user_count_get(lyir_value* value) {
     assert(value != NULL);
-    return lca_da_count(value->users);
+    return value->use_count;
 }
 
 lyir_value* lyir_value_user_get_at_index(lyir_value* value, int64_t user_index) {
     assert(value != NULL);
-    assert(user_index >= 0 && user_index < lca_da_count(value->users));
-    return value->users[user_index];
+    assert(user_index >= 0 && user_index < value->use_count);
+
+    lyir_use* use = value->first_use;
+    for (int64_t i = 0; i < user_index; i++) {
+        assert(use != NULL);
+        use = use->next;
+    }
+
+    assert(use != NULL);
+    return use->user;
+}
+
+lyir_use* lyir_value_first_use_get(lyir_value* value) {
+    assert(value != NULL);
+    return value->first_use;
+}
+
+lyir_use* lyir_use_next_get(lyir_use* use) {
+    assert(use != NULL);
+    return use->next;
+}
+
+lyir_value* lyir_use_value_get(lyir_use* use) {
+    assert(use != NULL);
+    return use->value;
+}
+
+lyir_value* lyir_use_user_get(lyir_use* use) {
+    assert(use != NULL);
+    return use->user;
+}
+
+int64_t lyir_use_operand_index_get(lyir_use* use) {
+    assert(use != NULL);
+    return use->operand_index;
+}
+
+void lyir_value_replace_all_uses_with(lyir_value* value, lyir_value* replacement) {
+    assert(value != NULL);
+    assert(replacement != NULL);
+    assert(value != replacement);
+    assert(layec_value_tracks_uses(value));
+
+    // setting the operand unlinks the use from `value`, so this always makes progress.
+    while (value->first_use != NULL) {
+        lyir_use* use = value->first_use;
+        layec_value_operand_set(use->user, use->operand_index, replacement);
+    }
+
+    assert(value->use_count == 0);
 }
 
 int64_t lyir_context_get_struct_type_count(lyir_context* context) {
@@ -274,20 +565,16 @@ void layec_value_destroy(lyir_value* value) {
             lca_da_free(value->function.blocks);
         } break;
 
-        case LYIR_IR_BLOCK: {
-            lca_da_free(value->block.instructions);
-        } break;
-
         case LYIR_IR_CALL: {
-            lca_da_free(value->call.arguments);
+            lca_small_da_free(value->call.arguments);
         } break;
 
         case LYIR_IR_PHI: {
-            lca_da_free(value->incoming_values);
+            lca_small_da_free(value->incoming_values);
         } break;
 
         case LYIR_IR_BUILTIN: {
-            lca_da_free(value->builtin.arguments);
+            lca_small_da_free(value->builtin.arguments);
         } break;
     }
 }
@@ -305,33 +592,195 @@ static lyir_type* layec_type_create(lyir_context* context, lyir_type_kind kind)
     return type;
 }
 
+// every type is owned by the context's `_all_types` list and destroyed exactly once from there,
+// so this does not recurse into the (shared) types it refers to.
 void layec_type_destroy(lyir_type* type) {
     if (type == NULL) return;
 
     switch (type->kind) {
         default: break;
 
+        case LYIR_TYPE_FUNCTION: {
+            lca_da_free(type->function.parameter_types);
+        } break;
+
+        case LYIR_TYPE_STRUCT: {
+            lca_da_free(type->_struct.members);
+        } break;
+    }
+}
+
+static uint64_t layec_hash_combine(uint64_t hash, uint64_t value) {
+    hash ^= value + 0x9E3779B97F4A7C15ull + (hash << 6) + (hash >> 2);
+    return hash;
+}
+
+static uint64_t layec_type_hash(lyir_type* type) {
+    assert(type != NULL);
+
+    // component types are unique already, so hashing their addresses is enough.
+    uint64_t hash = layec_hash_combine(0, (uint64_t)type->kind);
+    switch (type->kind) {
+        default: {
+            fprintf(stderr, "for type kind %s\n", lyir_type_kind_to_cstring(type->kind));
+            assert(false && "this kind of type is not hash-consed");
+            return 0;
+        }
+
+        case LYIR_TYPE_INTEGER: {
+            hash = layec_hash_combine(hash, (uint64_t)type->primitive_bit_width);
+        } break;
+
         case LYIR_TYPE_ARRAY: {
-            layec_type_destroy(type->array.element_type);
+            hash = layec_hash_combine(hash, (uint64_t)(uintptr_t)type->array.element_type);
+            hash = layec_hash_combine(hash, (uint64_t)type->array.length);
         } break;
 
         case LYIR_TYPE_FUNCTION: {
-            layec_type_destroy(type->function.return_type);
+            hash = layec_hash_combine(hash, (uint64_t)(uintptr_t)type->function.return_type);
+            hash = layec_hash_combine(hash, (uint64_t)type->function.calling_convention);
+            hash = layec_hash_combine(hash, (uint64_t)type->function.is_variadic);
             for (int64_t i = 0, count = lca_da_count(type->function.parameter_types); i < count; i++) {
-                layec_type_destroy(type->function.parameter_types[i]);
+                hash = layec_hash_combine(hash, (uint64_t)(uintptr_t)type->function.parameter_types[i]);
             }
-
-            lca_da_free(type->function.parameter_types);
         } break;
 
         case LYIR_TYPE_STRUCT: {
+            assert(!type->_struct.named);
             for (int64_t i = 0, count = lca_da_count(type->_struct.members); i < count; i++) {
-                layec_type_destroy(type->_struct.members[i].type);
+                hash = layec_hash_combine(hash, (uint64_t)(uintptr_t)type->_struct.members[i].type);
+                hash = layec_hash_combine(hash, (uint64_t)type->_struct.members[i].is_padding);
             }
-
-            lca_da_free(type->_struct.members);
         } break;
     }
+
+    return hash;
+}
+
+static bool layec_type_structurally_equal(lyir_type* a, lyir_type* b) {
+    assert(a != NULL);
+    assert(b != NULL);
+
+    if (a->kind != b->kind) {
+        return false;
+    }
+
+    switch (a->kind) {
+        default: return false;
+
+        case LYIR_TYPE_INTEGER: {
+            return a->primitive_bit_width == b->primitive_bit_width;
+        }
+
+        case LYIR_TYPE_ARRAY: {
+            return a->array.element_type == b->array.element_type && a->array.length == b->array.length;
+        }
+
+        case LYIR_TYPE_FUNCTION: {
+            int64_t parameter_count = lca_da_count(a->function.parameter_types);
+            if (a->function.return_type != b->function.return_type ||
+                a->function.calling_convention != b->function.calling_convention ||
+                a->function.is_variadic != b->function.is_variadic ||
+                parameter_count != lca_da_count(b->function.parameter_types)) {
+                return false;
+            }
+
+            for (int64_t i = 0; i < parameter_count; i++) {
+                if (a->function.parameter_types[i] != b->function.parameter_types[i]) {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        case LYIR_TYPE_STRUCT: {
+            assert(!a->_struct.named && !b->_struct.named);
+
+            int64_t member_count = lca_da_count(a->_struct.members);
+            if (member_count != lca_da_count(b->_struct.members)) {
+                return false;
+            }
+
+            for (int64_t i = 0; i < member_count; i++) {
+                if (a->_struct.members[i].type != b->_struct.members[i].type ||
+                    a->_struct.members[i].is_padding != b->_struct.members[i].is_padding) {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+    }
+}
+
+// returns the slot where a type structurally equal to `key` lives, or the empty slot it would be inserted into.
+static lyir_type** layec_unique_type_slot(lyir_context* context, lyir_type* key, uint64_t hash) {
+    assert(context != NULL);
+    assert(context->_unique_types.capacity > 0);
+
+    int64_t mask = context->_unique_types.capacity - 1;
+    for (int64_t i = (int64_t)(hash & (uint64_t)mask);; i = (i + 1) & mask) {
+        lyir_type** slot = &context->_unique_types.entries[i];
+        if (*slot == NULL || layec_type_structurally_equal(*slot, key)) {
+            return slot;
+        }
+    }
+}
+
+static void layec_unique_types_grow(lyir_context* context) {
+    assert(context != NULL);
+
+    lyir_type** old_entries = context->_unique_types.entries;
+    int64_t old_capacity = context->_unique_types.capacity;
+
+    int64_t new_capacity = old_capacity == 0 ? 64 : old_capacity * 2;
+    context->_unique_types.entries = lca_allocate(context->allocator, new_capacity * (int64_t)sizeof(lyir_type*));
+    assert(context->_unique_types.entries != NULL);
+    context->_unique_types.capacity = new_capacity;
+
+    for (int64_t i = 0; i < old_capacity; i++) {
+        lyir_type* type = old_entries[i];
+        if (type == NULL) continue;
+
+        lyir_type** slot = layec_unique_type_slot(context, type, layec_type_hash(type));
+        assert(*slot == NULL);
+        *slot = type;
+    }
+
+    lca_deallocate(context->allocator, old_entries);
+}
+
+// looks up a type structurally equal to `key`, a stack-allocated description of the wanted type,
+// and creates a copy of it in the type arena if there isn't one yet.
+// `created` reports which happened, so callers know who owns any lists `key` pointed to.
+static lyir_type* layec_unique_type_get_or_create(lyir_context* context, lyir_type* key, bool* created) {
+    assert(context != NULL);
+    assert(key != NULL);
+
+    // keep the load factor at or below 3/4.
+    if ((context->_unique_types.count + 1) * 4 > context->_unique_types.capacity * 3) {
+        layec_unique_types_grow(context);
+    }
+
+    uint64_t hash = layec_type_hash(key);
+    lyir_type** slot = layec_unique_type_slot(context, key, hash);
+
+    if (*slot != NULL) {
+        if (created != NULL) *created = false;
+        return *slot;
+    }
+
+    lyir_type* type = layec_type_create(context, key->kind);
+    assert(type != NULL);
+    *type = *key;
+    type->context = context;
+
+    *slot = type;
+    context->_unique_types.count++;
+
+    if (created != NULL) *created = true;
+    return type;
 }
 
 const char* lyir_type_kind_to_cstring(lyir_type_kind kind) {
@@ -406,8 +855,9 @@ lyir_value* lyir_module_create_global_string_ptr(lyir_module* module, lyir_locat
 
     lyir_type* array_type = lyir_array_type(module->context, string_value.count + 1, lyir_int_type(module->context, 8));
 
-    char* data = lca_arena_push(module->arena, string_value.count + 1);
+    char* data = lca_arena_push_aligned_uninit(module->arena, (size_t)string_value.count + 1, 1);
     memcpy(data, string_value.data, string_value.count);
+    data[string_value.count] = 0;
 
     lyir_value* array_constant = lyir_array_constant_create(module->context, location, array_type, data, string_value.count + 1, true);
 
@@ -415,7 +865,7 @@ lyir_value* lyir_module_create_global_string_ptr(lyir_module* module, lyir_locat
     assert(global_string_ptr != NULL);
     global_string_ptr->index = lca_da_count(module->globals);
     global_string_ptr->linkage = LYIR_LINK_INTERNAL;
-    global_string_ptr->operand = array_constant;
+    layec_value_operand_set(global_string_ptr, 0, array_constant);
     global_string_ptr->alloca.element_type = array_type;
     global_string_ptr->alloca.element_count = 1;
     lca_da_push(module->globals, global_string_ptr);
@@ -471,33 +921,263 @@ void lyir_value_function_parameter_type_set_at_index(lyir_value* function, int64
     assert(lyir_value_is_function(function));
     assert(function->type != NULL);
     assert(lyir_type_is_function(function->type));
-    lyir_function_type_parameter_type_set_at_index(function->type, parameter_index, param_type);
+    assert(parameter_index >= 0);
+    assert(parameter_index < lca_da_count(function->function.parameters));
+    assert(param_type != NULL);
+
+    // types are unique and shared, so the function moves to a different type rather than changing its own.
+    lyir_type* old_type = function->type;
+    lca_da(lyir_type*) parameter_types = NULL;
+    for (int64_t i = 0, count = lca_da_count(old_type->function.parameter_types); i < count; i++) {
+        lca_da_push(parameter_types, i == parameter_index ? param_type : old_type->function.parameter_types[i]);
+    }
+
+    lyir_type* new_type = lyir_function_type(
+        function->context,
+        old_type->function.return_type,
+        parameter_types,
+        old_type->function.calling_convention,
+        old_type->function.is_variadic
+    );
+
+    function->type = new_type;
     function->function.parameters[parameter_index]->type = param_type;
+
+    // direct calls record the type they call through, keep those in sync with the callee.
+    for (lyir_use* use = function->first_use; use != NULL; use = use->next) {
+        lyir_value* user = use->user;
+        if (user->kind == LYIR_IR_CALL && use->operand_index == 0 && user->call.callee_type == old_type) {
+            user->call.callee_type = new_type;
+        }
+    }
 }
 
 int64_t lyir_value_block_instruction_count_get(lyir_value* block) {
     assert(block != NULL);
     assert(lyir_value_is_block(block));
-    return lca_da_count(block->block.instructions);
+    return block->block.instruction_count;
 }
 
 lyir_value* lyir_value_block_instruction_get_at_index(lyir_value* block, int64_t instruction_index) {
     assert(block != NULL);
     assert(lyir_value_is_block(block));
     assert(instruction_index >= 0);
-    assert(instruction_index < lca_da_count(block->block.instructions));
-    return block->block.instructions[instruction_index];
+    assert(instruction_index < block->block.instruction_count);
+
+    // start walking from whichever known position is closest: the front, the back or the cached instruction.
+    lyir_value* instruction = block->block.first_instruction;
+    int64_t current_index = 0;
+    int64_t distance = instruction_index;
+
+    if (block->block.instruction_count - 1 - instruction_index < distance) {
+        instruction = block->block.last_instruction;
+        current_index = block->block.instruction_count - 1;
+        distance = current_index - instruction_index;
+    }
+
+    if (block->block.cached_instruction != NULL) {
+        int64_t cached_distance = block->block.cached_instruction_index - instruction_index;
+        if (cached_distance < 0) cached_distance = -cached_distance;
+
+        if (cached_distance < distance) {
+            instruction = block->block.cached_instruction;
+            current_index = block->block.cached_instruction_index;
+        }
+    }
+
+    while (current_index < instruction_index) {
+        assert(instruction != NULL);
+        instruction = instruction->next_instruction;
+        current_index++;
+    }
+
+    while (current_index > instruction_index) {
+        assert(instruction != NULL);
+        instruction = instruction->prev_instruction;
+        current_index--;
+    }
+
+    assert(instruction != NULL);
+    assert(instruction->parent_block == block);
+
+    block->block.cached_instruction = instruction;
+    block->block.cached_instruction_index = instruction_index;
+
+    return instruction;
+}
+
+lyir_value* lyir_value_block_first_instruction_get(lyir_value* block) {
+    assert(block != NULL);
+    assert(lyir_value_is_block(block));
+    return block->block.first_instruction;
+}
+
+lyir_value* lyir_value_block_last_instruction_get(lyir_value* block) {
+    assert(block != NULL);
+    assert(lyir_value_is_block(block));
+    return block->block.last_instruction;
 }
 
 bool lyir_value_block_is_terminated(lyir_value* block) {
     assert(block != NULL);
     assert(lyir_value_is_block(block));
 
-    if (lca_da_count(block->block.instructions) == 0) {
+    if (block->block.last_instruction == NULL) {
         return false;
     }
 
-    return lyir_value_is_terminator(*lca_da_back(block->block.instructions));
+    return lyir_value_is_terminator(block->block.last_instruction);
+}
+
+static void layec_block_mark_instructions_changed(lyir_value* block) {
+    assert(block != NULL);
+    assert(lyir_value_is_block(block));
+
+    block->block.cached_instruction = NULL;
+
+    lyir_value* function = block->block.parent_function;
+    assert(function != NULL);
+    function->function.instruction_indices_dirty = true;
+}
+
+static void layec_block_link_instruction(lyir_value* block, lyir_value* instruction, lyir_value* insert_before) {
+    assert(block != NULL);
+    assert(lyir_value_is_block(block));
+    assert(instruction != NULL);
+    assert(instruction->parent_block == NULL);
+    assert(insert_before == NULL || insert_before->parent_block == block);
+
+    // appending never moves the cached instruction, and neither does inserting after it;
+    // only inserting right before it has a cheaply known effect on its index.
+    lyir_value* cached_instruction = block->block.cached_instruction;
+    int64_t cached_instruction_index = block->block.cached_instruction_index;
+    layec_block_mark_instructions_changed(block);
+
+    if (insert_before == NULL) {
+        block->block.cached_instruction = cached_instruction;
+    } else if (insert_before == cached_instruction) {
+        block->block.cached_instruction = cached_instruction;
+        block->block.cached_instruction_index = cached_instruction_index + 1;
+    }
+
+    instruction->parent_block = block;
+    instruction->next_instruction = insert_before;
+
+    if (insert_before == NULL) {
+        instruction->prev_instruction = block->block.last_instruction;
+        block->block.last_instruction = instruction;
+    } else {
+        instruction->prev_instruction = insert_before->prev_instruction;
+        insert_before->prev_instruction = instruction;
+    }
+
+    if (instruction->prev_instruction == NULL) {
+        block->block.first_instruction = instruction;
+    } else {
+        instruction->prev_instruction->next_instruction = instruction;
+    }
+
+    block->block.instruction_count++;
+}
+
+void lyir_value_instruction_remove_from_parent(lyir_value* instruction) {
+    assert(instruction != NULL);
+    assert(lyir_value_is_instruction(instruction));
+    lyir_value* block = instruction->parent_block;
+    assert(block != NULL);
+    assert(block->block.instruction_count > 0);
+
+    layec_block_mark_instructions_changed(block);
+
+    if (instruction->prev_instruction == NULL) {
+        block->block.first_instruction = instruction->next_instruction;
+    } else {
+        instruction->prev_instruction->next_instruction = instruction->next_instruction;
+    }
+
+    if (instruction->next_instruction == NULL) {
+        block->block.last_instruction = instruction->prev_instruction;
+    } else {
+        instruction->next_instruction->prev_instruction = instruction->prev_instruction;
+    }
+
+    block->block.instruction_count--;
+
+    instruction->parent_block = NULL;
+    instruction->prev_instruction = NULL;
+    instruction->next_instruction = NULL;
+}
+
+void lyir_value_block_splice(lyir_value* block, lyir_value* insert_before, lyir_value* first, lyir_value* last) {
+    assert(block != NULL);
+    assert(lyir_value_is_block(block));
+    assert(insert_before == NULL || insert_before->parent_block == block);
+    assert(first != NULL);
+    assert(last != NULL);
+    lyir_value* source_block = first->parent_block;
+    assert(source_block != NULL);
+    assert(last->parent_block == source_block);
+
+    if (insert_before == first || (insert_before != NULL && insert_before->prev_instruction == last)) {
+        return;
+    }
+
+    // moving within a block is pure relinking, only moving between blocks has to visit the moved instructions.
+    if (source_block != block) {
+        int64_t moved_count = 0;
+        for (lyir_value* instruction = first;; instruction = instruction->next_instruction) {
+            assert(instruction != NULL && "the last instruction to splice must come after the first");
+            instruction->parent_block = block;
+            moved_count++;
+            if (instruction == last) break;
+        }
+
+        source_block->block.instruction_count -= moved_count;
+        block->block.instruction_count += moved_count;
+        layec_block_mark_instructions_changed(source_block);
+    }
+
+    layec_block_mark_instructions_changed(block);
+
+    if (first->prev_instruction == NULL) {
+        source_block->block.first_instruction = last->next_instruction;
+    } else {
+        first->prev_instruction->next_instruction = last->next_instruction;
+    }
+
+    if (last->next_instruction == NULL) {
+        source_block->block.last_instruction = first->prev_instruction;
+    } else {
+        last->next_instruction->prev_instruction = first->prev_instruction;
+    }
+
+    last->next_instruction = insert_before;
+
+    if (insert_before == NULL) {
+        first->prev_instruction = block->block.last_instruction;
+        block->block.last_instruction = last;
+    } else {
+        first->prev_instruction = insert_before->prev_instruction;
+        insert_before->prev_instruction = last;
+    }
+
+    if (first->prev_instruction == NULL) {
+        block->block.first_instruction = first;
+    } else {
+        first->prev_instruction->next_instruction = first;
+    }
+}
+
+lyir_value* lyir_value_instruction_prev_get(lyir_value* instruction) {
+    assert(instruction != NULL);
+    assert(lyir_value_is_instruction(instruction));
+    return instruction->prev_instruction;
+}
+
+lyir_value* lyir_value_instruction_next_get(lyir_value* instruction) {
+    assert(instruction != NULL);
+    assert(lyir_value_is_instruction(instruction));
+    return instruction->next_instruction;
 }
 
 bool lyir_value_is_terminator(lyir_value* instruction) {
@@ -540,8 +1220,46 @@ lca_string_view lyir_value_name_get(lyir_value* value) {
     return value->name;
 }
 
+static void layec_function_ensure_instruction_indices(lyir_value* function) {
+    assert(function != NULL);
+    assert(lyir_value_is_function(function));
+
+    if (!function->function.instruction_indices_dirty) {
+        return;
+    }
+
+    int64_t instruction_index = lyir_function_type_parameter_count_get(function->type);
+
+    for (int64_t b = 0, bcount = lca_da_count(function->function.blocks); b < bcount; b++) {
+        lyir_value* block = function->function.blocks[b];
+        assert(block != NULL);
+        assert(lyir_value_is_block(block));
+
+        for (lyir_value* instruction = block->block.first_instruction; instruction != NULL; instruction = instruction->next_instruction) {
+            assert(lyir_value_is_instruction(instruction));
+
+            if (instruction->type->kind == LYIR_TYPE_VOID) {
+                instruction->index = 0;
+                continue;
+            }
+
+            instruction->index = instruction_index;
+            instruction_index++;
+        }
+    }
+
+    function->function.instruction_indices_dirty = false;
+}
+
 int64_t lyir_value_index_get(lyir_value* value) {
     assert(value != NULL);
+
+    if (value->parent_block != NULL) {
+        lyir_value* function = value->parent_block->block.parent_function;
+        assert(function != NULL);
+        layec_function_ensure_instruction_indices(function);
+    }
+
     return value->index;
 }
 
@@ -648,39 +1366,62 @@ lyir_value* lyir_value_callee_get(lyir_value* call) {
 int64_t lyir_value_call_argument_count_get(lyir_value* call) {
     assert(call != NULL);
     assert(call->kind == LYIR_IR_CALL);
-    return lca_da_count(call->call.arguments);
+    return lca_small_da_count(call->call.arguments);
 }
 
 lyir_value* lyir_value_call_argument_get_at_index(lyir_value* call, int64_t argument_index) {
     assert(call != NULL);
     assert(call->kind == LYIR_IR_CALL);
     assert(argument_index >= 0);
-    int64_t count = lca_da_count(call->call.arguments);
+    int64_t count = lca_small_da_count(call->call.arguments);
     assert(argument_index < count);
-    lyir_value* argument = call->call.arguments[argument_index];
+    lyir_value* argument = lca_small_da_data(call->call.arguments)[argument_index];
     assert(argument != NULL);
     return argument;
 }
 
+// the call takes ownership of `arguments`; they're copied into the call's own list and the array is freed.
+static void layec_call_arguments_set(lyir_value* call, lca_da(lyir_value*) arguments) {
+    assert(call != NULL);
+    assert(call->kind == LYIR_IR_CALL);
+
+    int64_t argument_count = lca_da_count(arguments);
+    call->call.arguments.count = 0;
+    lca_small_da_reserve_exact(call->call.arguments, argument_count);
+
+    for (int64_t i = 0; i < argument_count; i++) {
+        assert(arguments[i] != NULL);
+        lca_small_da_push(call->call.arguments, NULL);
+        layec_value_operand_set(call, i + 1, arguments[i]);
+    }
+
+    lca_da_free(arguments);
+}
+
 void lyir_value_call_arguments_set(lyir_value* call, lca_da(lyir_value*) arguments) {
     assert(call != NULL);
     assert(call->kind == LYIR_IR_CALL);
-    call->call.arguments = arguments;
+
+    for (int64_t i = 0, count = lca_small_da_count(call->call.arguments); i < count; i++) {
+        layec_use_unlink(layec_value_operand_use(call, i + 1));
+    }
+
+    layec_call_arguments_set(call, arguments);
 }
 
 int64_t lyir_value_builtin_argument_count_get(lyir_value* builtin) {
     assert(builtin != NULL);
     assert(builtin->kind == LYIR_IR_BUILTIN);
-    return lca_da_count(builtin->builtin.arguments);
+    return lca_small_da_count(builtin->builtin.arguments);
 }
 
 lyir_value* lyir_value_builtin_argument_set_at_index(lyir_value* builtin, int64_t argument_index) {
     assert(builtin != NULL);
     assert(builtin->kind == LYIR_IR_BUILTIN);
     assert(argument_index >= 0);
-    int64_t count = lca_da_count(builtin->builtin.arguments);
+    int64_t count = lca_small_da_count(builtin->builtin.arguments);
     assert(argument_index < count);
-    lyir_value* argument = builtin->builtin.arguments[argument_index];
+    lyir_value* argument = lca_small_da_data(builtin->builtin.arguments)[argument_index];
     assert(argument != NULL);
     return argument;
 }
@@ -692,24 +1433,24 @@ void lyir_value_phi_incoming_value_add(lyir_value* phi, lyir_value* value, lyir_
     assert(block != NULL);
     assert(block->kind == LYIR_IR_BLOCK);
 
-    layec_incoming_value incoming_value = {
-        .value = value,
-        .block = block,
-    };
+    int64_t incoming_index = lca_small_da_count(phi->incoming_values);
+    lca_small_da_push(phi->incoming_values, (layec_incoming_value){0});
 
-    lca_da_push(phi->incoming_values, incoming_value);
+    layec_value_operand_set(phi, 2 * incoming_index, value);
+    layec_value_operand_set(phi, 2 * incoming_index + 1, block);
 }
 
 int64_t lyir_value_phi_incoming_value_count_get(lyir_value* phi) {
     assert(phi != NULL);
     assert(phi->kind == LYIR_IR_PHI);
-    return lca_da_count(phi->incoming_values);
+    return lca_small_da_count(phi->incoming_values);
 }
 
 lyir_value* lyir_phi_incoming_value_get_at_index(lyir_value* phi, int64_t index) {
     assert(phi != NULL);
     assert(phi->kind == LYIR_IR_PHI);
-    lyir_value* value = phi->incoming_values[index].value;
+    assert(index >= 0 && index < lca_small_da_count(phi->incoming_values));
+    lyir_value* value = lca_small_da_data(phi->incoming_values)[index].value;
     assert(value != NULL);
     return value;
 }
@@ -717,7 +1458,8 @@ lyir_value* lyir_phi_incoming_value_get_at_index(lyir_value* phi, int64_t index)
 lyir_value* lyir_phi_incoming_block_get_at_index(lyir_value* phi, int64_t index) {
     assert(phi != NULL);
     assert(phi->kind == LYIR_IR_PHI);
-    lyir_value* block = phi->incoming_values[index].block;
+    assert(index >= 0 && index < lca_small_da_count(phi->incoming_values));
+    lyir_value* block = lca_small_da_data(phi->incoming_values)[index].block;
     assert(block != NULL);
     assert(block->kind == LYIR_IR_BLOCK);
     return block;
@@ -850,21 +1592,12 @@ lyir_type* lyir_int_type(lyir_context* context, int bit_width) {
     assert(bit_width > 0);
     assert(bit_width <= 65535);
 
-    for (int64_t i = 0, count = lca_da_count(context->types.int_types); i < count; i++) {
-        lyir_type* int_type = context->types.int_types[i];
-        assert(int_type != NULL);
-        assert(lyir_type_is_integer(int_type));
-
-        if (int_type->primitive_bit_width == bit_width) {
-            return int_type;
-        }
-    }
+    lyir_type key = {
+        .kind = LYIR_TYPE_INTEGER,
+        .primitive_bit_width = bit_width,
+    };
 
-    lyir_type* int_type = layec_type_create(context, LYIR_TYPE_INTEGER);
-    assert(int_type != NULL);
-    int_type->primitive_bit_width = bit_width;
-    lca_da_push(context->types.int_types, int_type);
-    return int_type;
+    return layec_unique_type_get_or_create(context, &key, NULL);
 }
 
 static lyir_type* layec_create_float_type(lyir_context* context, int bit_width) {
@@ -907,11 +1640,15 @@ lyir_type* lyir_array_type(lyir_context* context, int64_t length, lyir_type* ele
     assert(length >= 0);
     assert(element_type != NULL);
 
-    lyir_type* array_type = layec_type_create(context, LYIR_TYPE_ARRAY);
-    assert(array_type != NULL);
-    array_type->array.element_type = element_type;
-    array_type->array.length = length;
-    return array_type;
+    lyir_type key = {
+        .kind = LYIR_TYPE_ARRAY,
+        .array = {
+            .element_type = element_type,
+            .length = length,
+        },
+    };
+
+    return layec_unique_type_get_or_create(context, &key, NULL);
 }
 
 lyir_type* lyir_function_type(
@@ -928,30 +1665,62 @@ lyir_type* lyir_function_type(
     }
     assert(calling_convention != LYIR_DEFAULTCC);
 
-    lyir_type* function_type = layec_type_create(context, LYIR_TYPE_FUNCTION);
+    lyir_type key = {
+        .kind = LYIR_TYPE_FUNCTION,
+        .function = {
+            .return_type = return_type,
+            .parameter_types = parameter_types,
+            .calling_convention = calling_convention,
+            .is_variadic = is_variadic,
+        },
+    };
+
+    bool created = false;
+    lyir_type* function_type = layec_unique_type_get_or_create(context, &key, &created);
     assert(function_type != NULL);
-    function_type->function.return_type = return_type;
-    function_type->function.parameter_types = parameter_types;
-    function_type->function.calling_convention = calling_convention;
-    function_type->function.is_variadic = is_variadic;
+
+    if (!created) {
+        lca_da_free(parameter_types);
+    }
 
     return function_type;
 }
 
 lyir_type* lyir_struct_type(lyir_context* context, lca_string_view name, lca_da(lyir_struct_member) members) {
     assert(context != NULL);
-    assert(name.count != 0);
     for (int64_t i = 0, count = lca_da_count(members); i < count; i++) {
         assert(members[i].type != NULL);
     }
 
-    lyir_type* struct_type = layec_type_create(context, LYIR_TYPE_STRUCT);
+    // named struct types are nominal, two of them with the same members are still different types.
+    if (name.count != 0) {
+        lyir_type* struct_type = layec_type_create(context, LYIR_TYPE_STRUCT);
+        assert(struct_type != NULL);
+        struct_type->_struct.named = true;
+        struct_type->_struct.name = name;
+        struct_type->_struct.members = members;
+        lca_da_push(context->_all_struct_types, struct_type);
+        return struct_type;
+    }
+
+    lyir_type key = {
+        .kind = LYIR_TYPE_STRUCT,
+        ._struct = {
+            .members = members,
+            .named = false,
+        },
+    };
+
+    bool created = false;
+    lyir_type* struct_type = layec_unique_type_get_or_create(context, &key, &created);
     assert(struct_type != NULL);
-    // TODO(local): unnamed struct types
-    struct_type->_struct.named = true;
-    struct_type->_struct.name = name;
-    struct_type->_struct.members = members;
-    lca_da_push(context->_all_struct_types, struct_type);
+
+    if (created) {
+        struct_type->_struct.index = lca_da_count(context->_all_struct_types);
+        lca_da_push(context->_all_struct_types, struct_type);
+    } else {
+        lca_da_free(members);
+    }
 
     return struct_type;
 }
@@ -1088,20 +1857,13 @@ bool lyir_function_type_is_variadic(lyir_type* function_type) {
     return function_type->function.is_variadic;
 }
 
-void lyir_function_type_parameter_type_set_at_index(lyir_type* function_type, int64_t parameter_index, lyir_type* param_type) {
-    assert(function_type != NULL);
-    assert(lyir_type_is_function(function_type));
-    assert(parameter_index >= 0);
-    assert(parameter_index < lca_da_count(function_type->function.parameter_types));
-    assert(param_type != NULL);
-    function_type->function.parameter_types[parameter_index] = param_type;
-}
-
 static lyir_value* layec_value_create_in_context(lyir_context* context, lyir_location location, lyir_value_kind kind, lyir_type* type, lca_string_view name) {
     assert(context != NULL);
     assert(type != NULL);
 
-    lyir_value* value = lca_allocate(context->allocator, sizeof *value);
+    assert(context->value_arena != NULL);
+
+    lyir_value* value = lca_arena_push(context->value_arena, sizeof *value);
     assert(value != NULL);
     value->kind = kind;
     value->module = NULL;
@@ -1113,21 +1875,6 @@ static lyir_value* layec_value_create_in_context(lyir_context* context, lyir_loc
     return value;
 }
 
-static int64_t layec_instruction_get_index_within_block(lyir_value* instruction) {
-    assert(instruction != NULL);
-    lyir_value* block = instruction->parent_block;
-    assert(block != NULL);
-    assert(lyir_value_is_block(block));
-
-    for (int64_t i = 0, count = lca_da_count(block->block.instructions); i < count; i++) {
-        if (instruction == block->block.instructions[i]) {
-            return i;
-        }
-    }
-
-    return -1;
-}
-
 bool lyir_type_is_ptr(lyir_type* type) {
     assert(type != NULL);
     return type->kind == LYIR_TYPE_POINTER;
@@ -1189,6 +1936,13 @@ void lyir_value_type_set(lyir_value* value, lyir_type* type) {
     assert(value != NULL);
     assert(type != NULL);
     value->type = type;
+
+    // void instructions are not numbered, so retyping one can shift the indices of those after it
+    if (value->parent_block != NULL) {
+        lyir_value* function = value->parent_block->block.parent_function;
+        assert(function != NULL);
+        function->function.instruction_indices_dirty = true;
+    }
 }
 
 lyir_value* lyir_module_create_function(lyir_module* module, lyir_location location, lca_string_view function_name, lyir_type* function_type, lca_da(lyir_value*) parameters, lyir_linkage linkage) {
@@ -1239,9 +1993,22 @@ lyir_value* lyir_int_constant_create(lyir_context* context, lyir_location locati
     assert(type != NULL);
     assert(lyir_type_is_integer(type));
 
-    lyir_value* int_value = layec_value_create_in_context(context, location, LYIR_IR_INTEGER_CONSTANT, type, LCA_SV_EMPTY);
+    lyir_constant_key key = {
+        .kind = LYIR_IR_INTEGER_CONSTANT,
+        .type = type,
+        .bits = (uint64_t)value,
+    };
+
+    __typeof__(context->_unique_constants) entry = lca_hashmap_insert(context->_unique_constants, key);
+    if (entry->value != NULL) {
+        return entry->value;
+    }
+
+    lyir_value* int_value = layec_value_create_in_context(context, (lyir_location){0}, LYIR_IR_INTEGER_CONSTANT, type, LCA_SV_EMPTY);
     assert(int_value != NULL);
     int_value->int_value = value;
+
+    entry->value = int_value;
     return int_value;
 }
 
@@ -1250,9 +2017,26 @@ lyir_value* lyir_float_constant_create(lyir_context* context, lyir_location loca
     assert(type != NULL);
     assert(lyir_type_is_float(type));
 
-    lyir_value* float_value = layec_value_create_in_context(context, location, LYIR_IR_FLOAT_CONSTANT, type, LCA_SV_EMPTY);
+    // compare floats by representation, so 0.0 and -0.0 stay distinct and NaNs can still be uniqued.
+    uint64_t bits = 0;
+    memcpy(&bits, &value, sizeof bits);
+
+    lyir_constant_key key = {
+        .kind = LYIR_IR_FLOAT_CONSTANT,
+        .type = type,
+        .bits = bits,
+    };
+
+    __typeof__(context->_unique_constants) entry = lca_hashmap_insert(context->_unique_constants, key);
+    if (entry->value != NULL) {
+        return entry->value;
+    }
+
+    lyir_value* float_value = layec_value_create_in_context(context, (lyir_location){0}, LYIR_IR_FLOAT_CONSTANT, type, LCA_SV_EMPTY);
     assert(float_value != NULL);
     float_value->float_value = value;
+
+    entry->value = float_value;
     return float_value;
 }
 
@@ -1328,7 +2112,7 @@ void lyir_builder_reset(lyir_builder* builder) {
     assert(builder != NULL);
     builder->function = NULL;
     builder->block = NULL;
-    builder->insert_index = -1;
+    builder->insert_before = NULL;
 }
 
 void lyir_builder_position_before(lyir_builder* builder, lyir_value* instruction) {
@@ -1346,9 +2130,7 @@ void lyir_builder_position_before(lyir_builder* builder, lyir_value* instruction
 
     builder->function = function;
     builder->block = block;
-    builder->insert_index = layec_instruction_get_index_within_block(instruction);
-    assert(builder->insert_index >= 0);
-    assert(builder->insert_index < lca_da_count(block->block.instructions));
+    builder->insert_before = instruction;
 }
 
 void lyir_builder_position_after(lyir_builder* builder, lyir_value* instruction) {
@@ -1366,9 +2148,7 @@ void lyir_builder_position_after(lyir_builder* builder, lyir_value* instruction)
 
     builder->function = function;
     builder->block = block;
-    builder->insert_index = layec_instruction_get_index_within_block(instruction) + 1;
-    assert(builder->insert_index > 0);
-    assert(builder->insert_index <= lca_da_count(block->block.instructions));
+    builder->insert_before = instruction->next_instruction;
 }
 
 void lyir_builder_position_at_end(lyir_builder* builder, lyir_value* block) {
@@ -1384,8 +2164,7 @@ void lyir_builder_position_at_end(lyir_builder* builder, lyir_value* block) {
 
     builder->function = function;
     builder->block = block;
-    builder->insert_index = lca_da_count(block->block.instructions);
-    assert(builder->insert_index >= 0);
+    builder->insert_before = NULL;
 }
 
 lyir_value* lyir_builder_insert_block_get(lyir_builder* builder) {
@@ -1394,34 +2173,6 @@ lyir_value* lyir_builder_insert_block_get(lyir_builder* builder) {
     return builder->block;
 }
 
-static void layec_builder_recalculate_instruction_indices(lyir_builder* builder) {
-    assert(builder != NULL);
-    assert(builder->function != NULL);
-    assert(lyir_value_is_function(builder->function));
-
-    int64_t instruction_index = lyir_function_type_parameter_count_get(builder->function->type);
-
-    for (int64_t b = 0, bcount = lca_da_count(builder->function->function.blocks); b < bcount; b++) {
-        lyir_value* block = builder->function->function.blocks[b];
-        assert(block != NULL);
-        assert(lyir_value_is_block(block));
-
-        for (int64_t i = 0, icount = lca_da_count(block->block.instructions); i < icount; i++) {
-            lyir_value* instruction = block->block.instructions[i];
-            assert(instruction != NULL);
-            assert(lyir_value_is_instruction(instruction));
-
-            if (instruction->type->kind == LYIR_TYPE_VOID) {
-                instruction->index = 0;
-                continue;
-            }
-
-            instruction->index = instruction_index;
-            instruction_index++;
-        }
-    }
-}
-
 void lyir_builder_insert(lyir_builder* builder, lyir_value* instruction) {
     assert(builder != NULL);
     assert(builder->context != NULL);
@@ -1429,27 +2180,11 @@ void lyir_builder_insert(lyir_builder* builder, lyir_value* instruction) {
     assert(lyir_value_is_instruction(instruction));
     assert(instruction->parent_block == NULL);
     lyir_value* block = builder->block;
+    assert(block != NULL);
     assert(lyir_value_is_block(block));
-    int64_t insert_index = builder->insert_index;
-    assert(insert_index >= 0);
-    assert(insert_index <= lca_da_count(block->block.instructions));
-
-    instruction->parent_block = block;
-
-    // reserve space for the new instruction
-    lca_da_push(block->block.instructions, NULL);
-
-    // move everything over if necessary
-    for (int64_t i = insert_index, count = lca_da_count(block->block.instructions) - 1; i < count; i++) {
-        block->block.instructions[i + 1] = block->block.instructions[i];
-    }
-
-    block->block.instructions[insert_index] = instruction;
-    builder->insert_index++;
+    assert(block->block.parent_function == builder->function);
 
-    instruction->index = -1;
-    layec_builder_recalculate_instruction_indices(builder);
-    assert(instruction->index >= 0);
+    layec_block_link_instruction(block, instruction, builder->insert_before);
 }
 
 void lyir_builder_insert_with_name(lyir_builder* builder, lyir_value* instruction, lca_string_view name) {
@@ -1507,9 +2242,10 @@ lyir_value* lyir_build_call(lyir_builder* builder, lyir_location location, lyir_
 
     lyir_value* call = layec_value_create(builder->function->module, location, LYIR_IR_CALL, result_type, name);
     assert(call != NULL);
-    call->call.callee = callee;
+    layec_value_operand_set(call, 0, callee);
     call->call.callee_type = callee_type;
-    call->call.arguments = arguments;
+    layec_call_arguments_set(call, arguments);
+
     call->call.calling_convention = callee_type->function.calling_convention;
     call->call.is_tail_call = false;
 
@@ -1527,7 +2263,7 @@ lyir_value* lyir_build_return(lyir_builder* builder, lyir_location location, lyi
 
     lyir_value* ret = layec_value_create(builder->function->module, location, LYIR_IR_RETURN, lyir_void_type(builder->context), LCA_SV_EMPTY);
     assert(ret != NULL);
-    ret->return_value = value;
+    layec_value_operand_set(ret, 0, value);
 
     lyir_builder_insert(builder, ret);
     return ret;
@@ -1590,8 +2326,8 @@ lyir_value* lyir_build_store(lyir_builder* builder, lyir_location location, lyir
 
     lyir_value* store = layec_value_create(builder->function->module, location, LYIR_IR_STORE, lyir_void_type(builder->context), LCA_SV_EMPTY);
     assert(store != NULL);
-    store->address = address;
-    store->operand = value;
+    layec_value_operand_set(store, 0, address);
+    layec_value_operand_set(store, 1, value);
 
     lyir_builder_insert(builder, store);
     return store;
@@ -1609,7 +2345,7 @@ lyir_value* lyir_build_load(lyir_builder* builder, lyir_location location, lyir_
 
     lyir_value* load = layec_value_create(builder->function->module, location, LYIR_IR_LOAD, type, LCA_SV_EMPTY);
     assert(load != NULL);
-    load->address = address;
+    layec_value_operand_set(load, 0, address);
 
     lyir_builder_insert(builder, load);
     return load;
@@ -1626,7 +2362,7 @@ lyir_value* lyir_build_branch(lyir_builder* builder, lyir_location location, lyi
 
     lyir_value* branch = layec_value_create(builder->function->module, location, LYIR_IR_BRANCH, lyir_void_type(builder->context), LCA_SV_EMPTY);
     assert(branch != NULL);
-    branch->branch.pass = block;
+    layec_value_operand_set(branch, 0, block);
 
     lyir_builder_insert(builder, branch);
     return branch;
@@ -1648,9 +2384,9 @@ lyir_value* lyir_build_branch_conditional(lyir_builder* builder, lyir_location l
 
     lyir_value* branch = layec_value_create(builder->function->module, location, LYIR_IR_COND_BRANCH, lyir_void_type(builder->context), LCA_SV_EMPTY);
     assert(branch != NULL);
-    branch->operand = condition;
-    branch->branch.pass = pass_block;
-    branch->branch.fail = fail_block;
+    layec_value_operand_set(branch, 0, condition);
+    layec_value_operand_set(branch, 1, pass_block);
+    layec_value_operand_set(branch, 2, fail_block);
 
     lyir_builder_insert(builder, branch);
     return branch;
@@ -1682,7 +2418,7 @@ lyir_value* lyir_build_unary(lyir_builder* builder, lyir_location location, lyir
 
     lyir_value* unary = layec_value_create(builder->function->module, location, kind, type, LCA_SV_EMPTY);
     assert(unary != NULL);
-    unary->operand = operand;
+    layec_value_operand_set(unary, 0, operand);
 
     lyir_builder_insert(builder, unary);
     return unary;
@@ -1718,8 +2454,8 @@ static lyir_value* lyir_build_binary(lyir_builder* builder, lyir_location locati
 
     lyir_value* cmp = layec_value_create(builder->function->module, location, kind, type, LCA_SV_EMPTY);
     assert(cmp != NULL);
-    cmp->binary.lhs = lhs;
-    cmp->binary.rhs = rhs;
+    layec_value_operand_set(cmp, 0, lhs);
+    layec_value_operand_set(cmp, 1, rhs);
 
     lyir_builder_insert(builder, cmp);
     return cmp;
@@ -1948,21 +2684,32 @@ static lyir_value* lyir_build_builtin(lyir_builder* builder, lyir_location locat
     return builtin;
 }
 
+static void layec_builtin_arguments_set(lyir_value* builtin, lyir_value** arguments, int64_t argument_count) {
+    assert(builtin != NULL);
+    assert(builtin->kind == LYIR_IR_BUILTIN);
+    assert(lca_small_da_count(builtin->builtin.arguments) == 0);
+
+    lca_small_da_reserve_exact(builtin->builtin.arguments, argument_count);
+    for (int64_t i = 0; i < argument_count; i++) {
+        assert(arguments[i] != NULL);
+        lca_small_da_push(builtin->builtin.arguments, NULL);
+        layec_value_operand_set(builtin, i, arguments[i]);
+    }
+}
+
 lyir_value* lyir_build_builtin_memset(lyir_builder* builder, lyir_location location, lyir_value* address, lyir_value* value, lyir_value* count) {
     lyir_value* builtin = lyir_build_builtin(builder, location, LYIR_BUILTIN_MEMSET);
     assert(builtin != NULL);
-    lca_da_push(builtin->builtin.arguments, address);
-    lca_da_push(builtin->builtin.arguments, value);
-    lca_da_push(builtin->builtin.arguments, count);
+    lyir_value* arguments[] = {address, value, count};
+    layec_builtin_arguments_set(builtin, arguments, 3);
     return builtin;
 }
 
 lyir_value* lyir_build_builtin_memcpy(lyir_builder* builder, lyir_location location, lyir_value* source_address, lyir_value* dest_address, lyir_value* count) {
     lyir_value* builtin = lyir_build_builtin(builder, location, LYIR_BUILTIN_MEMSET);
     assert(builtin != NULL);
-    lca_da_push(builtin->builtin.arguments, source_address);
-    lca_da_push(builtin->builtin.arguments, dest_address);
-    lca_da_push(builtin->builtin.arguments, count);
+    lyir_value* arguments[] = {source_address, dest_address, count};
+    layec_builtin_arguments_set(builtin, arguments, 3);
     return builtin;
 }
 
@@ -1979,8 +2726,8 @@ lyir_value* lyir_build_ptradd(lyir_builder* builder, lyir_location location, lyi
 
     lyir_value* ptradd = layec_value_create(builder->function->module, location, LYIR_IR_PTRADD, lyir_ptr_type(builder->context), LCA_SV_EMPTY);
     assert(ptradd != NULL);
-    ptradd->address = address;
-    ptradd->operand = offset_value;
+    layec_value_operand_set(ptradd, 0, address);
+    layec_value_operand_set(ptradd, 1, offset_value);
 
     lyir_builder_insert(builder, ptradd);
     return ptradd;
@@ -2018,33 +2765,40 @@ lca_string lyir_module_print(lyir_module* module, bool use_color) {
 
     // bool use_color = print_context.use_color;
 
-    lca_string_append_format(
-        print_context.output,
-        "%s; LayeC IR Module: %.*s%s\n",
-        COL(COL_COMMENT),
-        LCA_STR_EXPAND(module->name),
-        COL(RESET)
-    );
+    lca_string_append_cstring(print_context.output, COL(COL_COMMENT));
+    lca_string_append_cstring(print_context.output, "; LayeC IR Module: ");
+    lca_string_append_view(print_context.output, module->name);
+    lca_string_append_cstring(print_context.output, COL(RESET));
+    lca_string_append_char(print_context.output, '\n');
 
     for (int64_t i = 0; i < lyir_context_get_struct_type_count(module->context); i++) {
         lyir_type* struct_type = lyir_context_get_struct_type_at_index(module->context, i);
         if (lyir_type_struct_is_named(struct_type)) {
-            lca_string_append_format(print_context.output, "%sdefine %s%.*s %s= ", COL(COL_KEYWORD), COL(COL_NAME), LCA_STR_EXPAND(lyir_type_struct_name_get(struct_type)), COL(RESET));
+            lca_string_append_cstring(print_context.output, COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context.output, "define ");
+            lca_string_append_cstring(print_context.output, COL(COL_NAME));
+            lca_string_append_view(print_context.output, lyir_type_struct_name_get(struct_type));
+            lca_string_append_char(print_context.output, ' ');
+            lca_string_append_cstring(print_context.output, COL(RESET));
+            lca_string_append_cstring(print_context.output, "= ");
             layec_type_print_struct_type_to_string_literally(struct_type, print_context.output, use_color);
-            lca_string_append_format(print_context.output, "%s\n", COL(RESET));
+            lca_string_append_cstring(print_context.output, COL(RESET));
+            lca_string_append_char(print_context.output, '\n');
         }
     }
 
     for (int64_t i = 0, count = lca_da_count(module->globals); i < count; i++) {
-        if (i > 0) lca_string_append_format(print_context.output, "\n");
+        if (i > 0) lca_string_append_char(print_context.output, '\n');
         layec_global_print(&print_context, module->globals[i]);
     }
 
-    if (lca_da_count(module->globals) > 0) lca_string_append_format(print_context.output, "\n");
+    if (lca_da_count(module->globals) > 0) lca_string_append_char(print_context.output, '\n');
 
     for (int64_t i = 0, count = lca_da_count(module->functions); i < count; i++) {
-        if (i > 0) lca_string_append_format(print_context.output, "\n");
+        if (i > 0) lca_string_append_char(print_context.output, '\n');
+        lca_arena_mark temp_mark = lca_temp_mark();
         layec_function_print(&print_context, module->functions[i]);
+        lca_temp_restore(temp_mark);
     }
 
     return output_string;
@@ -2072,25 +2826,18 @@ static void layec_instruction_print_name_if_required(layec_print_context* print_
         return;
     }
 
+    lca_string_append_cstring(print_context->output, COL(COL_NAME));
+    lca_string_append_char(print_context->output, '%');
     if (instruction->name.count == 0) {
-        lca_string_append_format(
-            print_context->output,
-            "%s%%%lld %s= %s",
-            COL(COL_NAME),
-            instruction->index,
-            COL(COL_DELIM),
-            COL(RESET)
-        );
+        lca_string_append_int(print_context->output, lyir_value_index_get(instruction));
     } else {
-        lca_string_append_format(
-            print_context->output,
-            "%s%%%.*s %s= %s",
-            COL(COL_NAME),
-            LCA_STR_EXPAND(instruction->name),
-            COL(COL_DELIM),
-            COL(RESET)
-        );
+        lca_string_append_view(print_context->output, instruction->name);
     }
+
+    lca_string_append_char(print_context->output, ' ');
+    lca_string_append_cstring(print_context->output, COL(COL_DELIM));
+    lca_string_append_cstring(print_context->output, "= ");
+    lca_string_append_cstring(print_context->output, COL(RESET));
 }
 
 static void layec_instruction_print(layec_print_context* print_context, lyir_value* instruction) {
@@ -2100,7 +2847,7 @@ static void layec_instruction_print(layec_print_context* print_context, lyir_val
 
     bool use_color = print_context->use_color;
 
-    lca_string_append_format(print_context->output, "  ");
+    lca_string_append_cstring(print_context->output, "  ");
     layec_instruction_print_name_if_required(print_context, instruction);
 
     switch (instruction->kind) {
@@ -2110,88 +2857,118 @@ static void layec_instruction_print(layec_print_context* print_context, lyir_val
         } break;
 
         case LYIR_IR_NOP: {
-            lca_string_append_format(print_context->output, "%snop", COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, "nop");
         } break;
 
         case LYIR_IR_ALLOCA: {
-            lca_string_append_format(print_context->output, "%salloca ", COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, "alloca ");
             lyir_type_print_to_string(instruction->alloca.element_type, print_context->output, use_color);
             if (instruction->alloca.element_count != 1) {
-                lca_string_append_format(print_context->output, "%s, %s%lld", COL(COL_DELIM), COL(COL_CONSTANT), instruction->alloca.element_count);
+                lca_string_append_cstring(print_context->output, COL(COL_DELIM));
+                lca_string_append_cstring(print_context->output, ", ");
+                lca_string_append_cstring(print_context->output, COL(COL_CONSTANT));
+                lca_string_append_int(print_context->output, instruction->alloca.element_count);
             }
         } break;
 
         case LYIR_IR_STORE: {
-            lca_string_append_format(print_context->output, "%sstore ", COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, "store ");
             lyir_value_print_to_string(instruction->address, print_context->output, false, use_color);
-            lca_string_append_format(print_context->output, "%s, ", COL(RESET));
+            lca_string_append_cstring(print_context->output, COL(RESET));
+            lca_string_append_cstring(print_context->output, ", ");
             lyir_value_print_to_string(instruction->operand, print_context->output, true, use_color);
         } break;
 
         case LYIR_IR_LOAD: {
-            lca_string_append_format(print_context->output, "%sload ", COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, "load ");
             lyir_type_print_to_string(instruction->type, print_context->output, use_color);
-            lca_string_append_format(print_context->output, "%s, ", COL(RESET));
+            lca_string_append_cstring(print_context->output, COL(RESET));
+            lca_string_append_cstring(print_context->output, ", ");
             lyir_value_print_to_string(instruction->address, print_context->output, false, use_color);
         } break;
 
         case LYIR_IR_BRANCH: {
-            lca_string_append_format(print_context->output, "%sbranch ", COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, "branch ");
             lyir_value_print_to_string(instruction->branch.pass, print_context->output, false, use_color);
         } break;
 
         case LYIR_IR_COND_BRANCH: {
-            lca_string_append_format(print_context->output, "%sbranch ", COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, "branch ");
             lyir_value_print_to_string(instruction->operand, print_context->output, false, use_color);
-            lca_string_append_format(print_context->output, "%s, ", COL(RESET));
+            lca_string_append_cstring(print_context->output, COL(RESET));
+            lca_string_append_cstring(print_context->output, ", ");
             lyir_value_print_to_string(instruction->branch.pass, print_context->output, false, use_color);
-            lca_string_append_format(print_context->output, "%s, ", COL(RESET));
+            lca_string_append_cstring(print_context->output, COL(RESET));
+            lca_string_append_cstring(print_context->output, ", ");
             lyir_value_print_to_string(instruction->branch.fail, print_context->output, false, use_color);
         } break;
 
         case LYIR_IR_PHI: {
-            lca_string_append_format(print_context->output, "%sphi ", COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, "phi ");
             lyir_type_print_to_string(instruction->type, print_context->output, use_color);
 
             for (int64_t i = 0, count = lyir_value_phi_incoming_value_count_get(instruction); i < count; i++) {
-                if (i > 0) lca_string_append_format(print_context->output, "%s,", COL(RESET));
-                lca_string_append_format(print_context->output, "%s [ ", COL(RESET));
+                if (i > 0) {
+                    lca_string_append_cstring(print_context->output, COL(RESET));
+                    lca_string_append_char(print_context->output, ',');
+                }
+
+                lca_string_append_cstring(print_context->output, COL(RESET));
+                lca_string_append_cstring(print_context->output, " [ ");
                 lyir_value_print_to_string(lyir_phi_incoming_value_get_at_index(instruction, i), print_context->output, false, use_color);
-                lca_string_append_format(print_context->output, "%s, ", COL(RESET));
+                lca_string_append_cstring(print_context->output, COL(RESET));
+                lca_string_append_cstring(print_context->output, ", ");
                 lyir_value_print_to_string(lyir_phi_incoming_block_get_at_index(instruction, i), print_context->output, false, use_color);
-                lca_string_append_format(print_context->output, "%s ]", COL(RESET));
+                lca_string_append_cstring(print_context->output, COL(RESET));
+                lca_string_append_cstring(print_context->output, " ]");
             }
         } break;
 
         case LYIR_IR_RETURN: {
-            lca_string_append_format(print_context->output, "%sreturn", COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, "return");
             if (instruction->return_value != NULL) {
-                lca_string_append_format(print_context->output, " ", COL(COL_KEYWORD));
+                lca_string_append_char(print_context->output, ' ');
                 lyir_value_print_to_string(instruction->return_value, print_context->output, true, use_color);
             }
         } break;
 
         case LYIR_IR_UNREACHABLE: {
-            lca_string_append_format(print_context->output, "%sunreachable", COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, "unreachable");
         } break;
 
         case LYIR_IR_CALL: {
-            lca_string_append_format(print_context->output, "%s%scall %s ", COL(COL_KEYWORD), (instruction->call.is_tail_call ? "tail " : ""), ir_calling_convention_to_cstring(instruction->call.calling_convention));
+            lca_string_append_cstring(print_context->output, COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, (instruction->call.is_tail_call ? "tail " : ""));
+            lca_string_append_cstring(print_context->output, "call ");
+            lca_string_append_cstring(print_context->output, ir_calling_convention_to_cstring(instruction->call.calling_convention));
+            lca_string_append_char(print_context->output, ' ');
             lyir_type_print_to_string(instruction->type, print_context->output, use_color);
-            lca_string_append_format(print_context->output, " ");
+            lca_string_append_char(print_context->output, ' ');
             lyir_value_print_to_string(instruction->call.callee, print_context->output, false, use_color);
-            lca_string_append_format(print_context->output, "%s(", COL(COL_DELIM));
+            lca_string_append_cstring(print_context->output, COL(COL_DELIM));
+            lca_string_append_char(print_context->output, '(');
 
-            for (int64_t i = 0, count = lca_da_count(instruction->call.arguments); i < count; i++) {
+            for (int64_t i = 0, count = lca_small_da_count(instruction->call.arguments); i < count; i++) {
                 if (i > 0) {
-                    lca_string_append_format(print_context->output, "%s, ", COL(COL_DELIM));
+                    lca_string_append_cstring(print_context->output, COL(COL_DELIM));
+                    lca_string_append_cstring(print_context->output, ", ");
                 }
 
-                lyir_value* argument = instruction->call.arguments[i];
+                lyir_value* argument = lca_small_da_data(instruction->call.arguments)[i];
                 lyir_value_print_to_string(argument, print_context->output, true, use_color);
             }
 
-            lca_string_append_format(print_context->output, "%s)", COL(COL_DELIM));
+            lca_string_append_cstring(print_context->output, COL(COL_DELIM));
+            lca_string_append_char(print_context->output, ')');
         } break;
 
         case LYIR_IR_BUILTIN: {
@@ -2202,390 +2979,502 @@ static void layec_instruction_print(layec_print_context* print_context, lyir_val
                 case LYIR_BUILTIN_MEMCOPY: builtin_name = "memcopy"; break;
             }
 
-            lca_string_append_format(print_context->output, "%sbuiltin ", COL(COL_KEYWORD));
-            lca_string_append_format(print_context->output, "%s@%s%s(", COL(COL_NAME), builtin_name, COL(COL_DELIM));
+            lca_string_append_cstring(print_context->output, COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, "builtin ");
+            lca_string_append_cstring(print_context->output, COL(COL_NAME));
+            lca_string_append_char(print_context->output, '@');
+            lca_string_append_cstring(print_context->output, builtin_name);
+            lca_string_append_cstring(print_context->output, COL(COL_DELIM));
+            lca_string_append_char(print_context->output, '(');
 
-            for (int64_t i = 0, count = lca_da_count(instruction->builtin.arguments); i < count; i++) {
+            for (int64_t i = 0, count = lca_small_da_count(instruction->builtin.arguments); i < count; i++) {
                 if (i > 0) {
-                    lca_string_append_format(print_context->output, "%s, ", COL(COL_DELIM));
+                    lca_string_append_cstring(print_context->output, COL(COL_DELIM));
+                    lca_string_append_cstring(print_context->output, ", ");
                 }
 
-                lyir_value* argument = instruction->builtin.arguments[i];
+                lyir_value* argument = lca_small_da_data(instruction->builtin.arguments)[i];
                 lyir_value_print_to_string(argument, print_context->output, true, use_color);
             }
 
-            lca_string_append_format(print_context->output, "%s)", COL(COL_DELIM));
+            lca_string_append_cstring(print_context->output, COL(COL_DELIM));
+            lca_string_append_char(print_context->output, ')');
         } break;
 
         case LYIR_IR_BITCAST: {
-            lca_string_append_format(print_context->output, "%sbitcast ", COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, "bitcast ");
             lyir_type_print_to_string(instruction->type, print_context->output, use_color);
-            lca_string_append_format(print_context->output, "%s, ", COL(RESET));
+            lca_string_append_cstring(print_context->output, COL(RESET));
+            lca_string_append_cstring(print_context->output, ", ");
             lyir_value_print_to_string(instruction->operand, print_context->output, true, use_color);
         } break;
 
         case LYIR_IR_SEXT: {
-            lca_string_append_format(print_context->output, "%ssext ", COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, "sext ");
             lyir_type_print_to_string(instruction->type, print_context->output, use_color);
-            lca_string_append_format(print_context->output, "%s, ", COL(RESET));
+            lca_string_append_cstring(print_context->output, COL(RESET));
+            lca_string_append_cstring(print_context->output, ", ");
             lyir_value_print_to_string(instruction->operand, print_context->output, true, use_color);
         } break;
 
         case LYIR_IR_ZEXT: {
-            lca_string_append_format(print_context->output, "%szext ", COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, "zext ");
             lyir_type_print_to_string(instruction->type, print_context->output, use_color);
-            lca_string_append_format(print_context->output, "%s, ", COL(RESET));
+            lca_string_append_cstring(print_context->output, COL(RESET));
+            lca_string_append_cstring(print_context->output, ", ");
             lyir_value_print_to_string(instruction->operand, print_context->output, true, use_color);
         } break;
 
         case LYIR_IR_TRUNC: {
-            lca_string_append_format(print_context->output, "%strunc ", COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, "trunc ");
             lyir_type_print_to_string(instruction->type, print_context->output, use_color);
-            lca_string_append_format(print_context->output, "%s, ", COL(RESET));
+            lca_string_append_cstring(print_context->output, COL(RESET));
+            lca_string_append_cstring(print_context->output, ", ");
             lyir_value_print_to_string(instruction->operand, print_context->output, true, use_color);
         } break;
 
         case LYIR_IR_FPEXT: {
-            lca_string_append_format(print_context->output, "%sfpext ", COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, "fpext ");
             lyir_type_print_to_string(instruction->type, print_context->output, use_color);
-            lca_string_append_format(print_context->output, "%s, ", COL(RESET));
+            lca_string_append_cstring(print_context->output, COL(RESET));
+            lca_string_append_cstring(print_context->output, ", ");
             lyir_value_print_to_string(instruction->operand, print_context->output, true, use_color);
         } break;
 
         case LYIR_IR_SITOFP: {
-            lca_string_append_format(print_context->output, "%ssitofp ", COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, "sitofp ");
             lyir_type_print_to_string(instruction->type, print_context->output, use_color);
-            lca_string_append_format(print_context->output, "%s, ", COL(RESET));
+            lca_string_append_cstring(print_context->output, COL(RESET));
+            lca_string_append_cstring(print_context->output, ", ");
             lyir_value_print_to_string(instruction->operand, print_context->output, true, use_color);
         } break;
 
         case LYIR_IR_NEG: {
-            lca_string_append_format(print_context->output, "%sneg ", COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, "neg ");
             lyir_value_print_to_string(instruction->operand, print_context->output, true, use_color);
         } break;
 
         case LYIR_IR_COMPL: {
-            lca_string_append_format(print_context->output, "%scompl ", COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, "compl ");
             lyir_value_print_to_string(instruction->operand, print_context->output, true, use_color);
         } break;
 
         case LYIR_IR_ADD: {
-            lca_string_append_format(print_context->output, "%sadd ", COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, "add ");
             lyir_value_print_to_string(instruction->binary.lhs, print_context->output, true, use_color);
-            lca_string_append_format(print_context->output, "%s, ", COL(RESET));
+            lca_string_append_cstring(print_context->output, COL(RESET));
+            lca_string_append_cstring(print_context->output, ", ");
             lyir_value_print_to_string(instruction->binary.rhs, print_context->output, false, use_color);
         } break;
 
         case LYIR_IR_FADD: {
-            lca_string_append_format(print_context->output, "%sfadd ", COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, "fadd ");
             lyir_value_print_to_string(instruction->binary.lhs, print_context->output, true, use_color);
-            lca_string_append_format(print_context->output, "%s, ", COL(RESET));
+            lca_string_append_cstring(print_context->output, COL(RESET));
+            lca_string_append_cstring(print_context->output, ", ");
             lyir_value_print_to_string(instruction->binary.rhs, print_context->output, false, use_color);
         } break;
 
         case LYIR_IR_SUB: {
-            lca_string_append_format(print_context->output, "%ssub ", COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, "sub ");
             lyir_value_print_to_string(instruction->binary.lhs, print_context->output, true, use_color);
-            lca_string_append_format(print_context->output, "%s, ", COL(RESET));
+            lca_string_append_cstring(print_context->output, COL(RESET));
+            lca_string_append_cstring(print_context->output, ", ");
             lyir_value_print_to_string(instruction->binary.rhs, print_context->output, false, use_color);
         } break;
 
         case LYIR_IR_FSUB: {
-            lca_string_append_format(print_context->output, "%sfsub ", COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, "fsub ");
             lyir_value_print_to_string(instruction->binary.lhs, print_context->output, true, use_color);
-            lca_string_append_format(print_context->output, "%s, ", COL(RESET));
+            lca_string_append_cstring(print_context->output, COL(RESET));
+            lca_string_append_cstring(print_context->output, ", ");
             lyir_value_print_to_string(instruction->binary.rhs, print_context->output, false, use_color);
         } break;
 
         case LYIR_IR_MUL: {
-            lca_string_append_format(print_context->output, "%smul ", COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, "mul ");
             lyir_value_print_to_string(instruction->binary.lhs, print_context->output, true, use_color);
-            lca_string_append_format(print_context->output, "%s, ", COL(RESET));
+            lca_string_append_cstring(print_context->output, COL(RESET));
+            lca_string_append_cstring(print_context->output, ", ");
             lyir_value_print_to_string(instruction->binary.rhs, print_context->output, false, use_color);
         } break;
 
         case LYIR_IR_FMUL: {
-            lca_string_append_format(print_context->output, "%sfmul ", COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, "fmul ");
             lyir_value_print_to_string(instruction->binary.lhs, print_context->output, true, use_color);
-            lca_string_append_format(print_context->output, "%s, ", COL(RESET));
+            lca_string_append_cstring(print_context->output, COL(RESET));
+            lca_string_append_cstring(print_context->output, ", ");
             lyir_value_print_to_string(instruction->binary.rhs, print_context->output, false, use_color);
         } break;
 
         case LYIR_IR_SDIV: {
-            lca_string_append_format(print_context->output, "%ssdiv ", COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, "sdiv ");
             lyir_value_print_to_string(instruction->binary.lhs, print_context->output, true, use_color);
-            lca_string_append_format(print_context->output, "%s, ", COL(RESET));
+            lca_string_append_cstring(print_context->output, COL(RESET));
+            lca_string_append_cstring(print_context->output, ", ");
             lyir_value_print_to_string(instruction->binary.rhs, print_context->output, false, use_color);
         } break;
 
         case LYIR_IR_UDIV: {
-            lca_string_append_format(print_context->output, "%sudiv ", COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, "udiv ");
             lyir_value_print_to_string(instruction->binary.lhs, print_context->output, true, use_color);
-            lca_string_append_format(print_context->output, "%s, ", COL(RESET));
+            lca_string_append_cstring(print_context->output, COL(RESET));
+            lca_string_append_cstring(print_context->output, ", ");
             lyir_value_print_to_string(instruction->binary.rhs, print_context->output, false, use_color);
         } break;
 
         case LYIR_IR_FDIV: {
-            lca_string_append_format(print_context->output, "%sfdiv ", COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, "fdiv ");
             lyir_value_print_to_string(instruction->binary.lhs, print_context->output, true, use_color);
-            lca_string_append_format(print_context->output, "%s, ", COL(RESET));
+            lca_string_append_cstring(print_context->output, COL(RESET));
+            lca_string_append_cstring(print_context->output, ", ");
             lyir_value_print_to_string(instruction->binary.rhs, print_context->output, false, use_color);
         } break;
 
         case LYIR_IR_SMOD: {
-            lca_string_append_format(print_context->output, "%ssmod ", COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, "smod ");
             lyir_value_print_to_string(instruction->binary.lhs, print_context->output, true, use_color);
-            lca_string_append_format(print_context->output, "%s, ", COL(RESET));
+            lca_string_append_cstring(print_context->output, COL(RESET));
+            lca_string_append_cstring(print_context->output, ", ");
             lyir_value_print_to_string(instruction->binary.rhs, print_context->output, false, use_color);
         } break;
 
         case LYIR_IR_UMOD: {
-            lca_string_append_format(print_context->output, "%sumod ", COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, "umod ");
             lyir_value_print_to_string(instruction->binary.lhs, print_context->output, true, use_color);
-            lca_string_append_format(print_context->output, "%s, ", COL(RESET));
+            lca_string_append_cstring(print_context->output, COL(RESET));
+            lca_string_append_cstring(print_context->output, ", ");
             lyir_value_print_to_string(instruction->binary.rhs, print_context->output, false, use_color);
         } break;
 
         case LYIR_IR_FMOD: {
-            lca_string_append_format(print_context->output, "%sfmod ", COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, "fmod ");
             lyir_value_print_to_string(instruction->binary.lhs, print_context->output, true, use_color);
-            lca_string_append_format(print_context->output, "%s, ", COL(RESET));
+            lca_string_append_cstring(print_context->output, COL(RESET));
+            lca_string_append_cstring(print_context->output, ", ");
             lyir_value_print_to_string(instruction->binary.rhs, print_context->output, false, use_color);
         } break;
 
         case LYIR_IR_AND: {
-            lca_string_append_format(print_context->output, "%sand ", COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, "and ");
             lyir_value_print_to_string(instruction->binary.lhs, print_context->output, true, use_color);
-            lca_string_append_format(print_context->output, "%s, ", COL(RESET));
+            lca_string_append_cstring(print_context->output, COL(RESET));
+            lca_string_append_cstring(print_context->output, ", ");
             lyir_value_print_to_string(instruction->binary.rhs, print_context->output, false, use_color);
         } break;
 
         case LYIR_IR_OR: {
-            lca_string_append_format(print_context->output, "%sor ", COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, "or ");
             lyir_value_print_to_string(instruction->binary.lhs, print_context->output, true, use_color);
-            lca_string_append_format(print_context->output, "%s, ", COL(RESET));
+            lca_string_append_cstring(print_context->output, COL(RESET));
+            lca_string_append_cstring(print_context->output, ", ");
             lyir_value_print_to_string(instruction->binary.rhs, print_context->output, false, use_color);
         } break;
 
         case LYIR_IR_XOR: {
-            lca_string_append_format(print_context->output, "%sxor ", COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, "xor ");
             lyir_value_print_to_string(instruction->binary.lhs, print_context->output, true, use_color);
-            lca_string_append_format(print_context->output, "%s, ", COL(RESET));
+            lca_string_append_cstring(print_context->output, COL(RESET));
+            lca_string_append_cstring(print_context->output, ", ");
             lyir_value_print_to_string(instruction->binary.rhs, print_context->output, false, use_color);
         } break;
 
         case LYIR_IR_SHL: {
-            lca_string_append_format(print_context->output, "%sshl ", COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, "shl ");
             lyir_value_print_to_string(instruction->binary.lhs, print_context->output, true, use_color);
-            lca_string_append_format(print_context->output, "%s, ", COL(RESET));
+            lca_string_append_cstring(print_context->output, COL(RESET));
+            lca_string_append_cstring(print_context->output, ", ");
             lyir_value_print_to_string(instruction->binary.rhs, print_context->output, false, use_color);
         } break;
 
         case LYIR_IR_SHR: {
-            lca_string_append_format(print_context->output, "%sshr ", COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, "shr ");
             lyir_value_print_to_string(instruction->binary.lhs, print_context->output, true, use_color);
-            lca_string_append_format(print_context->output, "%s, ", COL(RESET));
+            lca_string_append_cstring(print_context->output, COL(RESET));
+            lca_string_append_cstring(print_context->output, ", ");
             lyir_value_print_to_string(instruction->binary.rhs, print_context->output, false, use_color);
         } break;
 
         case LYIR_IR_SAR: {
-            lca_string_append_format(print_context->output, "%ssar ", COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, "sar ");
             lyir_value_print_to_string(instruction->binary.lhs, print_context->output, true, use_color);
-            lca_string_append_format(print_context->output, "%s, ", COL(RESET));
+            lca_string_append_cstring(print_context->output, COL(RESET));
+            lca_string_append_cstring(print_context->output, ", ");
             lyir_value_print_to_string(instruction->binary.rhs, print_context->output, false, use_color);
         } break;
 
         case LYIR_IR_ICMP_EQ: {
-            lca_string_append_format(print_context->output, "%sicmp eq ", COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, "icmp eq ");
             lyir_value_print_to_string(instruction->binary.lhs, print_context->output, true, use_color);
-            lca_string_append_format(print_context->output, "%s, ", COL(RESET));
+            lca_string_append_cstring(print_context->output, COL(RESET));
+            lca_string_append_cstring(print_context->output, ", ");
             lyir_value_print_to_string(instruction->binary.rhs, print_context->output, false, use_color);
         } break;
 
         case LYIR_IR_ICMP_NE: {
-            lca_string_append_format(print_context->output, "%sicmp ne ", COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, "icmp ne ");
             lyir_value_print_to_string(instruction->binary.lhs, print_context->output, true, use_color);
-            lca_string_append_format(print_context->output, "%s, ", COL(RESET));
+            lca_string_append_cstring(print_context->output, COL(RESET));
+            lca_string_append_cstring(print_context->output, ", ");
             lyir_value_print_to_string(instruction->binary.rhs, print_context->output, false, use_color);
         } break;
 
         case LYIR_IR_ICMP_SLT: {
-            lca_string_append_format(print_context->output, "%sicmp slt ", COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, "icmp slt ");
             lyir_value_print_to_string(instruction->binary.lhs, print_context->output, true, use_color);
-            lca_string_append_format(print_context->output, "%s, ", COL(RESET));
+            lca_string_append_cstring(print_context->output, COL(RESET));
+            lca_string_append_cstring(print_context->output, ", ");
             lyir_value_print_to_string(instruction->binary.rhs, print_context->output, false, use_color);
         } break;
 
         case LYIR_IR_ICMP_ULT: {
-            lca_string_append_format(print_context->output, "%sicmp ult ", COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, "icmp ult ");
             lyir_value_print_to_string(instruction->binary.lhs, print_context->output, true, use_color);
-            lca_string_append_format(print_context->output, "%s, ", COL(RESET));
+            lca_string_append_cstring(print_context->output, COL(RESET));
+            lca_string_append_cstring(print_context->output, ", ");
             lyir_value_print_to_string(instruction->binary.rhs, print_context->output, false, use_color);
         } break;
 
         case LYIR_IR_ICMP_SLE: {
-            lca_string_append_format(print_context->output, "%sicmp sle ", COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, "icmp sle ");
             lyir_value_print_to_string(instruction->binary.lhs, print_context->output, true, use_color);
-            lca_string_append_format(print_context->output, "%s, ", COL(RESET));
+            lca_string_append_cstring(print_context->output, COL(RESET));
+            lca_string_append_cstring(print_context->output, ", ");
             lyir_value_print_to_string(instruction->binary.rhs, print_context->output, false, use_color);
         } break;
 
         case LYIR_IR_ICMP_ULE: {
-            lca_string_append_format(print_context->output, "%sicmp ule ", COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, "icmp ule ");
             lyir_value_print_to_string(instruction->binary.lhs, print_context->output, true, use_color);
-            lca_string_append_format(print_context->output, "%s, ", COL(RESET));
+            lca_string_append_cstring(print_context->output, COL(RESET));
+            lca_string_append_cstring(print_context->output, ", ");
             lyir_value_print_to_string(instruction->binary.rhs, print_context->output, false, use_color);
         } break;
 
         case LYIR_IR_ICMP_SGT: {
-            lca_string_append_format(print_context->output, "%sicmp sgt ", COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, "icmp sgt ");
             lyir_value_print_to_string(instruction->binary.lhs, print_context->output, true, use_color);
-            lca_string_append_format(print_context->output, "%s, ", COL(RESET));
+            lca_string_append_cstring(print_context->output, COL(RESET));
+            lca_string_append_cstring(print_context->output, ", ");
             lyir_value_print_to_string(instruction->binary.rhs, print_context->output, false, use_color);
         } break;
 
         case LYIR_IR_ICMP_UGT: {
-            lca_string_append_format(print_context->output, "%sicmp ugt ", COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, "icmp ugt ");
             lyir_value_print_to_string(instruction->binary.lhs, print_context->output, true, use_color);
-            lca_string_append_format(print_context->output, "%s, ", COL(RESET));
+            lca_string_append_cstring(print_context->output, COL(RESET));
+            lca_string_append_cstring(print_context->output, ", ");
             lyir_value_print_to_string(instruction->binary.rhs, print_context->output, false, use_color);
         } break;
 
         case LYIR_IR_ICMP_SGE: {
-            lca_string_append_format(print_context->output, "%sicmp sge ", COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, "icmp sge ");
             lyir_value_print_to_string(instruction->binary.lhs, print_context->output, true, use_color);
-            lca_string_append_format(print_context->output, "%s, ", COL(RESET));
+            lca_string_append_cstring(print_context->output, COL(RESET));
+            lca_string_append_cstring(print_context->output, ", ");
             lyir_value_print_to_string(instruction->binary.rhs, print_context->output, false, use_color);
         } break;
 
         case LYIR_IR_ICMP_UGE: {
-            lca_string_append_format(print_context->output, "%sicmp uge ", COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, "icmp uge ");
             lyir_value_print_to_string(instruction->binary.lhs, print_context->output, true, use_color);
-            lca_string_append_format(print_context->output, "%s, ", COL(RESET));
+            lca_string_append_cstring(print_context->output, COL(RESET));
+            lca_string_append_cstring(print_context->output, ", ");
             lyir_value_print_to_string(instruction->binary.rhs, print_context->output, false, use_color);
         } break;
 
         case LYIR_IR_FCMP_FALSE: {
-            lca_string_append_format(print_context->output, "%sfcmp false ", COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, "fcmp false ");
             lyir_value_print_to_string(instruction->binary.lhs, print_context->output, true, use_color);
-            lca_string_append_format(print_context->output, "%s, ", COL(RESET));
+            lca_string_append_cstring(print_context->output, COL(RESET));
+            lca_string_append_cstring(print_context->output, ", ");
             lyir_value_print_to_string(instruction->binary.rhs, print_context->output, false, use_color);
         } break;
 
         case LYIR_IR_FCMP_OEQ: {
-            lca_string_append_format(print_context->output, "%sfcmp oeq ", COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, "fcmp oeq ");
             lyir_value_print_to_string(instruction->binary.lhs, print_context->output, true, use_color);
-            lca_string_append_format(print_context->output, "%s, ", COL(RESET));
+            lca_string_append_cstring(print_context->output, COL(RESET));
+            lca_string_append_cstring(print_context->output, ", ");
             lyir_value_print_to_string(instruction->binary.rhs, print_context->output, false, use_color);
         } break;
 
         case LYIR_IR_FCMP_OGT: {
-            lca_string_append_format(print_context->output, "%sfcmp ogt ", COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, "fcmp ogt ");
             lyir_value_print_to_string(instruction->binary.lhs, print_context->output, true, use_color);
-            lca_string_append_format(print_context->output, "%s, ", COL(RESET));
+            lca_string_append_cstring(print_context->output, COL(RESET));
+            lca_string_append_cstring(print_context->output, ", ");
             lyir_value_print_to_string(instruction->binary.rhs, print_context->output, false, use_color);
         } break;
 
         case LYIR_IR_FCMP_OGE: {
-            lca_string_append_format(print_context->output, "%sfcmp oge ", COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, "fcmp oge ");
             lyir_value_print_to_string(instruction->binary.lhs, print_context->output, true, use_color);
-            lca_string_append_format(print_context->output, "%s, ", COL(RESET));
+            lca_string_append_cstring(print_context->output, COL(RESET));
+            lca_string_append_cstring(print_context->output, ", ");
             lyir_value_print_to_string(instruction->binary.rhs, print_context->output, false, use_color);
         } break;
 
         case LYIR_IR_FCMP_OLT: {
-            lca_string_append_format(print_context->output, "%sfcmp olt ", COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, "fcmp olt ");
             lyir_value_print_to_string(instruction->binary.lhs, print_context->output, true, use_color);
-            lca_string_append_format(print_context->output, "%s, ", COL(RESET));
+            lca_string_append_cstring(print_context->output, COL(RESET));
+            lca_string_append_cstring(print_context->output, ", ");
             lyir_value_print_to_string(instruction->binary.rhs, print_context->output, false, use_color);
         } break;
 
         case LYIR_IR_FCMP_OLE: {
-            lca_string_append_format(print_context->output, "%sfcmp ole ", COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, "fcmp ole ");
             lyir_value_print_to_string(instruction->binary.lhs, print_context->output, true, use_color);
-            lca_string_append_format(print_context->output, "%s, ", COL(RESET));
+            lca_string_append_cstring(print_context->output, COL(RESET));
+            lca_string_append_cstring(print_context->output, ", ");
             lyir_value_print_to_string(instruction->binary.rhs, print_context->output, false, use_color);
         } break;
 
         case LYIR_IR_FCMP_ONE: {
-            lca_string_append_format(print_context->output, "%sfcmp one ", COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, "fcmp one ");
             lyir_value_print_to_string(instruction->binary.lhs, print_context->output, true, use_color);
-            lca_string_append_format(print_context->output, "%s, ", COL(RESET));
+            lca_string_append_cstring(print_context->output, COL(RESET));
+            lca_string_append_cstring(print_context->output, ", ");
             lyir_value_print_to_string(instruction->binary.rhs, print_context->output, false, use_color);
         } break;
 
         case LYIR_IR_FCMP_ORD: {
-            lca_string_append_format(print_context->output, "%sfcmp ord ", COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, "fcmp ord ");
             lyir_value_print_to_string(instruction->binary.lhs, print_context->output, true, use_color);
-            lca_string_append_format(print_context->output, "%s, ", COL(RESET));
+            lca_string_append_cstring(print_context->output, COL(RESET));
+            lca_string_append_cstring(print_context->output, ", ");
             lyir_value_print_to_string(instruction->binary.rhs, print_context->output, false, use_color);
         } break;
 
         case LYIR_IR_FCMP_UEQ: {
-            lca_string_append_format(print_context->output, "%sfcmp ueq ", COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, "fcmp ueq ");
             lyir_value_print_to_string(instruction->binary.lhs, print_context->output, true, use_color);
-            lca_string_append_format(print_context->output, "%s, ", COL(RESET));
+            lca_string_append_cstring(print_context->output, COL(RESET));
+            lca_string_append_cstring(print_context->output, ", ");
             lyir_value_print_to_string(instruction->binary.rhs, print_context->output, false, use_color);
         } break;
 
         case LYIR_IR_FCMP_UGT: {
-            lca_string_append_format(print_context->output, "%sfcmp ugt ", COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, "fcmp ugt ");
             lyir_value_print_to_string(instruction->binary.lhs, print_context->output, true, use_color);
-            lca_string_append_format(print_context->output, "%s, ", COL(RESET));
+            lca_string_append_cstring(print_context->output, COL(RESET));
+            lca_string_append_cstring(print_context->output, ", ");
             lyir_value_print_to_string(instruction->binary.rhs, print_context->output, false, use_color);
         } break;
 
         case LYIR_IR_FCMP_UGE: {
-            lca_string_append_format(print_context->output, "%sfcmp uge ", COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, "fcmp uge ");
             lyir_value_print_to_string(instruction->binary.lhs, print_context->output, true, use_color);
-            lca_string_append_format(print_context->output, "%s, ", COL(RESET));
+            lca_string_append_cstring(print_context->output, COL(RESET));
+            lca_string_append_cstring(print_context->output, ", ");
             lyir_value_print_to_string(instruction->binary.rhs, print_context->output, false, use_color);
         } break;
 
         case LYIR_IR_FCMP_ULT: {
-            lca_string_append_format(print_context->output, "%sfcmp ult ", COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, "fcmp ult ");
             lyir_value_print_to_string(instruction->binary.lhs, print_context->output, true, use_color);
-            lca_string_append_format(print_context->output, "%s, ", COL(RESET));
+            lca_string_append_cstring(print_context->output, COL(RESET));
+            lca_string_append_cstring(print_context->output, ", ");
             lyir_value_print_to_string(instruction->binary.rhs, print_context->output, false, use_color);
         } break;
 
         case LYIR_IR_FCMP_ULE: {
-            lca_string_append_format(print_context->output, "%sfcmp ule ", COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, "fcmp ule ");
             lyir_value_print_to_string(instruction->binary.lhs, print_context->output, true, use_color);
-            lca_string_append_format(print_context->output, "%s, ", COL(RESET));
+            lca_string_append_cstring(print_context->output, COL(RESET));
+            lca_string_append_cstring(print_context->output, ", ");
             lyir_value_print_to_string(instruction->binary.rhs, print_context->output, false, use_color);
         } break;
 
         case LYIR_IR_FCMP_UNE: {
-            lca_string_append_format(print_context->output, "%sfcmp une ", COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, "fcmp une ");
             lyir_value_print_to_string(instruction->binary.lhs, print_context->output, true, use_color);
-            lca_string_append_format(print_context->output, "%s, ", COL(RESET));
+            lca_string_append_cstring(print_context->output, COL(RESET));
+            lca_string_append_cstring(print_context->output, ", ");
             lyir_value_print_to_string(instruction->binary.rhs, print_context->output, false, use_color);
         } break;
 
         case LYIR_IR_FCMP_UNO: {
-            lca_string_append_format(print_context->output, "%sfcmp uno ", COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, "fcmp uno ");
             lyir_value_print_to_string(instruction->binary.lhs, print_context->output, true, use_color);
-            lca_string_append_format(print_context->output, "%s, ", COL(RESET));
+            lca_string_append_cstring(print_context->output, COL(RESET));
+            lca_string_append_cstring(print_context->output, ", ");
             lyir_value_print_to_string(instruction->binary.rhs, print_context->output, false, use_color);
         } break;
 
         case LYIR_IR_FCMP_TRUE: {
-            lca_string_append_format(print_context->output, "%sfcmp true ", COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, "fcmp true ");
             lyir_value_print_to_string(instruction->binary.lhs, print_context->output, true, use_color);
-            lca_string_append_format(print_context->output, "%s, ", COL(RESET));
+            lca_string_append_cstring(print_context->output, COL(RESET));
+            lca_string_append_cstring(print_context->output, ", ");
             lyir_value_print_to_string(instruction->binary.rhs, print_context->output, false, use_color);
         } break;
 
         case LYIR_IR_PTRADD: {
-            lca_string_append_format(print_context->output, "%sptradd ptr ", COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, "ptradd ptr ");
             lyir_value_print_to_string(instruction->address, print_context->output, false, use_color);
-            lca_string_append_format(print_context->output, "%s, ", COL(RESET));
+            lca_string_append_cstring(print_context->output, COL(RESET));
+            lca_string_append_cstring(print_context->output, ", ");
             lyir_value_print_to_string(instruction->operand, print_context->output, true, use_color);
         } break;
     }
 
-    lca_string_append_format(print_context->output, "%s\n", COL(RESET));
+    lca_string_append_cstring(print_context->output, COL(RESET));
+    lca_string_append_char(print_context->output, '\n');
 }
 
 static void layec_print_linkage(layec_print_context* print_context, lyir_linkage linkage) {
@@ -2598,11 +3487,13 @@ static void layec_print_linkage(layec_print_context* print_context, lyir_linkage
         default: break;
 
         case LYIR_LINK_EXPORTED: {
-            lca_string_append_format(print_context->output, "%sexported ", COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, "exported ");
         } break;
 
         case LYIR_LINK_REEXPORTED: {
-            lca_string_append_format(print_context->output, "%sreexported ", COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, COL(COL_KEYWORD));
+            lca_string_append_cstring(print_context->output, "reexported ");
         } break;
     }
 }
@@ -2618,19 +3509,26 @@ static void layec_global_print(layec_print_context* print_context, lyir_value* g
 
     bool use_color = print_context->use_color;
 
-    lca_string_append_format(print_context->output, "%sdefine ", COL(COL_KEYWORD));
+    lca_string_append_cstring(print_context->output, COL(COL_KEYWORD));
+    lca_string_append_cstring(print_context->output, "define ");
     layec_print_linkage(print_context, global->linkage);
 
     if (global->name.count == 0) {
-        lca_string_append_format(print_context->output, "%sglobal.%lld", COL(COL_NAME), global->index);
+        lca_string_append_cstring(print_context->output, COL(COL_NAME));
+        lca_string_append_cstring(print_context->output, "global.");
+        lca_string_append_int(print_context->output, global->index);
     } else {
-        lca_string_append_format(print_context->output, "%s%.*s", COL(COL_NAME), LCA_STR_EXPAND(global->name));
+        lca_string_append_cstring(print_context->output, COL(COL_NAME));
+        lca_string_append_view(print_context->output, global->name);
     }
 
-    lca_string_append_format(print_context->output, " %s= ", COL(COL_DELIM));
+    lca_string_append_char(print_context->output, ' ');
+    lca_string_append_cstring(print_context->output, COL(COL_DELIM));
+    lca_string_append_cstring(print_context->output, "= ");
     lyir_value_print_to_string(global->operand, print_context->output, true, use_color);
 
-    lca_string_append_format(print_context->output, "%s\n", COL(RESET));
+    lca_string_append_cstring(print_context->output, COL(RESET));
+    lca_string_append_char(print_context->output, '\n');
 }
 
 static void layec_function_print(layec_print_context* print_context, lyir_value* function) {
@@ -2650,42 +3548,51 @@ static void layec_function_print(layec_print_context* print_context, lyir_value*
     bool use_color = print_context->use_color;
     bool is_declare = lca_da_count(function->function.blocks) == 0;
 
-    lca_string_append_format(print_context->output, "%s%s ", COL(COL_KEYWORD), is_declare ? "declare" : "define");
+    lca_string_append_cstring(print_context->output, COL(COL_KEYWORD));
+    lca_string_append_cstring(print_context->output, is_declare ? "declare" : "define");
+    lca_string_append_char(print_context->output, ' ');
     layec_print_linkage(print_context, function->linkage);
 
-    lca_string_append_format(
-        print_context->output,
-        "%s %s%.*s%s(",
-        ir_calling_convention_to_cstring(function->type->function.calling_convention),
-        COL(COL_NAME),
-        LCA_STR_EXPAND(function->function.name),
-        COL(COL_DELIM)
-    );
+    lca_string_append_cstring(print_context->output, ir_calling_convention_to_cstring(function->type->function.calling_convention));
+    lca_string_append_char(print_context->output, ' ');
+    lca_string_append_cstring(print_context->output, COL(COL_NAME));
+    lca_string_append_view(print_context->output, function->function.name);
+    lca_string_append_cstring(print_context->output, COL(COL_DELIM));
+    lca_string_append_char(print_context->output, '(');
 
     for (int64_t i = 0, count = lca_da_count(parameter_types); i < count; i++) {
-        if (i > 0) lca_string_append_format(print_context->output, "%s, ", COL(COL_DELIM));
+        if (i > 0) {
+            lca_string_append_cstring(print_context->output, COL(COL_DELIM));
+            lca_string_append_cstring(print_context->output, ", ");
+        }
+
         lyir_type_print_to_string(parameter_types[i], print_context->output, use_color);
-        lca_string_append_format(print_context->output, " %s%%%lld", COL(COL_NAME), i);
+        lca_string_append_char(print_context->output, ' ');
+        lca_string_append_cstring(print_context->output, COL(COL_NAME));
+        lca_string_append_char(print_context->output, '%');
+        lca_string_append_int(print_context->output, i);
     }
 
-    lca_string_append_format(print_context->output, "%s)", COL(COL_DELIM));
+    lca_string_append_cstring(print_context->output, COL(COL_DELIM));
+    lca_string_append_char(print_context->output, ')');
 
     if (function_type->function.is_variadic) {
-        lca_string_append_format(print_context->output, " %svariadic", COL(COL_KEYWORD));
+        lca_string_append_char(print_context->output, ' ');
+        lca_string_append_cstring(print_context->output, COL(COL_KEYWORD));
+        lca_string_append_cstring(print_context->output, "variadic");
     }
 
     if (!lyir_type_is_void(return_type)) {
-        lca_string_append_format(print_context->output, " %s-> ", COL(COL_DELIM));
+        lca_string_append_char(print_context->output, ' ');
+        lca_string_append_cstring(print_context->output, COL(COL_DELIM));
+        lca_string_append_cstring(print_context->output, "-> ");
         lyir_type_print_to_string(return_type, print_context->output, use_color);
     }
 
-    lca_string_append_format(
-        print_context->output,
-        "%s%s%s\n",
-        COL(COL_DELIM),
-        is_declare ? "" : " {",
-        COL(RESET)
-    );
+    lca_string_append_cstring(print_context->output, COL(COL_DELIM));
+    if (!is_declare) lca_string_append_cstring(print_context->output, " {");
+    lca_string_append_cstring(print_context->output, COL(RESET));
+    lca_string_append_char(print_context->output, '\n');
 
     if (!is_declare) {
         for (int64_t i = 0, count = lca_da_count(function->function.blocks); i < count; i++) {
@@ -2694,39 +3601,52 @@ static void layec_function_print(layec_print_context* print_context, lyir_value*
             assert(lyir_value_is_block(block));
 
             if (block->block.name.count == 0) {
-                lca_string_append_format(print_context->output, "%s_bb%lld%s:\n", COL(COL_NAME), i, COL(COL_DELIM));
+                lca_string_append_cstring(print_context->output, COL(COL_NAME));
+                lca_string_append_cstring(print_context->output, "_bb");
+                lca_string_append_int(print_context->output, i);
+                lca_string_append_cstring(print_context->output, COL(COL_DELIM));
+                lca_string_append_cstring(print_context->output, ":\n");
             } else {
-                lca_string_append_format(print_context->output, "%s%.*s%s:\n", COL(COL_NAME), LCA_STR_EXPAND(block->block.name), COL(COL_DELIM));
+                lca_string_append_cstring(print_context->output, COL(COL_NAME));
+                lca_string_append_view(print_context->output, block->block.name);
+                lca_string_append_cstring(print_context->output, COL(COL_DELIM));
+                lca_string_append_cstring(print_context->output, ":\n");
             }
 
-            for (int64_t j = 0, count2 = lca_da_count(block->block.instructions); j < count2; j++) {
-                lyir_value* instruction = block->block.instructions[j];
-                assert(instruction != NULL);
+            for (lyir_value* instruction = block->block.first_instruction; instruction != NULL; instruction = instruction->next_instruction) {
                 assert(lyir_value_is_instruction(instruction));
 
                 layec_instruction_print(print_context, instruction);
             }
         }
 
-        lca_string_append_format(print_context->output, "%s}%s\n", COL(COL_DELIM), COL(RESET));
+        lca_string_append_cstring(print_context->output, COL(COL_DELIM));
+        lca_string_append_char(print_context->output, '}');
+        lca_string_append_cstring(print_context->output, COL(RESET));
+        lca_string_append_char(print_context->output, '\n');
     }
 }
 
 static void layec_type_print_struct_type_to_string_literally(lyir_type* type, lca_string* s, bool use_color) {
-    lca_string_append_format(s, "%sstruct %s{", COL(COL_KEYWORD), COL(RESET));
+    lca_string_append_cstring(s, COL(COL_KEYWORD));
+    lca_string_append_cstring(s, "struct ");
+    lca_string_append_cstring(s, COL(RESET));
+    lca_string_append_char(s, '{');
 
     for (int64_t i = 0, count = lca_da_count(type->_struct.members); i < count; i++) {
         if (i > 0) {
-            lca_string_append_format(s, "%s, ", COL(RESET));
+            lca_string_append_cstring(s, COL(RESET));
+            lca_string_append_cstring(s, ", ");
         } else {
-            lca_string_append_format(s, " ");
+            lca_string_append_char(s, ' ');
         }
 
         lyir_type* member_type = type->_struct.members[i].type;
         lyir_type_print_to_string(member_type, s, use_color);
     }
 
-    lca_string_append_format(s, "%s }", COL(RESET));
+    lca_string_append_cstring(s, COL(RESET));
+    lca_string_append_cstring(s, " }");
 }
 
 void lyir_type_print_to_string(lyir_type* type, lca_string* s, bool use_color) {
@@ -2740,36 +3660,49 @@ void lyir_type_print_to_string(lyir_type* type, lca_string* s, bool use_color) {
         } break;
 
         case LYIR_TYPE_POINTER: {
-            lca_string_append_format(s, "%sptr", COL(COL_KEYWORD));
+            lca_string_append_cstring(s, COL(COL_KEYWORD));
+            lca_string_append_cstring(s, "ptr");
         } break;
 
         case LYIR_TYPE_VOID: {
-            lca_string_append_format(s, "%svoid", COL(COL_KEYWORD));
+            lca_string_append_cstring(s, COL(COL_KEYWORD));
+            lca_string_append_cstring(s, "void");
         } break;
 
         case LYIR_TYPE_INTEGER: {
-            lca_string_append_format(s, "%sint%d", COL(COL_KEYWORD), type->primitive_bit_width);
+            lca_string_append_cstring(s, COL(COL_KEYWORD));
+            lca_string_append_cstring(s, "int");
+            lca_string_append_int(s, type->primitive_bit_width);
         } break;
 
         case LYIR_TYPE_FLOAT: {
-            lca_string_append_format(s, "%sfloat%d", COL(COL_KEYWORD), type->primitive_bit_width);
+            lca_string_append_cstring(s, COL(COL_KEYWORD));
+            lca_string_append_cstring(s, "float");
+            lca_string_append_int(s, type->primitive_bit_width);
         } break;
 
         case LYIR_TYPE_ARRAY: {
             lyir_type_print_to_string(type->array.element_type, s, use_color);
-            lca_string_append_format(s, "%s[%s%lld%s]", COL(COL_DELIM), COL(COL_CONSTANT), type->array.length, COL(COL_DELIM));
+            lca_string_append_cstring(s, COL(COL_DELIM));
+            lca_string_append_char(s, '[');
+            lca_string_append_cstring(s, COL(COL_CONSTANT));
+            lca_string_append_int(s, type->array.length);
+            lca_string_append_cstring(s, COL(COL_DELIM));
+            lca_string_append_char(s, ']');
         } break;
 
         case LYIR_TYPE_STRUCT: {
             if (type->_struct.named) {
-                lca_string_append_format(s, "%s@%.*s", COL(COL_NAME), LCA_STR_EXPAND(type->_struct.name));
+                lca_string_append_cstring(s, COL(COL_NAME));
+                lca_string_append_char(s, '@');
+                lca_string_append_view(s, type->_struct.name);
             } else {
                 layec_type_print_struct_type_to_string_literally(type, s, use_color);
             }
         } break;
     }
 
-    lca_string_append_format(s, "%s", COL(RESET));
+    lca_string_append_cstring(s, COL(RESET));
 }
 
 void lyir_value_print_to_string(lyir_value* value, lca_string* s, bool print_type, bool use_color) {
@@ -2778,63 +3711,82 @@ void lyir_value_print_to_string(lyir_value* value, lca_string* s, bool print_typ
 
     if (print_type) {
         lyir_type_print_to_string(value->type, s, use_color);
-        lca_string_append_format(s, "%s ", COL(RESET));
+        lca_string_append_cstring(s, COL(RESET));
+        lca_string_append_char(s, ' ');
     }
 
     switch (value->kind) {
         default: {
             if (value->name.count == 0) {
-                lca_string_append_format(s, "%s%%%lld", COL(COL_NAME), value->index);
+                lca_string_append_cstring(s, COL(COL_NAME));
+                lca_string_append_char(s, '%');
+                lca_string_append_int(s, lyir_value_index_get(value));
             } else {
-                lca_string_append_format(s, "%s%%%.*s", COL(COL_NAME), LCA_STR_EXPAND(value->name));
+                lca_string_append_cstring(s, COL(COL_NAME));
+                lca_string_append_char(s, '%');
+                lca_string_append_view(s, value->name);
             }
         } break;
 
         case LYIR_IR_FUNCTION: {
-            lca_string_append_format(s, "%s@%.*s", COL(COL_NAME), LCA_STR_EXPAND(value->function.name));
+            lca_string_append_cstring(s, COL(COL_NAME));
+            lca_string_append_char(s, '@');
+            lca_string_append_view(s, value->function.name);
         } break;
 
         case LYIR_IR_BLOCK: {
             if (value->block.name.count == 0) {
-                lca_string_append_format(s, "%s%%_bb%lld", COL(COL_NAME), value->block.index);
+                lca_string_append_cstring(s, COL(COL_NAME));
+                lca_string_append_cstring(s, "%_bb");
+                lca_string_append_int(s, value->block.index);
             } else {
-                lca_string_append_format(s, "%s%%%.*s", COL(COL_NAME), LCA_STR_EXPAND(value->block.name));
+                lca_string_append_cstring(s, COL(COL_NAME));
+                lca_string_append_char(s, '%');
+                lca_string_append_view(s, value->block.name);
             }
         } break;
 
         case LYIR_IR_INTEGER_CONSTANT: {
-            lca_string_append_format(s, "%s%lld", COL(COL_CONSTANT), value->int_value);
+            lca_string_append_cstring(s, COL(COL_CONSTANT));
+            lca_string_append_int(s, value->int_value);
         } break;
 
         case LYIR_IR_FLOAT_CONSTANT: {
-            lca_string_append_format(s, "%s%f", COL(COL_CONSTANT), value->float_value);
+            lca_string_append_cstring(s, COL(COL_CONSTANT));
+            lca_string_append_double(s, value->float_value);
         } break;
 
         case LYIR_IR_GLOBAL_VARIABLE: {
             if (value->name.count == 0) {
-                lca_string_append_format(s, "%s@global.%lld", COL(COL_NAME), value->index);
+                lca_string_append_cstring(s, COL(COL_NAME));
+                lca_string_append_cstring(s, "@global.");
+                lca_string_append_int(s, value->index);
             } else {
-                lca_string_append_format(s, "%s@%.*s", COL(COL_NAME), LCA_STR_EXPAND(value->name));
+                lca_string_append_cstring(s, COL(COL_NAME));
+                lca_string_append_char(s, '@');
+                lca_string_append_view(s, value->name);
             }
         } break;
 
         case LYIR_IR_ARRAY_CONSTANT: {
             if (value->array.is_string_literal) {
-                lca_string_append_format(s, "%s\"", COL(COL_CONSTANT));
+                lca_string_append_cstring(s, COL(COL_CONSTANT));
+                lca_string_append_char(s, '"');
                 for (int64_t i = 0; i < value->array.length; i++) {
                     uint8_t c = (uint8_t)value->array.data[i];
                     if (c < 32 || c > 127) {
-                        lca_string_append_format(s, "\\%02X", (int)c);
+                        lca_string_append_char(s, '\\');
+                        lca_string_append_hex(s, c, 2);
                     } else {
-                        lca_string_append_format(s, "%c", c);
+                        lca_string_append_char(s, c);
                     }
                 }
-                lca_string_append_format(s, "\"");
+                lca_string_append_char(s, '"');
             } else {
                 assert(false && "todo lyir_value_print_to_string non-string arrays");
             }
         } break;
     }
 
-    lca_string_append_format(s, "%s", COL(RESET));
+    lca_string_append_cstring(s, COL(RESET));
 }
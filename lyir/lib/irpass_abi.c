@@ -312,9 +312,10 @@ static void layec_abi_transform_callsites(lyir_module* module, lyir_value* funct
         assert(block != NULL);
         assert(lyir_value_is_block(block));
 
-        for (int64_t i = 0; i < lyir_value_block_instruction_count_get(block); i++) {
-            lyir_value* inst = lyir_value_block_instruction_get_at_index(block, i);
-            assert(inst != NULL);
+        // transforming a call only inserts instructions before it, so grab the next one up front.
+        lyir_value* next_inst = NULL;
+        for (lyir_value* inst = lyir_value_block_first_instruction_get(block); inst != NULL; inst = next_inst) {
+            next_inst = lyir_value_instruction_next_get(inst);
 
             switch (lyir_value_kind_get(inst)) {
                 default: break;
@@ -90,141 +90,151 @@ static void llvm_print_module(llvm_codegen* codegen, lyir_module* module) {
     llvm_print_header(codegen, module);
 
     for (int64_t i = 0, count = lyir_module_global_count(module); i < count; i++) {
-        if (i > 0) lca_string_append_format(codegen->output, "\n");
+        if (i > 0) lca_string_append_char(codegen->output, '\n');
         lyir_value* global = lyir_module_get_global_at_index(module, i);
         llvm_print_global(codegen, global);
     }
 
-    if (lyir_module_global_count(module) > 0) lca_string_append_format(codegen->output, "\n");
+    if (lyir_module_global_count(module) > 0) lca_string_append_char(codegen->output, '\n');
 
     for (int64_t i = 0, count = lyir_module_function_count(module); i < count; i++) {
-        if (i > 0) lca_string_append_format(codegen->output,  "\n");
+        if (i > 0) lca_string_append_char(codegen->output, '\n');
         lyir_value* function = lyir_module_get_function_at_index(module, i);
+        lca_arena_mark temp_mark = lca_temp_mark();
         llvm_print_function(codegen, function);
+        lca_temp_restore(temp_mark);
     }
 }
 
 static void llvm_print_header(llvm_codegen* codegen, lyir_module* module) {
-    lca_string_append_format(codegen->output, "; ModuleID = '%.*s'\n", LCA_STR_EXPAND(lyir_module_name(module)));
-    lca_string_append_format(codegen->output, "source_filename = \"%.*s\"\n", LCA_STR_EXPAND(lyir_module_name(module)));
-    lca_string_append_format(codegen->output, "\n");
+    lca_string_append_cstring(codegen->output, "; ModuleID = '");
+    lca_string_append_view(codegen->output, lyir_module_name(module));
+    lca_string_append_cstring(codegen->output, "'\n");
+    lca_string_append_cstring(codegen->output, "source_filename = \"");
+    lca_string_append_view(codegen->output, lyir_module_name(module));
+    lca_string_append_cstring(codegen->output, "\"\n");
+    lca_string_append_char(codegen->output, '\n');
 
     for (int64_t i = 0; i < lyir_context_get_struct_type_count(codegen->context); i++) {
         lyir_type* struct_type = lyir_context_get_struct_type_at_index(codegen->context, i);
         if (lyir_type_struct_is_named(struct_type)) {
-            lca_string_append_format(codegen->output, "%%%.*s = ", LCA_STR_EXPAND(lyir_type_struct_name_get(struct_type)));
+            lca_string_append_char(codegen->output, '%');
+            lca_string_append_view(codegen->output, lyir_type_struct_name_get(struct_type));
+            lca_string_append_cstring(codegen->output, " = ");
             llvm_print_type_struct_literally(codegen, struct_type);
-            lca_string_append_format(codegen->output, "\n");
+            lca_string_append_char(codegen->output, '\n');
         }
     }
 
     //lca_string_append_format(codegen->output, "declare void @%s(ptr, i8, i64, i1 immarg)\n", LLVM_MEMCPY_INTRINSIC);
-    //lca_string_append_format(codegen->output, "\n");
+    //lca_string_append_char(codegen->output, '\n');
 
-    lca_string_append_format(codegen->output, "declare void @%s(ptr, i8, i64, i1 immarg)\n", LLVM_MEMSET_INTRINSIC);
-    lca_string_append_format(codegen->output, "\n");
+    lca_string_append_cstring(codegen->output, "declare void @");
+    lca_string_append_cstring(codegen->output, LLVM_MEMSET_INTRINSIC);
+    lca_string_append_cstring(codegen->output, "(ptr, i8, i64, i1 immarg)\n");
+    lca_string_append_char(codegen->output, '\n');
 }
 
 static void llvm_print_global(llvm_codegen* codegen, lyir_value* global) {
     lca_string_view name = lyir_value_name_get(global);
     if (name.count == 0) {
         int64_t index = lyir_value_index_get(global);
-        lca_string_append_format(codegen->output, "@.global.%lld", index);
+        lca_string_append_cstring(codegen->output, "@.global.");
+        lca_string_append_int(codegen->output, index);
     } else {
-        lca_string_append_format(codegen->output, "@%.*s", LCA_STR_EXPAND(name));
+        lca_string_append_char(codegen->output, '@');
+        lca_string_append_view(codegen->output, name);
     }
 
     lyir_linkage linkage = lyir_value_linkage_get(global);
-    lca_string_append_format(codegen->output, " = %s", linkage == LYIR_LINK_IMPORTED ? "external" : "private");
+    lca_string_append_cstring(codegen->output, " = ");
+    lca_string_append_cstring(codegen->output, linkage == LYIR_LINK_IMPORTED ? "external" : "private");
 
     bool is_string = lyir_value_global_is_string(global);
 
     if (is_string) {
-        lca_string_append_format(codegen->output, " unnamed_addr constant");
+        lca_string_append_cstring(codegen->output, " unnamed_addr constant");
     } else {
-        lca_string_append_format(codegen->output, " global");
+        lca_string_append_cstring(codegen->output, " global");
     }
 
-    lca_string_append_format(codegen->output, " ");
+    lca_string_append_char(codegen->output, ' ');
     llvm_print_type(codegen, lyir_value_alloca_type_get(global));
 
     lyir_value* value = lyir_value_operand_get(global);
     if (value == NULL) {
-        lca_string_append_format(codegen->output, " zeroinitializer");
+        lca_string_append_cstring(codegen->output, " zeroinitializer");
     } else {
-        lca_string_append_format(codegen->output, " ");
+        lca_string_append_char(codegen->output, ' ');
         llvm_print_value(codegen, value, false);
     }
 
-    lca_string_append_format(codegen->output, ", align %d\n", lyir_type_align_in_bytes(lyir_value_type_get(global)));
+    lca_string_append_cstring(codegen->output, ", align ");
+    lca_string_append_int(codegen->output, lyir_type_align_in_bytes(lyir_value_type_get(global)));
+    lca_string_append_char(codegen->output, '\n');
 }
 
 static void llvm_print_function(llvm_codegen* codegen, lyir_value* function) {
     int64_t block_count = lyir_value_function_block_count_get(function);
 
-    lca_string_append_format(
-        codegen->output,
-        "%s ",
-        (block_count == 0 ? "declare" : "define")
-    );
+    lca_string_append_cstring(codegen->output, block_count == 0 ? "declare " : "define ");
 
     llvm_print_type(codegen, lyir_value_function_return_type_get(function));
 
-    lca_string_append_format(
-        codegen->output,
-        " @%.*s(",
-        LCA_STR_EXPAND(lyir_value_function_name_get(function))
-    );
+    lca_string_append_cstring(codegen->output, " @");
+    lca_string_append_view(codegen->output, lyir_value_function_name_get(function));
+    lca_string_append_char(codegen->output, '(');
 
     lyir_type* function_type = lyir_value_type_get(function);
     assert(lyir_type_is_function(function_type));
     for (int64_t i = 0, count = lyir_function_type_parameter_count_get(function_type); i < count; i++) {
         if (i > 0) {
-            lca_string_append_format(codegen->output, ", ");
+            lca_string_append_cstring(codegen->output, ", ");
         }
 
         lyir_type* parameter_type = lyir_function_type_parameter_type_get_at_index(function_type, i);
         llvm_print_type(codegen, parameter_type);
-        lca_string_append_format(codegen->output, " %%%lld", i);
+        lca_string_append_cstring(codegen->output, " %");
+        lca_string_append_int(codegen->output, i);
     }
 
     if (lyir_function_type_is_variadic(function_type)) {
         if (lyir_function_type_parameter_count_get(function_type) != 0) {
-            lca_string_append_format(codegen->output, ", ");
+            lca_string_append_cstring(codegen->output, ", ");
         }
 
-        lca_string_append_format(codegen->output, "...");
+        lca_string_append_cstring(codegen->output, "...");
     }
 
-    lca_string_append_format(codegen->output, ")");
+    lca_string_append_char(codegen->output, ')');
 
     if (block_count == 0) {
-        lca_string_append_format(codegen->output, "\n\n");
+        lca_string_append_cstring(codegen->output, "\n\n");
         return;
     }
 
-    lca_string_append_format(codegen->output, " {\n");
+    lca_string_append_cstring(codegen->output, " {\n");
 
     for (int64_t i = 0; i < block_count; i++) {
         llvm_print_block(codegen, lyir_value_function_block_get_at_index(function, i));
     }
 
-    lca_string_append_format(codegen->output, "}\n");
+    lca_string_append_cstring(codegen->output, "}\n");
 }
 
 static void llvm_print_type_struct_literally(llvm_codegen* codegen, lyir_type* type) {
-    lca_string_append_format(codegen->output, "type { ");
+    lca_string_append_cstring(codegen->output, "type { ");
 
     for (int64_t i = 0; i < lyir_type_struct_member_count_get(type); i++) {
         if (i > 0) {
-            lca_string_append_format(codegen->output, ", ");
+            lca_string_append_cstring(codegen->output, ", ");
         }
 
         lyir_type* member_type = lyir_type_struct_member_type_get_at_index(type, i);
         llvm_print_type(codegen, member_type);
     }
 
-    lca_string_append_format(codegen->output, "}");
+    lca_string_append_char(codegen->output, '}');
 }
 
 static void llvm_print_type(llvm_codegen* codegen, lyir_type* type) {
@@ -235,15 +245,16 @@ static void llvm_print_type(llvm_codegen* codegen, lyir_type* type) {
         } break;
 
         case LYIR_TYPE_POINTER: {
-            lca_string_append_format(codegen->output, "ptr");
+            lca_string_append_cstring(codegen->output, "ptr");
         } break;
 
         case LYIR_TYPE_VOID: {
-            lca_string_append_format(codegen->output, "void");
+            lca_string_append_cstring(codegen->output, "void");
         } break;
 
         case LYIR_TYPE_INTEGER: {
-            lca_string_append_format(codegen->output, "i%d", lyir_type_size_in_bits(type));
+            lca_string_append_char(codegen->output, 'i');
+            lca_string_append_int(codegen->output, lyir_type_size_in_bits(type));
         } break;
 
         case LYIR_TYPE_FLOAT: {
@@ -254,25 +265,28 @@ static void llvm_print_type(llvm_codegen* codegen, lyir_type* type) {
                 } break;
 
                 case 32: {
-                    lca_string_append_format(codegen->output, "float");
+                    lca_string_append_cstring(codegen->output, "float");
                 } break;
 
                 case 64: {
-                    lca_string_append_format(codegen->output, "double");
+                    lca_string_append_cstring(codegen->output, "double");
                 } break;
             }
         } break;
 
         case LYIR_TYPE_ARRAY: {
             lyir_type* element_type = lyir_type_element_type_get(type);
-            lca_string_append_format(codegen->output, "[%lld x ", lyir_type_array_length_get(type));
+            lca_string_append_char(codegen->output, '[');
+            lca_string_append_int(codegen->output, lyir_type_array_length_get(type));
+            lca_string_append_cstring(codegen->output, " x ");
             llvm_print_type(codegen, element_type);
-            lca_string_append_format(codegen->output, "]");
+            lca_string_append_char(codegen->output, ']');
         } break;
 
         case LYIR_TYPE_STRUCT: {
             if (lyir_type_struct_is_named(type)) {
-                lca_string_append_format(codegen->output, "%%%.*s", LCA_STR_EXPAND(lyir_type_struct_name_get(type)));
+                lca_string_append_char(codegen->output, '%');
+                lca_string_append_view(codegen->output, lyir_type_struct_name_get(type));
             } else {
                 llvm_print_type_struct_literally(codegen, type);
             }
@@ -284,9 +298,12 @@ static void llvm_print_block(llvm_codegen* codegen, lyir_value* block) {
     int64_t instruction_count = lyir_value_block_instruction_count_get(block);
 
     if (lyir_value_block_has_name(block)) {
-        lca_string_append_format(codegen->output, "%.*s:\n", LCA_STR_EXPAND(lyir_value_block_name_get(block)));
+        lca_string_append_view(codegen->output, lyir_value_block_name_get(block));
+        lca_string_append_cstring(codegen->output, ":\n");
     } else {
-        lca_string_append_format(codegen->output, "_bb%lld:\n", lyir_value_block_index_get(block));
+        lca_string_append_cstring(codegen->output, "_bb");
+        lca_string_append_int(codegen->output, lyir_value_block_index_get(block));
+        lca_string_append_cstring(codegen->output, ":\n");
     }
 
     for (int64_t i = 0; i < instruction_count; i++) {
@@ -301,11 +318,11 @@ static void llvm_print_instruction(llvm_codegen* codegen, lyir_value* instructio
         return;
     }
 
-    lca_string_append_format(codegen->output, "  ");
+    lca_string_append_cstring(codegen->output, "  ");
 
     if (!lyir_type_is_void(lyir_value_type_get(instruction))) {
         llvm_print_value(codegen, instruction, false);
-        lca_string_append_format(codegen->output, " = ");
+        lca_string_append_cstring(codegen->output, " = ");
     }
 
     switch (kind) {
@@ -315,62 +332,63 @@ static void llvm_print_instruction(llvm_codegen* codegen, lyir_value* instructio
         } break;
 
         case LYIR_IR_UNREACHABLE: {
-            lca_string_append_format(codegen->output, "unreachable");
+            lca_string_append_cstring(codegen->output, "unreachable");
         } break;
 
         case LYIR_IR_RETURN: {
-            lca_string_append_format(codegen->output, "ret ");
+            lca_string_append_cstring(codegen->output, "ret ");
             if (lyir_value_return_has_value(instruction)) {
                 llvm_print_value(codegen, lyir_value_return_value_get(instruction), true);
             } else {
-                lca_string_append_format(codegen->output, "void");
+                lca_string_append_cstring(codegen->output, "void");
             }
         } break;
 
         case LYIR_IR_ALLOCA: {
-            lca_string_append_format(codegen->output, "alloca ");
+            lca_string_append_cstring(codegen->output, "alloca ");
             llvm_print_type(codegen, lyir_value_alloca_type_get(instruction));
-            lca_string_append_format(codegen->output, ", i64 1");
+            lca_string_append_cstring(codegen->output, ", i64 1");
         } break;
 
         case LYIR_IR_STORE: {
-            lca_string_append_format(codegen->output, "store ");
+            lca_string_append_cstring(codegen->output, "store ");
             llvm_print_value(codegen, lyir_value_operand_get(instruction), true);
-            lca_string_append_format(codegen->output, ", ");
+            lca_string_append_cstring(codegen->output, ", ");
             llvm_print_value(codegen, lyir_value_address_get(instruction), true);
-            lca_string_append_format(codegen->output, ", align %d", lyir_type_align_in_bytes(lyir_value_type_get(lyir_value_operand_get(instruction))));
+            lca_string_append_cstring(codegen->output, ", align ");
+            lca_string_append_int(codegen->output, lyir_type_align_in_bytes(lyir_value_type_get(lyir_value_operand_get(instruction))));
         } break;
 
         case LYIR_IR_LOAD: {
-            lca_string_append_format(codegen->output, "load ");
+            lca_string_append_cstring(codegen->output, "load ");
             llvm_print_type(codegen, lyir_value_type_get(instruction));
-            lca_string_append_format(codegen->output, ", ");
+            lca_string_append_cstring(codegen->output, ", ");
             llvm_print_value(codegen, lyir_value_address_get(instruction), true);
         } break;
 
         case LYIR_IR_CALL: {
-            lca_string_append_format(codegen->output, "call ");
+            lca_string_append_cstring(codegen->output, "call ");
             llvm_print_type(codegen, lyir_value_type_get(instruction));
-            lca_string_append_format(codegen->output, " ");
+            lca_string_append_char(codegen->output, ' ');
             llvm_print_value(codegen, lyir_value_callee_get(instruction), false);
-            lca_string_append_format(codegen->output, "(");
+            lca_string_append_char(codegen->output, '(');
 
             for (int64_t i = 0, count = lyir_value_call_argument_count_get(instruction); i < count; i++) {
                 if (i > 0) {
-                    lca_string_append_format(codegen->output, ", ");
+                    lca_string_append_cstring(codegen->output, ", ");
                 }
 
                 lyir_value* argument = lyir_value_call_argument_get_at_index(instruction, i);
                 llvm_print_value(codegen, argument, true);
             }
 
-            lca_string_append_format(codegen->output, ")");
+            lca_string_append_char(codegen->output, ')');
         } break;
 
         case LYIR_IR_PTRADD: {
-            lca_string_append_format(codegen->output, "getelementptr inbounds i8, ");
+            lca_string_append_cstring(codegen->output, "getelementptr inbounds i8, ");
             llvm_print_value(codegen, lyir_value_address_get(instruction), true);
-            lca_string_append_format(codegen->output, ", ");
+            lca_string_append_cstring(codegen->output, ", ");
             llvm_print_value(codegen, lyir_value_operand_get(instruction), true);
         } break;
 
@@ -387,11 +405,13 @@ static void llvm_print_instruction(llvm_codegen* codegen, lyir_value* instructio
                 case LYIR_BUILTIN_MEMSET: intrinsic_name = LLVM_MEMSET_INTRINSIC; break;
             }
 
-            lca_string_append_format(codegen->output, "call void @%s(", intrinsic_name);
+            lca_string_append_cstring(codegen->output, "call void @");
+            lca_string_append_cstring(codegen->output, intrinsic_name);
+            lca_string_append_char(codegen->output, '(');
 
             for (int64_t i = 0, count = lyir_value_builtin_argument_count_get(instruction); i < count; i++) {
                 if (i > 0) {
-                    lca_string_append_format(codegen->output, ", ");
+                    lca_string_append_cstring(codegen->output, ", ");
                 }
 
                 lyir_value* argument = lyir_value_builtin_argument_set_at_index(instruction, i);
@@ -404,440 +424,440 @@ static void llvm_print_instruction(llvm_codegen* codegen, lyir_value* instructio
                 }
 
                 case LYIR_BUILTIN_MEMCOPY:
-                case LYIR_BUILTIN_MEMSET: lca_string_append_format(codegen->output, ", i1 false"); break;
+                case LYIR_BUILTIN_MEMSET: lca_string_append_cstring(codegen->output, ", i1 false"); break;
             }
 
-            lca_string_append_format(codegen->output, ")");
+            lca_string_append_char(codegen->output, ')');
         } break;
 
         case LYIR_IR_BRANCH: {
-            lca_string_append_format(codegen->output, "br label ");
+            lca_string_append_cstring(codegen->output, "br label ");
             llvm_print_value(codegen, lyir_value_branch_pass_get(instruction), false);
         } break;
 
         case LYIR_IR_COND_BRANCH: {
-            lca_string_append_format(codegen->output, "br i1 ");
+            lca_string_append_cstring(codegen->output, "br i1 ");
             llvm_print_value(codegen, lyir_value_operand_get(instruction), false);
-            lca_string_append_format(codegen->output, ", label ");
+            lca_string_append_cstring(codegen->output, ", label ");
             llvm_print_value(codegen, lyir_value_branch_pass_get(instruction), false);
-            lca_string_append_format(codegen->output, ", label ");
+            lca_string_append_cstring(codegen->output, ", label ");
             llvm_print_value(codegen, lyir_value_branch_fail_get(instruction), false);
         } break;
 
         case LYIR_IR_PHI: {
-            lca_string_append_format(codegen->output, "phi ");
+            lca_string_append_cstring(codegen->output, "phi ");
             llvm_print_type(codegen, lyir_value_type_get(instruction));
 
             for (int64_t i = 0, count = lyir_value_phi_incoming_value_count_get(instruction); i < count; i++) {
-                if (i > 0) lca_string_append_format(codegen->output, ",");
-                lca_string_append_format(codegen->output, " [ ");
+                if (i > 0) lca_string_append_char(codegen->output, ',');
+                lca_string_append_cstring(codegen->output, " [ ");
                 llvm_print_value(codegen, lyir_phi_incoming_value_get_at_index(instruction, i), false);
-                lca_string_append_format(codegen->output, ", ");
+                lca_string_append_cstring(codegen->output, ", ");
                 llvm_print_value(codegen, lyir_phi_incoming_block_get_at_index(instruction, i), false);
-                lca_string_append_format(codegen->output, " ]");
+                lca_string_append_cstring(codegen->output, " ]");
             }
         } break;
 
         case LYIR_IR_SEXT: {
-            lca_string_append_format(codegen->output, "sext ");
+            lca_string_append_cstring(codegen->output, "sext ");
             llvm_print_value(codegen, lyir_value_operand_get(instruction), true);
-            lca_string_append_format(codegen->output, " to ");
+            lca_string_append_cstring(codegen->output, " to ");
             llvm_print_type(codegen, lyir_value_type_get(instruction));
         } break;
 
         case LYIR_IR_ZEXT: {
-            lca_string_append_format(codegen->output, "zext ");
+            lca_string_append_cstring(codegen->output, "zext ");
             llvm_print_value(codegen, lyir_value_operand_get(instruction), true);
-            lca_string_append_format(codegen->output, " to ");
+            lca_string_append_cstring(codegen->output, " to ");
             llvm_print_type(codegen, lyir_value_type_get(instruction));
         } break;
 
         case LYIR_IR_TRUNC: {
-            lca_string_append_format(codegen->output, "trunc ");
+            lca_string_append_cstring(codegen->output, "trunc ");
             llvm_print_value(codegen, lyir_value_operand_get(instruction), true);
-            lca_string_append_format(codegen->output, " to ");
+            lca_string_append_cstring(codegen->output, " to ");
             llvm_print_type(codegen, lyir_value_type_get(instruction));
         } break;
 
         case LYIR_IR_BITCAST: {
-            lca_string_append_format(codegen->output, "bitcast ");
+            lca_string_append_cstring(codegen->output, "bitcast ");
             llvm_print_value(codegen, lyir_value_operand_get(instruction), true);
-            lca_string_append_format(codegen->output, " to ");
+            lca_string_append_cstring(codegen->output, " to ");
             llvm_print_type(codegen, lyir_value_type_get(instruction));
         } break;
 
         case LYIR_IR_NEG: {
             lyir_value* operand = lyir_value_operand_get(instruction);
             if (lyir_type_is_float(lyir_value_type_get(operand))) {
-                lca_string_append_format(codegen->output, "fsub ");
+                lca_string_append_cstring(codegen->output, "fsub ");
                 llvm_print_type(codegen, lyir_value_type_get(operand));
-                lca_string_append_format(codegen->output, " 0.0, ");
+                lca_string_append_cstring(codegen->output, " 0.0, ");
             } else {
-                lca_string_append_format(codegen->output, "sub ");
+                lca_string_append_cstring(codegen->output, "sub ");
                 llvm_print_type(codegen, lyir_value_type_get(operand));
-                lca_string_append_format(codegen->output, " 0, ");
+                lca_string_append_cstring(codegen->output, " 0, ");
             }
             llvm_print_value(codegen, operand, false);
         } break;
 
         case LYIR_IR_COMPL: {
-            lca_string_append_format(codegen->output, "xor ");
+            lca_string_append_cstring(codegen->output, "xor ");
             llvm_print_value(codegen, lyir_value_operand_get(instruction), true);
-            lca_string_append_format(codegen->output, ", -1");
+            lca_string_append_cstring(codegen->output, ", -1");
         } break;
 
         case LYIR_IR_FPTOUI: {
-            lca_string_append_format(codegen->output, "fptoui ");
+            lca_string_append_cstring(codegen->output, "fptoui ");
             llvm_print_value(codegen, lyir_value_operand_get(instruction), true);
-            lca_string_append_format(codegen->output, " to ");
+            lca_string_append_cstring(codegen->output, " to ");
             llvm_print_type(codegen, lyir_value_type_get(instruction));
         } break;
 
         case LYIR_IR_FPTOSI: {
-            lca_string_append_format(codegen->output, "fptosi ");
+            lca_string_append_cstring(codegen->output, "fptosi ");
             llvm_print_value(codegen, lyir_value_operand_get(instruction), true);
-            lca_string_append_format(codegen->output, " to ");
+            lca_string_append_cstring(codegen->output, " to ");
             llvm_print_type(codegen, lyir_value_type_get(instruction));
         } break;
 
         case LYIR_IR_UITOFP: {
-            lca_string_append_format(codegen->output, "uitofp ");
+            lca_string_append_cstring(codegen->output, "uitofp ");
             llvm_print_value(codegen, lyir_value_operand_get(instruction), true);
-            lca_string_append_format(codegen->output, " to ");
+            lca_string_append_cstring(codegen->output, " to ");
             llvm_print_type(codegen, lyir_value_type_get(instruction));
         } break;
 
         case LYIR_IR_SITOFP: {
-            lca_string_append_format(codegen->output, "sitofp ");
+            lca_string_append_cstring(codegen->output, "sitofp ");
             llvm_print_value(codegen, lyir_value_operand_get(instruction), true);
-            lca_string_append_format(codegen->output, " to ");
+            lca_string_append_cstring(codegen->output, " to ");
             llvm_print_type(codegen, lyir_value_type_get(instruction));
         } break;
 
         case LYIR_IR_FPEXT: {
-            lca_string_append_format(codegen->output, "fpext ");
+            lca_string_append_cstring(codegen->output, "fpext ");
             llvm_print_value(codegen, lyir_value_operand_get(instruction), true);
-            lca_string_append_format(codegen->output, " to ");
+            lca_string_append_cstring(codegen->output, " to ");
             llvm_print_type(codegen, lyir_value_type_get(instruction));
         } break;
 
         case LYIR_IR_FPTRUNC: {
-            lca_string_append_format(codegen->output, "fptrunc ");
+            lca_string_append_cstring(codegen->output, "fptrunc ");
             llvm_print_value(codegen, lyir_value_operand_get(instruction), true);
-            lca_string_append_format(codegen->output, " to ");
+            lca_string_append_cstring(codegen->output, " to ");
             llvm_print_type(codegen, lyir_value_type_get(instruction));
         } break;
 
         case LYIR_IR_ADD: {
-            lca_string_append_format(codegen->output, "add ");
+            lca_string_append_cstring(codegen->output, "add ");
             llvm_print_value(codegen, lyir_value_lhs_get(instruction), true);
-            lca_string_append_format(codegen->output, ", ");
+            lca_string_append_cstring(codegen->output, ", ");
             llvm_print_value(codegen, lyir_value_rhs_get(instruction), false);
         } break;
 
         case LYIR_IR_FADD: {
-            lca_string_append_format(codegen->output, "fadd ");
+            lca_string_append_cstring(codegen->output, "fadd ");
             llvm_print_value(codegen, lyir_value_lhs_get(instruction), true);
-            lca_string_append_format(codegen->output, ", ");
+            lca_string_append_cstring(codegen->output, ", ");
             llvm_print_value(codegen, lyir_value_rhs_get(instruction), false);
         } break;
 
         case LYIR_IR_SUB: {
-            lca_string_append_format(codegen->output, "sub ");
+            lca_string_append_cstring(codegen->output, "sub ");
             llvm_print_value(codegen, lyir_value_lhs_get(instruction), true);
-            lca_string_append_format(codegen->output, ", ");
+            lca_string_append_cstring(codegen->output, ", ");
             llvm_print_value(codegen, lyir_value_rhs_get(instruction), false);
         } break;
 
         case LYIR_IR_FSUB: {
-            lca_string_append_format(codegen->output, "fsub ");
+            lca_string_append_cstring(codegen->output, "fsub ");
             llvm_print_value(codegen, lyir_value_lhs_get(instruction), true);
-            lca_string_append_format(codegen->output, ", ");
+            lca_string_append_cstring(codegen->output, ", ");
             llvm_print_value(codegen, lyir_value_rhs_get(instruction), false);
         } break;
 
         case LYIR_IR_MUL: {
-            lca_string_append_format(codegen->output, "mul ");
+            lca_string_append_cstring(codegen->output, "mul ");
             llvm_print_value(codegen, lyir_value_lhs_get(instruction), true);
-            lca_string_append_format(codegen->output, ", ");
+            lca_string_append_cstring(codegen->output, ", ");
             llvm_print_value(codegen, lyir_value_rhs_get(instruction), false);
         } break;
 
         case LYIR_IR_FMUL: {
-            lca_string_append_format(codegen->output, "fmul ");
+            lca_string_append_cstring(codegen->output, "fmul ");
             llvm_print_value(codegen, lyir_value_lhs_get(instruction), true);
-            lca_string_append_format(codegen->output, ", ");
+            lca_string_append_cstring(codegen->output, ", ");
             llvm_print_value(codegen, lyir_value_rhs_get(instruction), false);
         } break;
 
         case LYIR_IR_SDIV: {
-            lca_string_append_format(codegen->output, "sdiv ");
+            lca_string_append_cstring(codegen->output, "sdiv ");
             llvm_print_value(codegen, lyir_value_lhs_get(instruction), true);
-            lca_string_append_format(codegen->output, ", ");
+            lca_string_append_cstring(codegen->output, ", ");
             llvm_print_value(codegen, lyir_value_rhs_get(instruction), false);
         } break;
 
         case LYIR_IR_UDIV: {
-            lca_string_append_format(codegen->output, "udiv ");
+            lca_string_append_cstring(codegen->output, "udiv ");
             llvm_print_value(codegen, lyir_value_lhs_get(instruction), true);
-            lca_string_append_format(codegen->output, ", ");
+            lca_string_append_cstring(codegen->output, ", ");
             llvm_print_value(codegen, lyir_value_rhs_get(instruction), false);
         } break;
 
         case LYIR_IR_FDIV: {
-            lca_string_append_format(codegen->output, "fdiv ");
+            lca_string_append_cstring(codegen->output, "fdiv ");
             llvm_print_value(codegen, lyir_value_lhs_get(instruction), true);
-            lca_string_append_format(codegen->output, ", ");
+            lca_string_append_cstring(codegen->output, ", ");
             llvm_print_value(codegen, lyir_value_rhs_get(instruction), false);
         } break;
 
         case LYIR_IR_SMOD: {
-            lca_string_append_format(codegen->output, "srem ");
+            lca_string_append_cstring(codegen->output, "srem ");
             llvm_print_value(codegen, lyir_value_lhs_get(instruction), true);
-            lca_string_append_format(codegen->output, ", ");
+            lca_string_append_cstring(codegen->output, ", ");
             llvm_print_value(codegen, lyir_value_rhs_get(instruction), false);
         } break;
 
         case LYIR_IR_UMOD: {
-            lca_string_append_format(codegen->output, "urem ");
+            lca_string_append_cstring(codegen->output, "urem ");
             llvm_print_value(codegen, lyir_value_lhs_get(instruction), true);
-            lca_string_append_format(codegen->output, ", ");
+            lca_string_append_cstring(codegen->output, ", ");
             llvm_print_value(codegen, lyir_value_rhs_get(instruction), false);
         } break;
 
         case LYIR_IR_FMOD: {
-            lca_string_append_format(codegen->output, "frem ");
+            lca_string_append_cstring(codegen->output, "frem ");
             llvm_print_value(codegen, lyir_value_lhs_get(instruction), true);
-            lca_string_append_format(codegen->output, ", ");
+            lca_string_append_cstring(codegen->output, ", ");
             llvm_print_value(codegen, lyir_value_rhs_get(instruction), false);
         } break;
 
         case LYIR_IR_AND: {
-            lca_string_append_format(codegen->output, "and ");
+            lca_string_append_cstring(codegen->output, "and ");
             llvm_print_value(codegen, lyir_value_lhs_get(instruction), true);
-            lca_string_append_format(codegen->output, ", ");
+            lca_string_append_cstring(codegen->output, ", ");
             llvm_print_value(codegen, lyir_value_rhs_get(instruction), false);
         } break;
 
         case LYIR_IR_OR: {
-            lca_string_append_format(codegen->output, "or ");
+            lca_string_append_cstring(codegen->output, "or ");
             llvm_print_value(codegen, lyir_value_lhs_get(instruction), true);
-            lca_string_append_format(codegen->output, ", ");
+            lca_string_append_cstring(codegen->output, ", ");
             llvm_print_value(codegen, lyir_value_rhs_get(instruction), false);
         } break;
 
         case LYIR_IR_XOR: {
-            lca_string_append_format(codegen->output, "xor ");
+            lca_string_append_cstring(codegen->output, "xor ");
             llvm_print_value(codegen, lyir_value_lhs_get(instruction), true);
-            lca_string_append_format(codegen->output, ", ");
+            lca_string_append_cstring(codegen->output, ", ");
             llvm_print_value(codegen, lyir_value_rhs_get(instruction), false);
         } break;
 
         case LYIR_IR_SHL: {
-            lca_string_append_format(codegen->output, "shl ");
+            lca_string_append_cstring(codegen->output, "shl ");
             llvm_print_value(codegen, lyir_value_lhs_get(instruction), true);
-            lca_string_append_format(codegen->output, ", ");
+            lca_string_append_cstring(codegen->output, ", ");
             llvm_print_value(codegen, lyir_value_rhs_get(instruction), false);
         } break;
 
         case LYIR_IR_SAR: {
-            lca_string_append_format(codegen->output, "ashr ");
+            lca_string_append_cstring(codegen->output, "ashr ");
             llvm_print_value(codegen, lyir_value_lhs_get(instruction), true);
-            lca_string_append_format(codegen->output, ", ");
+            lca_string_append_cstring(codegen->output, ", ");
             llvm_print_value(codegen, lyir_value_rhs_get(instruction), false);
         } break;
 
         case LYIR_IR_SHR: {
-            lca_string_append_format(codegen->output, "lshr ");
+            lca_string_append_cstring(codegen->output, "lshr ");
             llvm_print_value(codegen, lyir_value_lhs_get(instruction), true);
-            lca_string_append_format(codegen->output, ", ");
+            lca_string_append_cstring(codegen->output, ", ");
             llvm_print_value(codegen, lyir_value_rhs_get(instruction), false);
         } break;
 
         case LYIR_IR_ICMP_EQ: {
-            lca_string_append_format(codegen->output, "icmp eq ");
+            lca_string_append_cstring(codegen->output, "icmp eq ");
             llvm_print_value(codegen, lyir_value_lhs_get(instruction), true);
-            lca_string_append_format(codegen->output, ", ");
+            lca_string_append_cstring(codegen->output, ", ");
             llvm_print_value(codegen, lyir_value_rhs_get(instruction), false);
         } break;
 
         case LYIR_IR_ICMP_NE: {
-            lca_string_append_format(codegen->output, "icmp ne ");
+            lca_string_append_cstring(codegen->output, "icmp ne ");
             llvm_print_value(codegen, lyir_value_lhs_get(instruction), true);
-            lca_string_append_format(codegen->output, ", ");
+            lca_string_append_cstring(codegen->output, ", ");
             llvm_print_value(codegen, lyir_value_rhs_get(instruction), false);
         } break;
 
         case LYIR_IR_ICMP_SLT: {
-            lca_string_append_format(codegen->output, "icmp slt ");
+            lca_string_append_cstring(codegen->output, "icmp slt ");
             llvm_print_value(codegen, lyir_value_lhs_get(instruction), true);
-            lca_string_append_format(codegen->output, ", ");
+            lca_string_append_cstring(codegen->output, ", ");
             llvm_print_value(codegen, lyir_value_rhs_get(instruction), false);
         } break;
 
         case LYIR_IR_ICMP_ULT: {
-            lca_string_append_format(codegen->output, "icmp ult ");
+            lca_string_append_cstring(codegen->output, "icmp ult ");
             llvm_print_value(codegen, lyir_value_lhs_get(instruction), true);
-            lca_string_append_format(codegen->output, ", ");
+            lca_string_append_cstring(codegen->output, ", ");
             llvm_print_value(codegen, lyir_value_rhs_get(instruction), false);
         } break;
 
         case LYIR_IR_ICMP_SLE: {
-            lca_string_append_format(codegen->output, "icmp sle ");
+            lca_string_append_cstring(codegen->output, "icmp sle ");
             llvm_print_value(codegen, lyir_value_lhs_get(instruction), true);
-            lca_string_append_format(codegen->output, ", ");
+            lca_string_append_cstring(codegen->output, ", ");
             llvm_print_value(codegen, lyir_value_rhs_get(instruction), false);
         } break;
 
         case LYIR_IR_ICMP_ULE: {
-            lca_string_append_format(codegen->output, "icmp ule ");
+            lca_string_append_cstring(codegen->output, "icmp ule ");
             llvm_print_value(codegen, lyir_value_lhs_get(instruction), true);
-            lca_string_append_format(codegen->output, ", ");
+            lca_string_append_cstring(codegen->output, ", ");
             llvm_print_value(codegen, lyir_value_rhs_get(instruction), false);
         } break;
 
         case LYIR_IR_ICMP_SGT: {
-            lca_string_append_format(codegen->output, "icmp sgt ");
+            lca_string_append_cstring(codegen->output, "icmp sgt ");
             llvm_print_value(codegen, lyir_value_lhs_get(instruction), true);
-            lca_string_append_format(codegen->output, ", ");
+            lca_string_append_cstring(codegen->output, ", ");
             llvm_print_value(codegen, lyir_value_rhs_get(instruction), false);
         } break;
 
         case LYIR_IR_ICMP_UGT: {
-            lca_string_append_format(codegen->output, "icmp ugt ");
+            lca_string_append_cstring(codegen->output, "icmp ugt ");
             llvm_print_value(codegen, lyir_value_lhs_get(instruction), true);
-            lca_string_append_format(codegen->output, ", ");
+            lca_string_append_cstring(codegen->output, ", ");
             llvm_print_value(codegen, lyir_value_rhs_get(instruction), false);
         } break;
 
         case LYIR_IR_ICMP_SGE: {
-            lca_string_append_format(codegen->output, "icmp sge ");
+            lca_string_append_cstring(codegen->output, "icmp sge ");
             llvm_print_value(codegen, lyir_value_lhs_get(instruction), true);
-            lca_string_append_format(codegen->output, ", ");
+            lca_string_append_cstring(codegen->output, ", ");
             llvm_print_value(codegen, lyir_value_rhs_get(instruction), false);
         } break;
 
         case LYIR_IR_ICMP_UGE: {
-            lca_string_append_format(codegen->output, "icmp uge ");
+            lca_string_append_cstring(codegen->output, "icmp uge ");
             llvm_print_value(codegen, lyir_value_lhs_get(instruction), true);
-            lca_string_append_format(codegen->output, ", ");
+            lca_string_append_cstring(codegen->output, ", ");
             llvm_print_value(codegen, lyir_value_rhs_get(instruction), false);
         } break;
 
         case LYIR_IR_FCMP_FALSE: {
-            lca_string_append_format(codegen->output, "fcmp false ");
+            lca_string_append_cstring(codegen->output, "fcmp false ");
             llvm_print_value(codegen, lyir_value_lhs_get(instruction), true);
-            lca_string_append_format(codegen->output, ", ");
+            lca_string_append_cstring(codegen->output, ", ");
             llvm_print_value(codegen, lyir_value_rhs_get(instruction), false);
         } break;
 
         case LYIR_IR_FCMP_OEQ: {
-            lca_string_append_format(codegen->output, "fcmp oeq ");
+            lca_string_append_cstring(codegen->output, "fcmp oeq ");
             llvm_print_value(codegen, lyir_value_lhs_get(instruction), true);
-            lca_string_append_format(codegen->output, ", ");
+            lca_string_append_cstring(codegen->output, ", ");
             llvm_print_value(codegen, lyir_value_rhs_get(instruction), false);
         } break;
 
         case LYIR_IR_FCMP_OGT: {
-            lca_string_append_format(codegen->output, "fcmp ogt ");
+            lca_string_append_cstring(codegen->output, "fcmp ogt ");
             llvm_print_value(codegen, lyir_value_lhs_get(instruction), true);
-            lca_string_append_format(codegen->output, ", ");
+            lca_string_append_cstring(codegen->output, ", ");
             llvm_print_value(codegen, lyir_value_rhs_get(instruction), false);
         } break;
 
         case LYIR_IR_FCMP_OGE: {
-            lca_string_append_format(codegen->output, "fcmp oge ");
+            lca_string_append_cstring(codegen->output, "fcmp oge ");
             llvm_print_value(codegen, lyir_value_lhs_get(instruction), true);
-            lca_string_append_format(codegen->output, ", ");
+            lca_string_append_cstring(codegen->output, ", ");
             llvm_print_value(codegen, lyir_value_rhs_get(instruction), false);
         } break;
 
         case LYIR_IR_FCMP_OLT: {
-            lca_string_append_format(codegen->output, "fcmp olt ");
+            lca_string_append_cstring(codegen->output, "fcmp olt ");
             llvm_print_value(codegen, lyir_value_lhs_get(instruction), true);
-            lca_string_append_format(codegen->output, ", ");
+            lca_string_append_cstring(codegen->output, ", ");
             llvm_print_value(codegen, lyir_value_rhs_get(instruction), false);
         } break;
 
         case LYIR_IR_FCMP_OLE: {
-            lca_string_append_format(codegen->output, "fcmp ole ");
+            lca_string_append_cstring(codegen->output, "fcmp ole ");
             llvm_print_value(codegen, lyir_value_lhs_get(instruction), true);
-            lca_string_append_format(codegen->output, ", ");
+            lca_string_append_cstring(codegen->output, ", ");
             llvm_print_value(codegen, lyir_value_rhs_get(instruction), false);
         } break;
 
         case LYIR_IR_FCMP_ONE: {
-            lca_string_append_format(codegen->output, "fcmp one ");
+            lca_string_append_cstring(codegen->output, "fcmp one ");
             llvm_print_value(codegen, lyir_value_lhs_get(instruction), true);
-            lca_string_append_format(codegen->output, ", ");
+            lca_string_append_cstring(codegen->output, ", ");
             llvm_print_value(codegen, lyir_value_rhs_get(instruction), false);
         } break;
 
         case LYIR_IR_FCMP_ORD: {
-            lca_string_append_format(codegen->output, "fcmp ord ");
+            lca_string_append_cstring(codegen->output, "fcmp ord ");
             llvm_print_value(codegen, lyir_value_lhs_get(instruction), true);
-            lca_string_append_format(codegen->output, ", ");
+            lca_string_append_cstring(codegen->output, ", ");
             llvm_print_value(codegen, lyir_value_rhs_get(instruction), false);
         } break;
 
         case LYIR_IR_FCMP_UEQ: {
-            lca_string_append_format(codegen->output, "fcmp ueq ");
+            lca_string_append_cstring(codegen->output, "fcmp ueq ");
             llvm_print_value(codegen, lyir_value_lhs_get(instruction), true);
-            lca_string_append_format(codegen->output, ", ");
+            lca_string_append_cstring(codegen->output, ", ");
             llvm_print_value(codegen, lyir_value_rhs_get(instruction), false);
         } break;
 
         case LYIR_IR_FCMP_UGT: {
-            lca_string_append_format(codegen->output, "fcmp ugt ");
+            lca_string_append_cstring(codegen->output, "fcmp ugt ");
             llvm_print_value(codegen, lyir_value_lhs_get(instruction), true);
-            lca_string_append_format(codegen->output, ", ");
+            lca_string_append_cstring(codegen->output, ", ");
             llvm_print_value(codegen, lyir_value_rhs_get(instruction), false);
         } break;
 
         case LYIR_IR_FCMP_UGE: {
-            lca_string_append_format(codegen->output, "fcmp uge ");
+            lca_string_append_cstring(codegen->output, "fcmp uge ");
             llvm_print_value(codegen, lyir_value_lhs_get(instruction), true);
-            lca_string_append_format(codegen->output, ", ");
+            lca_string_append_cstring(codegen->output, ", ");
             llvm_print_value(codegen, lyir_value_rhs_get(instruction), false);
         } break;
 
         case LYIR_IR_FCMP_ULT: {
-            lca_string_append_format(codegen->output, "fcmp ult ");
+            lca_string_append_cstring(codegen->output, "fcmp ult ");
             llvm_print_value(codegen, lyir_value_lhs_get(instruction), true);
-            lca_string_append_format(codegen->output, ", ");
+            lca_string_append_cstring(codegen->output, ", ");
             llvm_print_value(codegen, lyir_value_rhs_get(instruction), false);
         } break;
 
         case LYIR_IR_FCMP_ULE: {
-            lca_string_append_format(codegen->output, "fcmp ule ");
+            lca_string_append_cstring(codegen->output, "fcmp ule ");
             llvm_print_value(codegen, lyir_value_lhs_get(instruction), true);
-            lca_string_append_format(codegen->output, ", ");
+            lca_string_append_cstring(codegen->output, ", ");
             llvm_print_value(codegen, lyir_value_rhs_get(instruction), false);
         } break;
 
         case LYIR_IR_FCMP_UNE: {
-            lca_string_append_format(codegen->output, "fcmp une ");
+            lca_string_append_cstring(codegen->output, "fcmp une ");
             llvm_print_value(codegen, lyir_value_lhs_get(instruction), true);
-            lca_string_append_format(codegen->output, ", ");
+            lca_string_append_cstring(codegen->output, ", ");
             llvm_print_value(codegen, lyir_value_rhs_get(instruction), false);
         } break;
 
         case LYIR_IR_FCMP_UNO: {
-            lca_string_append_format(codegen->output, "fcmp uno ");
+            lca_string_append_cstring(codegen->output, "fcmp uno ");
             llvm_print_value(codegen, lyir_value_lhs_get(instruction), true);
-            lca_string_append_format(codegen->output, ", ");
+            lca_string_append_cstring(codegen->output, ", ");
             llvm_print_value(codegen, lyir_value_rhs_get(instruction), false);
         } break;
 
         case LYIR_IR_FCMP_TRUE: {
-            lca_string_append_format(codegen->output, "fcmp true ");
+            lca_string_append_cstring(codegen->output, "fcmp true ");
             llvm_print_value(codegen, lyir_value_lhs_get(instruction), true);
-            lca_string_append_format(codegen->output, ", ");
+            lca_string_append_cstring(codegen->output, ", ");
             llvm_print_value(codegen, lyir_value_rhs_get(instruction), false);
         } break;
     }
 
-    lca_string_append_format(codegen->output, "\n");
+    lca_string_append_char(codegen->output, '\n');
 }
 
 static void llvm_print_value(llvm_codegen* codegen, lyir_value* value, bool include_type) {
@@ -845,7 +865,7 @@ static void llvm_print_value(llvm_codegen* codegen, lyir_value* value, bool incl
 
     if (include_type) {
         llvm_print_type(codegen, lyir_value_type_get(value));
-        lca_string_append_format(codegen->output, " ");
+        lca_string_append_char(codegen->output, ' ');
     }
 
     switch (kind) {
@@ -853,29 +873,32 @@ static void llvm_print_value(llvm_codegen* codegen, lyir_value* value, bool incl
             lca_string_view name = lyir_value_name_get(value);
             if (name.count == 0) {
                 int64_t index = lyir_value_index_get(value);
-                lca_string_append_format(codegen->output, "%%%lld", index);
+                lca_string_append_char(codegen->output, '%');
+                lca_string_append_int(codegen->output, index);
             } else {
-                lca_string_append_format(codegen->output, "%%%.*s", LCA_STR_EXPAND(name));
+                lca_string_append_char(codegen->output, '%');
+                lca_string_append_view(codegen->output, name);
             }
         } break;
 
         case LYIR_IR_FUNCTION: {
-            lca_string_append_format(codegen->output, "@%.*s", LCA_STR_EXPAND(lyir_value_function_name_get(value)));
+            lca_string_append_char(codegen->output, '@');
+            lca_string_append_view(codegen->output, lyir_value_function_name_get(value));
         } break;
 
         case LYIR_IR_INTEGER_CONSTANT: {
             int64_t ival = lyir_value_integer_constant_get(value);
             if (lyir_type_is_ptr(lyir_value_type_get(value)) && ival == 0)
-                lca_string_append_format(codegen->output, "null");
-            else lca_string_append_format(codegen->output, "%lld", ival);
+                lca_string_append_cstring(codegen->output, "null");
+            else lca_string_append_int(codegen->output, ival);
         } break;
 
         case LYIR_IR_FLOAT_CONSTANT: {
             double float_value = lyir_value_float_constant_get(value);
             if (float_value == 0.0) {
-                lca_string_append_format(codegen->output, "0.0");
+                lca_string_append_cstring(codegen->output, "0.0");
             } else {
-                lca_string_append_format(codegen->output, "%f", float_value);
+                lca_string_append_double(codegen->output, float_value);
             }
         } break;
 
@@ -883,36 +906,41 @@ static void llvm_print_value(llvm_codegen* codegen, lyir_value* value, bool incl
             lca_string_view name = lyir_value_name_get(value);
             if (name.count == 0) {
                 int64_t index = lyir_value_index_get(value);
-                lca_string_append_format(codegen->output, "@.global.%lld", index);
+                lca_string_append_cstring(codegen->output, "@.global.");
+                lca_string_append_int(codegen->output, index);
             } else {
-                lca_string_append_format(codegen->output, "@%.*s", LCA_STR_EXPAND(name));
+                lca_string_append_char(codegen->output, '@');
+                lca_string_append_view(codegen->output, name);
             }
         } break;
 
         case LYIR_IR_BLOCK: {
             if (lyir_value_block_has_name(value)) {
-                lca_string_append_format(codegen->output, "%%%.*s", LCA_STR_EXPAND(lyir_value_block_name_get(value)));
+                lca_string_append_char(codegen->output, '%');
+                lca_string_append_view(codegen->output, lyir_value_block_name_get(value));
             } else {
-                lca_string_append_format(codegen->output, "%%_bb%lld", lyir_value_block_index_get(value));
+                lca_string_append_cstring(codegen->output, "%_bb");
+                lca_string_append_int(codegen->output, lyir_value_block_index_get(value));
             }
         } break;
 
         case LYIR_IR_ARRAY_CONSTANT: {
             bool is_string = lyir_array_constant_is_string(value);
             if (is_string) {
-                lca_string_append_format(codegen->output, "c\"");
+                lca_string_append_cstring(codegen->output, "c\"");
                 const uint8_t* data = (const uint8_t*)lyir_array_constant_data_get(value);
                 for (int64_t i = 0, count = lyir_array_constant_length_get(value); i < count; i++) {
                     uint8_t c = data[i];
                     if (c < 32 || c > 127) {
-                        lca_string_append_format(codegen->output, "\\%02X", (int)c);
+                        lca_string_append_char(codegen->output, '\\');
+                        lca_string_append_hex(codegen->output, c, 2);
                     } else {
-                        lca_string_append_format(codegen->output, "%c", c);
+                        lca_string_append_char(codegen->output, c);
                     }
                 }
-                lca_string_append_format(codegen->output, "\"");
+                lca_string_append_char(codegen->output, '"');
             } else {
-                lca_string_append_format(codegen->output, "{}");
+                lca_string_append_cstring(codegen->output, "{}");
                 assert(false && "todo llvm_print_value non-string arrays");
             }
         } break;